@@ -2,6 +2,25 @@
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
 
+#ifdef INSTANCED
+struct Object
+{
+	mat4 transform;
+
+	vec4 baseDiffuse;
+	float metallic;
+	float roughness;
+	float ignoreFog;
+	float ignoreLighting;
+};
+
+layout(set = 0, binding = 1) readonly buffer Instances
+{
+	Object objects[];
+} instances;
+
+#define object instances.objects[inInstance]
+#else
 layout(set = 0, binding = 1) uniform UboObject
 {
 #ifdef ANIMATED
@@ -15,6 +34,7 @@ layout(set = 0, binding = 1) uniform UboObject
 	float ignoreFog;
 	float ignoreLighting;
 } object;
+#endif
 
 #ifdef DIFFUSE_MAPPING
 layout(set = 0, binding = 2) uniform sampler2D samplerDiffuse;
@@ -32,6 +52,9 @@ layout(location = 2) in vec3 inNormal;
 #ifdef NORMAL_MAPPING
 layout(location = 3) in vec3 inTangent;
 #endif
+#ifdef INSTANCED
+layout(location = 4) flat in int inInstance;
+#endif
 
 layout(location = 0) out vec4 outPosition;
 layout(location = 1) out vec4 outDiffuse;
@@ -9,6 +9,25 @@ layout(set = 0, binding = 0) uniform UboScene
 	vec3 cameraPos;
 } scene;
 
+#ifdef INSTANCED
+struct Object
+{
+	mat4 transform;
+
+	vec4 baseDiffuse;
+	float metallic;
+	float roughness;
+	float ignoreFog;
+	float ignoreLighting;
+};
+
+layout(set = 0, binding = 1) readonly buffer Instances
+{
+	Object objects[];
+} instances;
+
+#define object instances.objects[gl_InstanceIndex]
+#else
 layout(set = 0, binding = 1) uniform UboObject
 {
 #ifdef ANIMATED
@@ -22,6 +41,7 @@ layout(set = 0, binding = 1) uniform UboObject
 	float ignoreFog;
 	float ignoreLighting;
 } object;
+#endif
 
 layout(set = 0, location = 0) in vec3 inPosition;
 layout(set = 0, location = 1) in vec2 inUv;
@@ -40,6 +60,9 @@ layout(location = 2) out vec3 outNormal;
 #ifdef NORMAL_MAPPING
 layout(location = 3) out vec3 outTangent;
 #endif
+#ifdef INSTANCED
+layout(location = 4) flat out int outInstance;
+#endif
 
 out gl_PerVertex
 {
@@ -74,6 +97,9 @@ void main()
 	outWorldPos = worldPosition.xyz;
 	outUv = inUv;
 	outNormal = worldNormal.xyz;
+#ifdef INSTANCED
+	outInstance = gl_InstanceIndex;
+#endif
 
 #ifdef NORMAL_MAPPING
 	mat3 matrixNormal = transpose(inverse(mat3(object.transform)));
@@ -29,6 +29,7 @@
 #include "Engine/Log.hpp"
 #include "Engine/Exports.hpp"
 #include "Engine/IModule.hpp"
+#include "Engine/ModuleAccess.hpp"
 #include "Engine/ModuleRegister.hpp"
 #include "Engine/ModuleUpdater.hpp"
 #include "Events/EventChange.hpp"
@@ -40,7 +41,8 @@
 #include "Files/Files.hpp"
 #include "Files/IFile.hpp"
 #include "Files/Json/FileJson.hpp"
-#include "Files/Json/JsonSection.hpp"
+#include "Files/Json/JsonReader.hpp"
+#include "Files/Json/JsonWriter.hpp"
 #include "Files/Xml/FileXml.hpp"
 #include "Files/Xml/XmlNode.hpp"
 #include "Fonts/FontCharacter.hpp"
@@ -53,6 +55,8 @@
 #include "Guis/Gui.hpp"
 #include "Guis/RendererGuis.hpp"
 #include "Helpers/FileSystem.hpp"
+#include "Helpers/MappedFile.hpp"
+#include "Helpers/RadixSort.hpp"
 #include "Helpers/String.hpp"
 #include "Inputs/AxisButton.hpp"
 #include "Inputs/AxisCompound.hpp"
@@ -79,6 +83,7 @@
 #include "Maths/Matrix3.hpp"
 #include "Maths/Matrix4.hpp"
 #include "Maths/Quaternion.hpp"
+#include "Maths/Simd.hpp"
 #include "Maths/Timer.hpp"
 #include "Maths/Transform.hpp"
 #include "Maths/Vector2.hpp"
@@ -91,10 +96,11 @@
 #include "Maths/Visual/DriverSinwave.hpp"
 #include "Maths/Visual/DriverSlide.hpp"
 #include "Maths/Visual/IDriver.hpp"
+#include "Meshes/InstanceBatch.hpp"
 #include "Meshes/Mesh.hpp"
 #include "Meshes/MeshRender.hpp"
 #include "Meshes/RendererMeshes.hpp"
-#include "Models/IVertex.hpp"
+#include "Models/Baked/ModelBaked.hpp"
 #include "Models/Model.hpp"
 #include "Models/Obj/ModelObj.hpp"
 #include "Models/Shapes/MeshPattern.hpp"
@@ -105,9 +111,10 @@
 #include "Models/Shapes/ModelRectangle.hpp"
 #include "Models/Shapes/ModelSphere.hpp"
 #include "Models/VertexModel.hpp"
-#include "Models/VertexModelData.hpp"
 #include "Noise/Noise.hpp"
+#include "Objects/ComponentPool.hpp"
 #include "Objects/ComponentRegister.hpp"
+#include "Objects/ComponentTypes.hpp"
 #include "Objects/GameObject.hpp"
 #include "Objects/IBehaviour.hpp"
 #include "Objects/IComponent.hpp"
@@ -122,6 +129,7 @@
 #include "Particles/Spawns/SpawnLine.hpp"
 #include "Particles/Spawns/SpawnPoint.hpp"
 #include "Particles/Spawns/SpawnSphere.hpp"
+#include "Physics/Aabb.hpp"
 #include "Physics/Collider.hpp"
 #include "Physics/ColliderBox.hpp"
 #include "Physics/ColliderCapsule.hpp"
@@ -132,6 +140,7 @@
 #include "Physics/ColliderSphere.hpp"
 #include "Physics/Force.hpp"
 #include "Physics/Frustum.hpp"
+#include "Physics/FrustumCuller.hpp"
 #include "Physics/Ray.hpp"
 #include "Physics/Rigidbody.hpp"
 #include "Post/Deferred/RendererDeferred.hpp"
@@ -156,7 +165,9 @@
 #include "Post/Pipelines/PipelineGaussian.hpp"
 #include "Renderer/Buffers/Buffer.hpp"
 #include "Renderer/Buffers/IndexBuffer.hpp"
+#include "Renderer/Buffers/StorageBuffer.hpp"
 #include "Renderer/Buffers/UniformBuffer.hpp"
+#include "Renderer/Buffers/UniformRing.hpp"
 #include "Renderer/Buffers/VertexBuffer.hpp"
 #include "Renderer/Commands/CommandBuffer.hpp"
 #include "Renderer/Descriptors/DescriptorSet.hpp"
@@ -165,10 +176,14 @@
 #include "Renderer/Handlers/UniformHandler.hpp"
 #include "Renderer/IManagerRender.hpp"
 #include "Renderer/IRenderer.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
+#include "Renderer/Memory/RingAllocator.hpp"
+#include "Renderer/Memory/UploadManager.hpp"
 #include "Renderer/Pipelines/Compute.hpp"
 #include "Renderer/Pipelines/IPipeline.hpp"
 #include "Renderer/Pipelines/Pipeline.hpp"
 #include "Renderer/Pipelines/PipelineCreate.hpp"
+#include "Renderer/Pipelines/ShaderCache.hpp"
 #include "Renderer/Pipelines/ShaderProgram.hpp"
 #include "Renderer/Renderer.hpp"
 #include "Renderer/Renderpass/Renderpass.hpp"
@@ -179,12 +194,14 @@
 #include "Renderer/Swapchain/Swapchain.hpp"
 #include "Resources/IResource.hpp"
 #include "Resources/Resources.hpp"
+#include "Scenes/DynamicAabbTree.hpp"
 #include "Scenes/ICamera.hpp"
 #include "Scenes/IScene.hpp"
 #include "Scenes/ISpatialStructure.hpp"
 #include "Scenes/ScenePhysics.hpp"
 #include "Scenes/Scenes.hpp"
 #include "Scenes/SceneStructure.hpp"
+#include "Scenes/SceneTransforms.hpp"
 #include "Serialized/Metadata.hpp"
 #include "Shadows/RendererShadows.hpp"
 #include "Shadows/ShadowBox.hpp"
@@ -195,8 +212,9 @@
 #include "Textures/stb_image.h"
 #include "Textures/stb_image_write.h"
 #include "Textures/Texture.hpp"
-#include "Threads/Thread.hpp"
+#include "Threads/Job.hpp"
 #include "Threads/ThreadPool.hpp"
+#include "Threads/WorkStealingQueue.hpp"
 #include "Uis/UiBound.hpp"
 #include "Uis/UiInputButton.hpp"
 #include "Uis/UiInputDelay.hpp"
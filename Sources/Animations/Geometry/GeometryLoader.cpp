@@ -10,7 +10,7 @@ namespace acid
 		m_positionsList(std::vector<VertexAnimatedData *>()),
 		m_uvsList(std::vector<Vector2>()),
 		m_normalsList(std::vector<Vector3>()),
-		m_vertices(std::vector<IVertex *>()),
+		m_vertices(std::vector<VertexAnimated>()),
 		m_indices(std::vector<uint32_t>())
 	{
 		LoadVertices();
@@ -18,6 +18,7 @@ namespace acid
 		LoadNormals();
 		AssembleVertices();
 		RemoveUnusedVertices();
+		m_vertices.reserve(m_positionsList.size());
 
 		for (auto &current : m_positionsList)
 		{
@@ -30,8 +31,7 @@ namespace acid
 			Vector3 jointIds = Vector3(skinData.GetJointIds()[0], skinData.GetJointIds()[1], skinData.GetJointIds()[2]);
 			Vector3 weights = Vector3(skinData.GetWeights()[0], skinData.GetWeights()[1], skinData.GetWeights()[2]);
 
-			VertexAnimated *vertex = new VertexAnimated(position, textures, normal, tangent, jointIds, weights);
-			m_vertices.emplace_back(vertex);
+			m_vertices.emplace_back(position, textures, normal, tangent, jointIds, weights);
 
 			delete current;
 		}
@@ -18,16 +18,16 @@ namespace acid
 		std::vector<Vector2> m_uvsList;
 		std::vector<Vector3> m_normalsList;
 
-		std::vector<IVertex *> m_vertices;
+		std::vector<VertexAnimated> m_vertices;
 		std::vector<uint32_t> m_indices;
 	public:
 		GeometryLoader(const std::shared_ptr<Metadata> &libraryGeometries, const std::vector<VertexSkinData> &vertexWeights);
 
 		~GeometryLoader();
 
-		std::vector<IVertex *> GetVertices() const { return m_vertices; }
+		const std::vector<VertexAnimated> &GetVertices() const { return m_vertices; }
 
-		std::vector<uint32_t> GetIndices() const { return m_indices; }
+		const std::vector<uint32_t> &GetIndices() const { return m_indices; }
 	private:
 		void LoadVertices();
 
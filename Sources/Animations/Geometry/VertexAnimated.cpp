@@ -2,6 +2,8 @@
 
 namespace acid
 {
+	static_assert(sizeof(VertexAnimated) == 17 * sizeof(float), "VertexAnimated must be tightly packed to match its vertex input");
+
 	VertexAnimated::VertexAnimated(const Vector3 &position, const Vector2 &uv, const Vector3 &normal, const Vector3 &tangent, const Vector3 &jointId, const Vector3 &vertexWeight) :
 		m_position(position),
 		m_uv(uv),
@@ -26,22 +28,6 @@ namespace acid
 	{
 	}
 
-	void *VertexAnimated::GetData(std::vector<IVertex *> &vertices)
-	{
-		size_t dataSize = GetSize() * vertices.size();
-		void *data = new void *[dataSize];
-
-		auto thisVector = std::vector<VertexAnimated>();
-
-		for (auto &vertex : vertices)
-		{
-			thisVector.emplace_back(*((VertexAnimated *) vertex));
-		}
-
-		memcpy(data, thisVector.data(), dataSize);
-		return data;
-	}
-
 	VertexInput VertexAnimated::GetVertexInput()
 	{
 		std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
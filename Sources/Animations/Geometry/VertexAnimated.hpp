@@ -3,13 +3,11 @@
 #include <vector>
 #include "Maths/Vector2.hpp"
 #include "Maths/Vector3.hpp"
-#include "Models/IVertex.hpp"
 #include "Renderer/Pipelines/IPipeline.hpp"
 
 namespace acid
 {
-	class ACID_EXPORT VertexAnimated :
-		public IVertex
+	class ACID_EXPORT VertexAnimated
 	{
 	public:
 		Vector3 m_position;
@@ -25,13 +23,9 @@ namespace acid
 
 		~VertexAnimated();
 
-		Vector3 GetPosition() const override { return m_position; };
+		Vector3 GetPosition() const { return m_position; };
 
-		void SetPosition(const Vector3 &position) override { m_position = position; };
-
-		size_t GetSize() const override { return sizeof(VertexAnimated); }
-
-		void *GetData(std::vector<IVertex *> &vertices) override;
+		void SetPosition(const Vector3 &position) { m_position = position; };
 
 		static VertexInput GetVertexInput();
 	};
@@ -66,8 +66,8 @@ namespace acid
 		SkeletonLoader skeletonLoader = SkeletonLoader(file.GetParent()->FindChild("COLLADA")->FindChild("library_visual_scenes"), skinLoader.GetJointOrder());
 		GeometryLoader geometryLoader = GeometryLoader(file.GetParent()->FindChild("COLLADA")->FindChild("library_geometries"), skinLoader.GetVerticesSkinData());
 
-		auto vertices = geometryLoader.GetVertices();
-		auto indices = geometryLoader.GetIndices();
+		auto &vertices = geometryLoader.GetVertices();
+		auto &indices = geometryLoader.GetIndices();
 		m_model = std::make_shared<Model>(vertices, indices, filename);
 		m_headJoint = CreateJoints(*skeletonLoader.GetHeadJoint());
 		m_headJoint->CalculateInverseBindTransform(Matrix4::IDENTITY);
@@ -149,7 +149,8 @@ namespace acid
 		m_graphicsQueue(VK_NULL_HANDLE),
 		m_presentQueue(VK_NULL_HANDLE),
 		m_computeQueue(VK_NULL_HANDLE),
-		m_transferQueue(VK_NULL_HANDLE)
+		m_transferQueue(VK_NULL_HANDLE),
+		m_memoryAllocator(nullptr)
 	{
 		CreateGlfw();
 		SetupLayers();
@@ -161,6 +162,8 @@ namespace acid
 		CreateQueueIndices();
 		CreateLogicalDevice();
 
+		m_memoryAllocator = std::make_unique<MemoryAllocator>(m_logicalDevice, m_physicalDeviceMemoryProperties);
+
 		glslang::InitializeProcess();
 	}
 
@@ -175,6 +178,7 @@ namespace acid
 		glfwDestroyWindow(m_window);
 
 		// Destroys Vulkan.
+		m_memoryAllocator = nullptr;
 		vkDestroyDevice(m_logicalDevice, nullptr);
 		FvkDestroyDebugReportCallbackEXT(m_instance, m_debugReportCallback, nullptr);
 		vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
@@ -793,6 +797,21 @@ namespace acid
 			}
 		}
 
+		// Prefers a transfer only family, its copies run alongside graphics work.
+		for (uint32_t i = 0; i < deviceQueueFamilyPropertyCount; i++)
+		{
+			auto queueFlags = deviceQueueFamilyProperties[i].queueFlags;
+
+			if (deviceQueueFamilyProperties[i].queueCount > 0 && queueFlags & VK_QUEUE_TRANSFER_BIT &&
+				!(queueFlags & VK_QUEUE_GRAPHICS_BIT) && !(queueFlags & VK_QUEUE_COMPUTE_BIT))
+			{
+				transferFamily = i;
+				m_transferFamily = i;
+				m_supportedQueues |= VK_QUEUE_TRANSFER_BIT;
+				break;
+			}
+		}
+
 		if (graphicsFamily == -1)
 		{
 			throw std::runtime_error("Vulkan runtime error, failed to find queue family supporting VK_QUEUE_GRAPHICS_BIT!");
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
 #include "Engine/Engine.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 
 struct GLFWwindow;
 
@@ -67,6 +69,9 @@ namespace acid
 		VkQueue m_presentQueue;
 		VkQueue m_computeQueue;
 		VkQueue m_transferQueue;
+		std::mutex m_queueMutex;
+
+		std::unique_ptr<MemoryAllocator> m_memoryAllocator;
 
 		friend void CallbackError(int32_t error, const char *description);
 
@@ -268,6 +273,18 @@ namespace acid
 
 		VkQueue GetTransferQueue() const { return m_transferQueue; }
 
+		/// <summary>
+		/// Gets the mutex that must be held while submitting to, presenting on, or waiting on any device queue.
+		/// </summary>
+		/// <returns> The queue mutex. </returns>
+		std::mutex &GetQueueMutex() { return m_queueMutex; }
+
+		/// <summary>
+		/// Gets the allocator buffers and images take their device memory from.
+		/// </summary>
+		/// <returns> The memory allocator. </returns>
+		MemoryAllocator &GetMemoryAllocator() { return *m_memoryAllocator; }
+
 		uint32_t GetGraphicsFamily() const { return m_graphicsFamily; }
 
 		uint32_t GetPresentFamily() const { return m_presentFamily; }
@@ -9,6 +9,7 @@ namespace acid
 	Engine::Engine(const bool &emptyRegister) :
 		m_start(HighResolutionClock::now()),
 		m_timeOffset(0.0f),
+		m_threadPool(ThreadPool::HARDWARE_CONCURRENCY),
 		m_moduleRegister(ModuleRegister()),
 		m_moduleUpdater(ModuleUpdater()),
 		m_fpsLimit(-1.0f),
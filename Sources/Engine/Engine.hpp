@@ -4,6 +4,7 @@
 #include <memory>
 #include "ModuleRegister.hpp"
 #include "ModuleUpdater.hpp"
+#include "Threads/ThreadPool.hpp"
 
 /// <summary>
 /// The base Acid namespace.
@@ -24,6 +25,7 @@ namespace acid
 		std::chrono::time_point<HighResolutionClock> m_start;
 		float m_timeOffset;
 
+		ThreadPool m_threadPool;
 		ModuleRegister m_moduleRegister;
 		ModuleUpdater m_moduleUpdater;
 
@@ -78,6 +80,12 @@ namespace acid
 		template<typename T>
 		bool DeregisterModule() { return m_moduleRegister.DeregisterModule<T>(); }
 
+		/// <summary>
+		/// Gets the job system shared by the engine modules.
+		/// </summary>
+		/// <returns> The thread pool. </returns>
+		ThreadPool &GetThreadPool() { return m_threadPool; }
+
 		/// <summary>
 		/// Gets the added/removed time for the engine (seconds).
 		/// </summary>
@@ -102,6 +110,18 @@ namespace acid
 		/// <param name="fpsLimit"> The new fps limit. </param>
 		void SetFpsLimit(const float &fpsLimit) { m_fpsLimit = fpsLimit; }
 
+		/// <summary>
+		/// Gets if modules with no conflicting access are updated at the same time.
+		/// </summary>
+		/// <returns> If module updates run in parallel. </returns>
+		bool IsParallelUpdates() const { return m_moduleUpdater.IsParallel(); }
+
+		/// <summary>
+		/// Sets if modules with no conflicting access are updated at the same time, false gives a deterministic serial update order.
+		/// </summary>
+		/// <param name="parallel"> If module updates run in parallel. </param>
+		void SetParallelUpdates(const bool &parallel) { m_moduleUpdater.SetParallel(parallel); }
+
 		/// <summary>
 		/// Gets the delta (seconds) between updates.
 		/// </summary>
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include "Exports.hpp"
+#include "ModuleAccess.hpp"
 
 namespace acid
 {
@@ -26,5 +28,12 @@ namespace acid
 		/// The update function for the module.
 		/// </summary>
 		virtual void Update() = 0;
+
+		/// <summary>
+		/// Gets the modules this module reads and writes while updating, used to update independent modules in parallel.
+		/// Modules that do not declare their access are updated on the calling thread with no other module running.
+		/// </summary>
+		/// <returns> The modules access, or empty if undeclared. </returns>
+		virtual std::optional<ModuleAccess> GetAccess() const { return {}; }
 	};
 }
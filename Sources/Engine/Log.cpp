@@ -5,9 +5,11 @@
 namespace acid
 {
 	std::ostringstream Log::STREAM = std::ostringstream();
+	std::mutex Log::MUTEX;
 
 	void Log::CreateLog(const std::string &filename)
 	{
+		std::lock_guard<std::mutex> lock(MUTEX);
 		FileSystem::CreateFile(filename);
 		FileSystem::WriteTextFile(filename, STREAM.str());
 	}
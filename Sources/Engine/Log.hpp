@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include "Exports.hpp"
@@ -14,6 +15,7 @@ namespace acid
 	{
 	private:
 		static std::ostringstream STREAM;
+		static std::mutex MUTEX;
 	public:
 		/// <summary>
 		/// Outputs a message into the console.
@@ -23,6 +25,7 @@ namespace acid
 		template<typename... Args>
 		static void Out(const char *format, Args ... args)
 		{
+			std::lock_guard<std::mutex> lock(MUTEX);
 			fprintf(stdout, format, std::forward<Args>(args)...);
 			STREAM << StringFormat(format, std::forward<Args>(args)...);
 		}
@@ -35,6 +38,7 @@ namespace acid
 		template<typename... Args>
 		static void Error(const char *format, Args ... args)
 		{
+			std::lock_guard<std::mutex> lock(MUTEX);
 			fprintf(stderr, format, std::forward<Args>(args)...);
 			STREAM << StringFormat(format, std::forward<Args>(args)...);
 		}
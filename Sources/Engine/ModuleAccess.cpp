@@ -0,0 +1,42 @@
+#include "ModuleAccess.hpp"
+
+#include <algorithm>
+
+namespace acid
+{
+	ModuleAccess::ModuleAccess() :
+		m_reads(std::vector<std::type_index>()),
+		m_writes(std::vector<std::type_index>())
+	{
+	}
+
+	ModuleAccess::~ModuleAccess()
+	{
+	}
+
+	bool ModuleAccess::Conflicts(const ModuleAccess &other) const
+	{
+		auto contains = [](const std::vector<std::type_index> &types, const std::type_index &type)
+		{
+			return std::find(types.begin(), types.end(), type) != types.end();
+		};
+
+		for (auto &write : m_writes)
+		{
+			if (contains(other.m_reads, write) || contains(other.m_writes, write))
+			{
+				return true;
+			}
+		}
+
+		for (auto &write : other.m_writes)
+		{
+			if (contains(m_reads, write))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
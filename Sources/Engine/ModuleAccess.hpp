@@ -0,0 +1,58 @@
+#pragma once
+
+#include <typeindex>
+#include <vector>
+#include "Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Describes which modules a module reads from and writes to while updating.
+	/// Modules in the same update stage with no conflicting access can be updated at the same time.
+	/// </summary>
+	class ACID_EXPORT ModuleAccess
+	{
+	private:
+		std::vector<std::type_index> m_reads;
+		std::vector<std::type_index> m_writes;
+	public:
+		ModuleAccess();
+
+		~ModuleAccess();
+
+		/// <summary>
+		/// Declares that a module type is read from.
+		/// </summary>
+		/// <param name="T"> The module type. </param>
+		/// <returns> This access. </returns>
+		template<typename T>
+		ModuleAccess &Read()
+		{
+			m_reads.emplace_back(typeid(T));
+			return *this;
+		}
+
+		/// <summary>
+		/// Declares that a module type is written to.
+		/// </summary>
+		/// <param name="T"> The module type. </param>
+		/// <returns> This access. </returns>
+		template<typename T>
+		ModuleAccess &Write()
+		{
+			m_writes.emplace_back(typeid(T));
+			return *this;
+		}
+
+		/// <summary>
+		/// Gets if this access and another can not run at the same time, that is if either writes something the other touches.
+		/// </summary>
+		/// <param name="other"> The other access. </param>
+		/// <returns> If the accesses conflict. </returns>
+		bool Conflicts(const ModuleAccess &other) const;
+
+		const std::vector<std::type_index> &GetReads() const { return m_reads; }
+
+		const std::vector<std::type_index> &GetWrites() const { return m_writes; }
+	};
+}
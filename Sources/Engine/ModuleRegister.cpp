@@ -1,5 +1,6 @@
 #include "ModuleRegister.hpp"
 
+#include "Engine.hpp"
 #include "Log.hpp"
 #include "Audio/Audio.hpp"
 #include "Display/Display.hpp"
@@ -18,7 +19,9 @@
 namespace acid
 {
 	ModuleRegister::ModuleRegister() :
-		m_modules(std::map<float, std::shared_ptr<IModule>>())
+		m_modules(std::map<float, std::shared_ptr<IModule>>()),
+		m_stages(std::map<ModuleUpdate, std::vector<ModuleNode>>()),
+		m_stagesDirty(true)
 	{
 	}
 
@@ -53,6 +56,7 @@ namespace acid
 
 		float offset = update + (0.01f * static_cast<float>(m_modules.size()));
 		m_modules.emplace(offset, module);
+		m_stagesDirty = true;
 		return module;
 	}
 
@@ -79,20 +83,85 @@ namespace acid
 			}
 
 			m_modules.erase(it);
+			m_stagesDirty = true;
 			return true;
 		}
 
 		return false;
 	}
 
-	void ModuleRegister::RunUpdate(const ModuleUpdate &update) const
+	void ModuleRegister::RunUpdate(const ModuleUpdate &update, const bool &parallel) const
 	{
-		for (auto &module : m_modules)
+		if (!parallel)
+		{
+			for (auto &module : m_modules)
+			{
+				if (static_cast<int32_t>(std::floor(module.first)) == update)
+				{
+					module.second->Update();
+				}
+			}
+
+			return;
+		}
+
+		if (m_stagesDirty)
 		{
-			if (static_cast<int32_t>(std::floor(module.first)) == update)
+			BuildStages();
+		}
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		std::vector<std::pair<const ModuleAccess *, JobHandle>> running = {};
+
+		for (auto &node : m_stages[update])
+		{
+			// Undeclared modules act as a barrier and are updated on this thread.
+			if (!node.second)
+			{
+				for (auto &job : running)
+				{
+					threadPool.Wait(job.second);
+				}
+
+				running.clear();
+				node.first->Update();
+				continue;
+			}
+
+			// Conflicting modules keep their registration order by depending on the earlier module.
+			std::vector<JobHandle> dependencies = {};
+
+			for (auto &job : running)
 			{
-				module.second->Update();
+				if (job.first->Conflicts(*node.second))
+				{
+					dependencies.emplace_back(job.second);
+				}
 			}
+
+			auto module = node.first;
+			running.emplace_back(&(*node.second), threadPool.Enqueue([module]()
+			{
+				module->Update();
+			}, dependencies));
 		}
+
+		for (auto &job : running)
+		{
+			threadPool.Wait(job.second);
+		}
+	}
+
+	void ModuleRegister::BuildStages() const
+	{
+		m_stages.clear();
+
+		for (auto &module : m_modules)
+		{
+			auto update = static_cast<ModuleUpdate>(static_cast<int32_t>(std::floor(module.first)));
+			m_stages[update].emplace_back(module.second, module.second->GetAccess());
+		}
+
+		m_stagesDirty = false;
 	}
 }
@@ -2,6 +2,8 @@
 
 #include <map>
 #include <memory>
+#include <optional>
+#include <vector>
 #include "IModule.hpp"
 #include "Log.hpp"
 
@@ -13,7 +15,11 @@ namespace acid
 	class ACID_EXPORT ModuleRegister
 	{
 	private:
+		typedef std::pair<std::shared_ptr<IModule>, std::optional<ModuleAccess>> ModuleNode;
+
 		std::map<float, std::shared_ptr<IModule>> m_modules;
+		mutable std::map<ModuleUpdate, std::vector<ModuleNode>> m_stages;
+		mutable bool m_stagesDirty;
 	public:
 		/// <summary>
 		/// Creates a new module register.
@@ -111,8 +117,12 @@ namespace acid
 		/// Runs updates for all module update types.
 		/// </summary>
 		/// <param name="update"> The modules update type. </param>
-		void RunUpdate(const ModuleUpdate &update) const;
+		/// <param name="parallel"> If modules with no conflicting access will be updated at the same time on the engines thread pool,
+		/// otherwise modules are updated one after another in registration order. </param>
+		void RunUpdate(const ModuleUpdate &update, const bool &parallel = false) const;
 
 		uint32_t GetModuleCount() const { return static_cast<uint32_t>(m_modules.size()); }
+	private:
+		void BuildStages() const;
 	};
 }
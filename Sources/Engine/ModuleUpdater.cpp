@@ -9,7 +9,8 @@ namespace acid
 		m_deltaUpdate(Delta()),
 		m_deltaRender(Delta()),
 		m_timerUpdate(Timer(1.0f / 66.0f)),
-		m_timerRender(Timer(1.0f / -1.0f))
+		m_timerRender(Timer(1.0f / -1.0f)),
+		m_parallel(true)
 	{
 	}
 
@@ -22,7 +23,7 @@ namespace acid
 		m_timerRender.SetInterval(1.0f / Engine::Get()->GetFpsLimit());
 
 		// Always-Update.
-		moduleRegister.RunUpdate(UPDATE_ALWAYS);
+		moduleRegister.RunUpdate(UPDATE_ALWAYS, m_parallel);
 
 		if (m_timerUpdate.IsPassedTime())
 		{
@@ -30,13 +31,13 @@ namespace acid
 			m_timerUpdate.ResetStartTime();
 
 			// Pre-Update.
-			moduleRegister.RunUpdate(UPDATE_PRE);
+			moduleRegister.RunUpdate(UPDATE_PRE, m_parallel);
 
 			// Update.
-			moduleRegister.RunUpdate(UPDATE_NORMAL);
+			moduleRegister.RunUpdate(UPDATE_NORMAL, m_parallel);
 
 			// Post-Update.
-			moduleRegister.RunUpdate(UPDATE_POST);
+			moduleRegister.RunUpdate(UPDATE_POST, m_parallel);
 
 			// Updates the engines delta.
 			m_deltaUpdate.Update();
@@ -55,7 +56,7 @@ namespace acid
 			m_timerRender.ResetStartTime();
 
 			// Render
-			moduleRegister.RunUpdate(UPDATE_RENDER);
+			moduleRegister.RunUpdate(UPDATE_RENDER, m_parallel);
 
 			// Updates the render delta, and render time extension.
 			m_deltaRender.Update();
@@ -17,6 +17,7 @@ namespace acid
 		Delta m_deltaRender;
 		Timer m_timerUpdate;
 		Timer m_timerRender;
+		bool m_parallel;
 	public:
 		/// <summary>
 		/// Creates a new updater.
@@ -42,5 +43,17 @@ namespace acid
 		/// </summary>
 		/// <returns> The delta between renders. </returns>
 		float GetDeltaRender() const { return m_deltaRender.GetChange(); }
+
+		/// <summary>
+		/// Gets if modules with no conflicting access are updated at the same time.
+		/// </summary>
+		/// <returns> If updates run in parallel. </returns>
+		bool IsParallel() const { return m_parallel; }
+
+		/// <summary>
+		/// Sets if modules with no conflicting access are updated at the same time, otherwise modules update one after another in registration order.
+		/// </summary>
+		/// <param name="parallel"> If updates run in parallel. </param>
+		void SetParallel(const bool &parallel) { m_parallel = parallel; }
 	};
 }
\ No newline at end of file
@@ -27,6 +27,11 @@ namespace acid
 	{
 	}
 
+	std::optional<ModuleAccess> Files::GetAccess() const
+	{
+		return ModuleAccess().Write<Files>();
+	}
+
 	void Files::AddSearchPath(const std::string &path)
 	{
 		SEARCH_PATHS.emplace_back(path);
@@ -26,6 +26,8 @@ namespace acid
 
 		void Update() override;
 
+		std::optional<ModuleAccess> GetAccess() const override;
+
 		static std::vector<std::string> GetSearchPaths() { return SEARCH_PATHS; }
 
 		/// <summary>
@@ -1,10 +1,30 @@
 #include "FileJson.hpp"
 
+#include <algorithm>
 #include "Engine/Engine.hpp"
 #include "Helpers/FileSystem.hpp"
+#include "Helpers/MappedFile.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// Gets if a section is written as an array, sections read from arrays are, and so are built sections where every
+	/// child is unnamed.
+	/// </summary>
+	static bool IsArraySection(const Metadata &section)
+	{
+		if (section.IsArray())
+		{
+			return true;
+		}
+
+		auto children = section.GetChildren();
+		return !children.empty() && std::all_of(children.begin(), children.end(), [](const std::shared_ptr<Metadata> &child)
+		{
+			return child->GetName().empty();
+		});
+	}
+
 	FileJson::FileJson(const std::string &filename) :
 		IFile(),
 		m_filename(filename),
@@ -29,68 +49,23 @@ namespace acid
 		}
 
 		m_parent->ClearChildren();
+		m_parent->SetArray(false);
 
-		auto fileLoaded = FileSystem::ReadTextFile(m_filename);
+		MappedFile file = MappedFile(m_filename);
 
-		if (!fileLoaded)
+		if (!file.IsOpen())
 		{
+			Log::Error("Could not open Json file: '%s'\n", m_filename.c_str());
 			return;
 		}
 
-		JsonSection *currentSection = nullptr;
-		std::stringstream summation;
+		std::string error;
 
-		for (char &c : *fileLoaded)
+		if (!Read(std::string_view(file.GetData(), file.GetSize()), *m_parent, error))
 		{
-			if (c == '{' || c == '[')
-			{
-				if (currentSection == nullptr)
-				{
-					currentSection = new JsonSection(nullptr, "", "");
-					continue;
-				}
-
-				std::string name;
-
-				if (!summation.str().empty())
-				{
-					auto contentSplit = String::Split(summation.str(), "\"");
-
-					if (static_cast<int32_t>(contentSplit.size()) - 2 >= 0)
-					{
-						name = contentSplit.at(contentSplit.size() - 2);
-					}
-				}
-
-				currentSection->SetContent(currentSection->GetContent() + summation.str());
-				summation.str(std::string());
-
-				auto section = new JsonSection(currentSection, name, "");
-				currentSection->AddChild(section);
-				currentSection = section;
-			}
-			else if (c == '}' || c == ']')
-			{
-				currentSection->SetContent(currentSection->GetContent() + summation.str());
-				summation.str(std::string());
-
-				if (currentSection->GetParent() != nullptr)
-				{
-					currentSection = currentSection->GetParent();
-				}
-			}
-			else if (c == '\n')
-			{
-			}
-			else
-			{
-				summation << c;
-			}
+			Log::Error("Json '%s' is invalid: %s\n", m_filename.c_str(), error.c_str());
 		}
 
-		JsonSection::Convert(*currentSection, m_parent, true);
-		delete currentSection;
-
 #if ACID_VERBOSE
 		float debugEnd = Engine::Get()->GetTimeMs();
 		Log::Out("Json '%s' loaded in %fms\n", m_filename.c_str(), debugEnd - debugStart);
@@ -103,12 +78,21 @@ namespace acid
 		float debugStart = Engine::Get()->GetTimeMs();
 #endif
 
-		std::stringstream data;
-		JsonSection::AppendData(m_parent, data, 0);
-
 		Verify();
-		FileSystem::ClearFile(m_filename);
-		FileSystem::WriteTextFile(m_filename, data.str());
+		FILE *file = fopen(m_filename.c_str(), "wb");
+
+		if (file == nullptr)
+		{
+			Log::Error("Could not write Json file: '%s'\n", m_filename.c_str());
+			return;
+		}
+
+		{
+			JsonWriter writer = JsonWriter(file);
+			Write(*m_parent, writer);
+		}
+
+		fclose(file);
 
 #if ACID_VERBOSE
 		float debugEnd = Engine::Get()->GetTimeMs();
@@ -119,6 +103,121 @@ namespace acid
 	void FileJson::Clear()
 	{
 		m_parent->ClearChildren();
+		m_parent->SetArray(false);
+	}
+
+	bool FileJson::Read(const std::string_view &source, Metadata &parent, std::string &error)
+	{
+		JsonReader reader = JsonReader(source);
+		std::vector<Metadata *> sections = {};
+		std::string name;
+
+		// The root object or array is the parent itself.
+		auto token = reader.Next();
+
+		if (token != JsonToken::BeginObject && token != JsonToken::BeginArray)
+		{
+			error = token == JsonToken::Error ? reader.GetError() : "The root value must be an object or array";
+			return false;
+		}
+
+		parent.SetArray(token == JsonToken::BeginArray);
+		sections.emplace_back(&parent);
+
+		while (!sections.empty())
+		{
+			token = reader.Next();
+
+			switch (token)
+			{
+			case JsonToken::Name:
+				name = reader.GetString();
+				break;
+			case JsonToken::BeginObject:
+			case JsonToken::BeginArray:
+			{
+				auto section = sections.back()->AddChild(std::make_shared<Metadata>(name, ""));
+				section->SetArray(token == JsonToken::BeginArray);
+				sections.emplace_back(section.get());
+				name.clear();
+				break;
+			}
+			case JsonToken::EndObject:
+			case JsonToken::EndArray:
+				sections.pop_back();
+				break;
+			case JsonToken::String:
+				sections.back()->AddChild(std::make_shared<Metadata>(name, "\"" + reader.GetString() + "\""));
+				name.clear();
+				break;
+			case JsonToken::Number:
+			case JsonToken::Boolean:
+			case JsonToken::Null:
+				sections.back()->AddChild(std::make_shared<Metadata>(name, std::string(reader.GetView())));
+				name.clear();
+				break;
+			default:
+				error = token == JsonToken::Error ? reader.GetError() : "Unexpected end of file";
+				return false;
+			}
+		}
+
+		if (reader.Next() != JsonToken::End)
+		{
+			error = reader.GetToken() == JsonToken::Error ? reader.GetError() : "Unexpected text after the root value";
+			return false;
+		}
+
+		return true;
+	}
+
+	void FileJson::Write(const Metadata &source, JsonWriter &writer)
+	{
+		if (IsArraySection(source))
+		{
+			writer.BeginArray();
+			WriteChildren(source, writer);
+			writer.EndArray();
+		}
+		else
+		{
+			writer.BeginObject();
+			WriteChildren(source, writer);
+			writer.EndObject();
+		}
+	}
+
+	void FileJson::WriteChildren(const Metadata &source, JsonWriter &writer)
+	{
+		for (auto &child : source.GetChildren())
+		{
+			auto value = child->GetValue();
+
+			if (value.size() >= 2 && value.front() == '\"' && value.back() == '\"')
+			{
+				writer.String(child->GetName(), std::string_view(value).substr(1, value.size() - 2));
+				continue;
+			}
+
+			if (!value.empty())
+			{
+				writer.Raw(child->GetName(), value);
+				continue;
+			}
+
+			if (IsArraySection(*child))
+			{
+				writer.BeginArray(child->GetName());
+				WriteChildren(*child, writer);
+				writer.EndArray();
+			}
+			else
+			{
+				writer.BeginObject(child->GetName());
+				WriteChildren(*child, writer);
+				writer.EndObject();
+			}
+		}
 	}
 
 	void FileJson::Verify()
@@ -4,11 +4,16 @@
 #include <utility>
 #include <vector>
 #include "Files/IFile.hpp"
-#include "Helpers/String.hpp"
-#include "JsonSection.hpp"
+#include "Serialized/Metadata.hpp"
+#include "JsonReader.hpp"
+#include "JsonWriter.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// A JSON file that is read into and written from <seealso cref="Metadata"/>.
+	/// Strings are stored quoted as in the file, arrays become sections marked as arrays with unnamed children.
+	/// </summary>
 	class ACID_EXPORT FileJson :
 		public IFile
 	{
@@ -33,7 +38,25 @@ namespace acid
 		std::shared_ptr<Metadata> GetParent() const override { return m_parent; }
 
 		std::shared_ptr<Metadata> GetChild(const std::string &name) const { return m_parent->FindChild(name); }
+
+		/// <summary>
+		/// Reads JSON text into a metadata tree, the root value's children are added to the parent.
+		/// </summary>
+		/// <param name="source"> The JSON text. </param>
+		/// <param name="parent"> The metadata to add the children to. </param>
+		/// <param name="error"> Set to the reason parsing failed. </param>
+		/// <returns> If the text was valid JSON. </returns>
+		static bool Read(const std::string_view &source, Metadata &parent, std::string &error);
+
+		/// <summary>
+		/// Writes the children of a metadata tree as a JSON object, or as an array if it was read from one.
+		/// </summary>
+		/// <param name="source"> The metadata to write. </param>
+		/// <param name="writer"> The writer to write to. </param>
+		static void Write(const Metadata &source, JsonWriter &writer);
 	private:
+		static void WriteChildren(const Metadata &source, JsonWriter &writer);
+
 		void Verify();
 	};
 }
@@ -0,0 +1,477 @@
+#include "JsonReader.hpp"
+
+#include <algorithm>
+
+namespace acid
+{
+	static bool ParseHex(const std::string_view &view, const std::size_t &offset, uint32_t &code)
+	{
+		if (offset + 4 > view.size())
+		{
+			return false;
+		}
+
+		code = 0;
+
+		for (std::size_t i = offset; i < offset + 4; i++)
+		{
+			char c = view[i];
+			code <<= 4;
+
+			if (c >= '0' && c <= '9')
+			{
+				code |= static_cast<uint32_t>(c - '0');
+			}
+			else if (c >= 'a' && c <= 'f')
+			{
+				code |= static_cast<uint32_t>(c - 'a' + 10);
+			}
+			else if (c >= 'A' && c <= 'F')
+			{
+				code |= static_cast<uint32_t>(c - 'A' + 10);
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static void AppendUtf8(std::string &result, const uint32_t &code)
+	{
+		if (code < 0x80)
+		{
+			result += static_cast<char>(code);
+		}
+		else if (code < 0x800)
+		{
+			result += static_cast<char>(0xC0 | (code >> 6));
+			result += static_cast<char>(0x80 | (code & 0x3F));
+		}
+		else if (code < 0x10000)
+		{
+			result += static_cast<char>(0xE0 | (code >> 12));
+			result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (code & 0x3F));
+		}
+		else
+		{
+			result += static_cast<char>(0xF0 | (code >> 18));
+			result += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+			result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (code & 0x3F));
+		}
+	}
+
+	JsonReader::JsonReader(const std::string_view &source) :
+		m_source(source),
+		m_position(0),
+		m_scopes(std::vector<char>()),
+		m_state(State::Value),
+		m_token(JsonToken::None),
+		m_view(std::string_view()),
+		m_escaped(false),
+		m_error("")
+	{
+		// Skips a UTF-8 byte order mark.
+		if (m_source.size() >= 3 && m_source.compare(0, 3, "\xEF\xBB\xBF") == 0)
+		{
+			m_position = 3;
+		}
+	}
+
+	JsonToken JsonReader::Next()
+	{
+		if (m_token == JsonToken::End || m_token == JsonToken::Error)
+		{
+			return m_token;
+		}
+
+		SkipWhitespace();
+		m_view = std::string_view();
+		m_escaped = false;
+
+		if (m_position >= m_source.size())
+		{
+			if (m_scopes.empty() && m_state == State::Separator)
+			{
+				return m_token = JsonToken::End;
+			}
+
+			return SetError("Unexpected end of file");
+		}
+
+		char c = m_source[m_position];
+
+		switch (m_state)
+		{
+		case State::Separator:
+			if (m_scopes.empty())
+			{
+				return SetError("Unexpected text after the root value");
+			}
+
+			if (c == ',')
+			{
+				m_position++;
+				m_state = m_scopes.back() == '{' ? State::Name : State::Value;
+				return Next();
+			}
+
+			if (c == '}')
+			{
+				return Close('{', JsonToken::EndObject);
+			}
+
+			if (c == ']')
+			{
+				return Close('[', JsonToken::EndArray);
+			}
+
+			return SetError("Expected ',' or a closing bracket");
+		case State::NameOrClose:
+			if (c == '}')
+			{
+				return Close('{', JsonToken::EndObject);
+			}
+
+			[[fallthrough]];
+		case State::Name:
+			if (c != '"')
+			{
+				return SetError("Expected a name");
+			}
+
+			if (ReadString(JsonToken::Name) == JsonToken::Error)
+			{
+				return m_token;
+			}
+
+			SkipWhitespace();
+
+			if (m_position >= m_source.size() || m_source[m_position] != ':')
+			{
+				return SetError("Expected ':' after a name");
+			}
+
+			m_position++;
+			m_state = State::Value;
+			return m_token;
+		case State::ValueOrClose:
+			if (c == ']')
+			{
+				return Close('[', JsonToken::EndArray);
+			}
+
+			[[fallthrough]];
+		case State::Value:
+		default:
+			return ReadValue();
+		}
+	}
+
+	void JsonReader::Skip()
+	{
+		if (m_token != JsonToken::BeginObject && m_token != JsonToken::BeginArray)
+		{
+			return;
+		}
+
+		std::size_t depth = m_scopes.size();
+
+		while (m_scopes.size() >= depth)
+		{
+			auto token = Next();
+
+			if (token == JsonToken::End || token == JsonToken::Error)
+			{
+				return;
+			}
+		}
+	}
+
+	std::string JsonReader::GetString() const
+	{
+		if (m_escaped)
+		{
+			return Unescape(m_view);
+		}
+
+		return std::string(m_view);
+	}
+
+	uint32_t JsonReader::GetLine() const
+	{
+		auto end = m_source.begin() + std::min(m_position, m_source.size());
+		return static_cast<uint32_t>(std::count(m_source.begin(), end, '\n')) + 1;
+	}
+
+	std::string JsonReader::Unescape(const std::string_view &view)
+	{
+		std::string result;
+		result.reserve(view.size());
+
+		for (std::size_t i = 0; i < view.size(); i++)
+		{
+			if (view[i] != '\\' || i + 1 >= view.size())
+			{
+				result += view[i];
+				continue;
+			}
+
+			switch (view[++i])
+			{
+			case 'b':
+				result += '\b';
+				break;
+			case 'f':
+				result += '\f';
+				break;
+			case 'n':
+				result += '\n';
+				break;
+			case 'r':
+				result += '\r';
+				break;
+			case 't':
+				result += '\t';
+				break;
+			case 'u':
+			{
+				uint32_t code = 0;
+
+				if (!ParseHex(view, i + 1, code))
+				{
+					result += 'u';
+					break;
+				}
+
+				i += 4;
+
+				// A high surrogate followed by a low surrogate encodes one code point above the basic plane.
+				uint32_t low = 0;
+
+				if (code >= 0xD800 && code <= 0xDBFF && i + 6 < view.size() && view[i + 1] == '\\' && view[i + 2] == 'u' &&
+					ParseHex(view, i + 3, low) && low >= 0xDC00 && low <= 0xDFFF)
+				{
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+					i += 6;
+				}
+
+				AppendUtf8(result, code);
+				break;
+			}
+			default:
+				result += view[i];
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	void JsonReader::SkipWhitespace()
+	{
+		while (m_position < m_source.size())
+		{
+			char c = m_source[m_position];
+
+			if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			{
+				return;
+			}
+
+			m_position++;
+		}
+	}
+
+	JsonToken JsonReader::ReadValue()
+	{
+		char c = m_source[m_position];
+
+		switch (c)
+		{
+		case '{':
+			m_view = m_source.substr(m_position++, 1);
+			m_scopes.emplace_back('{');
+			m_state = State::NameOrClose;
+			return m_token = JsonToken::BeginObject;
+		case '[':
+			m_view = m_source.substr(m_position++, 1);
+			m_scopes.emplace_back('[');
+			m_state = State::ValueOrClose;
+			return m_token = JsonToken::BeginArray;
+		case '"':
+			m_state = State::Separator;
+			return ReadString(JsonToken::String);
+		case 't':
+			return ReadLiteral("true", JsonToken::Boolean);
+		case 'f':
+			return ReadLiteral("false", JsonToken::Boolean);
+		case 'n':
+			return ReadLiteral("null", JsonToken::Null);
+		default:
+			if (c == '-' || (c >= '0' && c <= '9'))
+			{
+				return ReadNumber();
+			}
+
+			return SetError("Unexpected character");
+		}
+	}
+
+	JsonToken JsonReader::ReadString(const JsonToken &token)
+	{
+		std::size_t start = ++m_position;
+
+		while (m_position < m_source.size())
+		{
+			char c = m_source[m_position];
+
+			if (c == '"')
+			{
+				m_view = m_source.substr(start, m_position - start);
+				m_position++;
+				return m_token = token;
+			}
+
+			if (c == '\\')
+			{
+				if (m_position + 1 >= m_source.size())
+				{
+					break;
+				}
+
+				char escape = m_source[m_position + 1];
+				uint32_t code = 0;
+
+				if (escape == 'u' && !ParseHex(m_source, m_position + 2, code))
+				{
+					return SetError("Invalid unicode escape");
+				}
+
+				if (std::string_view("\"\\/bfnrtu").find(escape) == std::string_view::npos)
+				{
+					return SetError("Invalid escape sequence");
+				}
+
+				m_escaped = true;
+				m_position += escape == 'u' ? 6 : 2;
+				continue;
+			}
+
+			if (static_cast<unsigned char>(c) < 0x20)
+			{
+				return SetError("Control character in string");
+			}
+
+			m_position++;
+		}
+
+		return SetError("Unterminated string");
+	}
+
+	JsonToken JsonReader::ReadNumber()
+	{
+		auto isDigit = [this]()
+		{
+			return m_position < m_source.size() && m_source[m_position] >= '0' && m_source[m_position] <= '9';
+		};
+
+		std::size_t start = m_position;
+
+		if (m_source[m_position] == '-')
+		{
+			m_position++;
+		}
+
+		if (m_position < m_source.size() && m_source[m_position] == '0')
+		{
+			m_position++;
+		}
+		else if (isDigit())
+		{
+			while (isDigit())
+			{
+				m_position++;
+			}
+		}
+		else
+		{
+			return SetError("Invalid number");
+		}
+
+		if (m_position < m_source.size() && m_source[m_position] == '.')
+		{
+			m_position++;
+
+			if (!isDigit())
+			{
+				return SetError("Invalid number fraction");
+			}
+
+			while (isDigit())
+			{
+				m_position++;
+			}
+		}
+
+		if (m_position < m_source.size() && (m_source[m_position] == 'e' || m_source[m_position] == 'E'))
+		{
+			m_position++;
+
+			if (m_position < m_source.size() && (m_source[m_position] == '+' || m_source[m_position] == '-'))
+			{
+				m_position++;
+			}
+
+			if (!isDigit())
+			{
+				return SetError("Invalid number exponent");
+			}
+
+			while (isDigit())
+			{
+				m_position++;
+			}
+		}
+
+		m_view = m_source.substr(start, m_position - start);
+		m_state = State::Separator;
+		return m_token = JsonToken::Number;
+	}
+
+	JsonToken JsonReader::ReadLiteral(const std::string_view &literal, const JsonToken &token)
+	{
+		if (m_source.compare(m_position, literal.size(), literal) != 0)
+		{
+			return SetError("Unexpected character");
+		}
+
+		m_view = m_source.substr(m_position, literal.size());
+		m_position += literal.size();
+		m_state = State::Separator;
+		return m_token = token;
+	}
+
+	JsonToken JsonReader::Close(const char &scope, const JsonToken &token)
+	{
+		if (m_scopes.empty() || m_scopes.back() != scope)
+		{
+			return SetError("Mismatched closing bracket");
+		}
+
+		m_scopes.pop_back();
+		m_view = m_source.substr(m_position++, 1);
+		m_state = State::Separator;
+		return m_token = token;
+	}
+
+	JsonToken JsonReader::SetError(const std::string &error)
+	{
+		m_error = error + " on line " + std::to_string(GetLine());
+		return m_token = JsonToken::Error;
+	}
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	enum class JsonToken
+	{
+		None,
+		BeginObject,
+		EndObject,
+		BeginArray,
+		EndArray,
+		Name,
+		String,
+		Number,
+		Boolean,
+		Null,
+		End,
+		Error
+	};
+
+	/// <summary>
+	/// A single pass pull parser over JSON text. Tokens are read one at a time with <seealso cref="#Next()"/>,
+	/// names and values are views into the source so nothing is copied until a string is unescaped.
+	/// </summary>
+	class ACID_EXPORT JsonReader
+	{
+	private:
+		enum class State
+		{
+			Value,
+			ValueOrClose,
+			Name,
+			NameOrClose,
+			Separator
+		};
+
+		std::string_view m_source;
+		std::size_t m_position;
+		std::vector<char> m_scopes;
+		State m_state;
+		JsonToken m_token;
+		std::string_view m_view;
+		bool m_escaped;
+		std::string m_error;
+	public:
+		/// <summary>
+		/// Creates a new reader, the source must outlive the reader and any views it returns.
+		/// </summary>
+		/// <param name="source"> The JSON text. </param>
+		explicit JsonReader(const std::string_view &source);
+
+		/// <summary>
+		/// Reads the next token.
+		/// </summary>
+		/// <returns> The token read, <seealso cref="JsonToken#End"/> after the last value or <seealso cref="JsonToken#Error"/> if the text is invalid. </returns>
+		JsonToken Next();
+
+		/// <summary>
+		/// Skips the rest of the object or array that was just opened, or does nothing if the current token is not a begin token.
+		/// </summary>
+		void Skip();
+
+		JsonToken GetToken() const { return m_token; }
+
+		/// <summary>
+		/// Gets the raw text of the current token, for names and strings this is the text between the quotes before unescaping.
+		/// </summary>
+		/// <returns> The token text. </returns>
+		std::string_view GetView() const { return m_view; }
+
+		/// <summary>
+		/// Gets the current token as a string, names and strings are unescaped.
+		/// </summary>
+		/// <returns> The token string. </returns>
+		std::string GetString() const;
+
+		/// <summary>
+		/// Gets how many objects and arrays the reader is inside of.
+		/// </summary>
+		/// <returns> The current depth. </returns>
+		uint32_t GetDepth() const { return static_cast<uint32_t>(m_scopes.size()); }
+
+		/// <summary>
+		/// Gets the line the reader is at, counted from one.
+		/// </summary>
+		/// <returns> The current line. </returns>
+		uint32_t GetLine() const;
+
+		const std::string &GetError() const { return m_error; }
+
+		/// <summary>
+		/// Decodes the escape sequences in a JSON string, \u escapes are written as UTF-8.
+		/// </summary>
+		/// <param name="view"> The string without quotes. </param>
+		/// <returns> The unescaped string. </returns>
+		static std::string Unescape(const std::string_view &view);
+	private:
+		void SkipWhitespace();
+
+		JsonToken ReadValue();
+
+		JsonToken ReadString(const JsonToken &token);
+
+		JsonToken ReadNumber();
+
+		JsonToken ReadLiteral(const std::string_view &literal, const JsonToken &token);
+
+		JsonToken Close(const char &scope, const JsonToken &token);
+
+		JsonToken SetError(const std::string &error);
+	};
+}
@@ -0,0 +1,184 @@
+#include "JsonWriter.hpp"
+
+namespace acid
+{
+	const std::size_t JsonWriter::BUFFER_SIZE = 64 * 1024;
+
+	JsonWriter::JsonWriter(FILE *file) :
+		m_file(file),
+		m_buffer(std::string()),
+		m_scopeArrays(std::vector<bool>()),
+		m_scopeEmpty(std::vector<bool>())
+	{
+		m_buffer.reserve(BUFFER_SIZE);
+	}
+
+	JsonWriter::~JsonWriter()
+	{
+		Flush();
+	}
+
+	void JsonWriter::BeginObject(const std::string_view &name)
+	{
+		WritePrefix(name);
+		Write("{");
+		m_scopeArrays.emplace_back(false);
+		m_scopeEmpty.emplace_back(true);
+	}
+
+	void JsonWriter::EndObject()
+	{
+		WriteClose('}');
+	}
+
+	void JsonWriter::BeginArray(const std::string_view &name)
+	{
+		WritePrefix(name);
+		Write("[");
+		m_scopeArrays.emplace_back(true);
+		m_scopeEmpty.emplace_back(true);
+	}
+
+	void JsonWriter::EndArray()
+	{
+		WriteClose(']');
+	}
+
+	void JsonWriter::String(const std::string_view &name, const std::string_view &value)
+	{
+		WritePrefix(name);
+		Write("\"");
+		WriteEscaped(value);
+		Write("\"");
+	}
+
+	void JsonWriter::Raw(const std::string_view &name, const std::string_view &value)
+	{
+		WritePrefix(name);
+		Write(value);
+	}
+
+	void JsonWriter::Flush()
+	{
+		if (m_file != nullptr && !m_buffer.empty())
+		{
+			fwrite(m_buffer.data(), sizeof(char), m_buffer.size(), m_file);
+		}
+
+		m_buffer.clear();
+	}
+
+	void JsonWriter::WritePrefix(const std::string_view &name)
+	{
+		if (m_scopeEmpty.empty())
+		{
+			return;
+		}
+
+		if (!m_scopeEmpty.back())
+		{
+			Write(",");
+		}
+
+		m_scopeEmpty.back() = false;
+		Write("\n");
+		WriteIndent();
+
+		if (!m_scopeArrays.back())
+		{
+			Write("\"");
+			WriteEscaped(name);
+			Write("\": ");
+		}
+	}
+
+	void JsonWriter::WriteClose(const char &bracket)
+	{
+		bool empty = m_scopeEmpty.back();
+		m_scopeArrays.pop_back();
+		m_scopeEmpty.pop_back();
+
+		if (!empty)
+		{
+			Write("\n");
+			WriteIndent();
+		}
+
+		Write(std::string_view(&bracket, 1));
+
+		if (m_scopeEmpty.empty())
+		{
+			Write("\n");
+		}
+	}
+
+	void JsonWriter::WriteIndent()
+	{
+		for (std::size_t i = 0; i < m_scopeEmpty.size(); i++)
+		{
+			Write("  ");
+		}
+	}
+
+	void JsonWriter::WriteEscaped(const std::string_view &value)
+	{
+		static const char *HEX = "0123456789abcdef";
+		std::size_t start = 0;
+
+		for (std::size_t i = 0; i < value.size(); i++)
+		{
+			auto c = static_cast<unsigned char>(value[i]);
+
+			if (c != '"' && c != '\\' && c >= 0x20)
+			{
+				continue;
+			}
+
+			Write(value.substr(start, i - start));
+			start = i + 1;
+
+			switch (c)
+			{
+			case '"':
+				Write("\\\"");
+				break;
+			case '\\':
+				Write("\\\\");
+				break;
+			case '\b':
+				Write("\\b");
+				break;
+			case '\f':
+				Write("\\f");
+				break;
+			case '\n':
+				Write("\\n");
+				break;
+			case '\r':
+				Write("\\r");
+				break;
+			case '\t':
+				Write("\\t");
+				break;
+			default:
+			{
+				char escape[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+				Write(std::string_view(escape, 6));
+				break;
+			}
+			}
+		}
+
+		Write(value.substr(start));
+	}
+
+	void JsonWriter::Write(const std::string_view &text)
+	{
+		if (m_buffer.size() + text.size() > BUFFER_SIZE)
+		{
+			Flush();
+		}
+
+		m_buffer.append(text.data(), text.size());
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Writes indented JSON straight to a file through a fixed size buffer, commas and indentation are inserted automatically.
+	/// Names are ignored inside of arrays.
+	/// </summary>
+	class ACID_EXPORT JsonWriter
+	{
+	private:
+		static const std::size_t BUFFER_SIZE;
+
+		FILE *m_file;
+		std::string m_buffer;
+		std::vector<bool> m_scopeArrays;
+		std::vector<bool> m_scopeEmpty;
+	public:
+		/// <summary>
+		/// Creates a new writer.
+		/// </summary>
+		/// <param name="file"> The file to write to, it is not closed by the writer. </param>
+		explicit JsonWriter(FILE *file);
+
+		~JsonWriter();
+
+		void BeginObject(const std::string_view &name = "");
+
+		void EndObject();
+
+		void BeginArray(const std::string_view &name = "");
+
+		void EndArray();
+
+		/// <summary>
+		/// Writes a string value, the string is escaped and quoted.
+		/// </summary>
+		/// <param name="name"> The value name. </param>
+		/// <param name="value"> The unescaped string. </param>
+		void String(const std::string_view &name, const std::string_view &value);
+
+		/// <summary>
+		/// Writes a value as is, used for numbers, booleans and null.
+		/// </summary>
+		/// <param name="name"> The value name. </param>
+		/// <param name="value"> The raw value. </param>
+		void Raw(const std::string_view &name, const std::string_view &value);
+
+		/// <summary>
+		/// Writes the buffered text to the file.
+		/// </summary>
+		void Flush();
+	private:
+		void WritePrefix(const std::string_view &name);
+
+		void WriteClose(const char &bracket);
+
+		void WriteIndent();
+
+		void WriteEscaped(const std::string_view &value);
+
+		void Write(const std::string_view &text);
+	};
+}
@@ -252,9 +252,9 @@ namespace acid
 		lines.emplace_back(currentLine);
 	}
 
-	std::vector<IVertex *> Text::CreateQuad(const std::vector<FontLine> &lines)
+	std::vector<VertexModel> Text::CreateQuad(const std::vector<FontLine> &lines)
 	{
-		auto vertices = std::vector<IVertex *>();
+		auto vertices = std::vector<VertexModel>();
 		m_numberLines = static_cast<uint32_t>(lines.size());
 
 		float cursorX = 0.0f;
@@ -304,7 +304,7 @@ namespace acid
 		return vertices;
 	}
 
-	void Text::AddVerticesForCharacter(const float &cursorX, const float &cursorY, const FontCharacter &character, std::vector<IVertex *> &vertices)
+	void Text::AddVerticesForCharacter(const float &cursorX, const float &cursorY, const FontCharacter &character, std::vector<VertexModel> &vertices)
 	{
 		float vertexX = cursorX + character.GetOffsetX();
 		float vertexY = cursorY + character.GetOffsetY();
@@ -324,13 +324,12 @@ namespace acid
 		AddVertex(vertexX, vertexY, textureX, textureY, vertices);
 	}
 
-	void Text::AddVertex(const float &vx, const float &vy, const float &tx, const float &ty, std::vector<IVertex *> &vertices)
+	void Text::AddVertex(const float &vx, const float &vy, const float &tx, const float &ty, std::vector<VertexModel> &vertices)
 	{
-		IVertex *vertex = new VertexModel(Vector3(static_cast<float>(vx), static_cast<float>(vy), 0.0f), Vector2(static_cast<float>(tx), static_cast<float>(ty)));
-		vertices.emplace_back(vertex);
+		vertices.emplace_back(Vector3(vx, vy, 0.0f), Vector2(tx, ty));
 	}
 
-	void Text::NormalizeQuad(Vector2 &bounding, std::vector<IVertex *> &vertices)
+	void Text::NormalizeQuad(Vector2 &bounding, std::vector<VertexModel> &vertices)
 	{
 		float minX = +INFINITY;
 		float minY = +INFINITY;
@@ -339,7 +338,7 @@ namespace acid
 
 		for (auto &vertex : vertices)
 		{
-			Vector3 position = vertex->GetPosition();
+			Vector3 position = vertex.m_position;
 
 			if (position.m_x < minX)
 			{
@@ -371,8 +370,7 @@ namespace acid
 
 		for (auto &vertex : vertices)
 		{
-			Vector3 position = Vector3((vertex->GetPosition().m_x - minX) / (maxX - minX), (vertex->GetPosition().m_y - minY) / (maxY - minY), 0.0f);
-			vertex->SetPosition(position);
+			vertex.m_position = Vector3((vertex.m_position.m_x - minX) / (maxX - minX), (vertex.m_position.m_y - minY) / (maxY - minY), 0.0f);
 		}
 	}
 }
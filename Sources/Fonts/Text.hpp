@@ -256,12 +256,12 @@ namespace acid
 
 		void CompleteStructure(std::vector<FontLine> &lines, FontLine &currentLine, const FontWord &currentWord);
 
-		std::vector<IVertex *> CreateQuad(const std::vector<FontLine> &lines);
+		std::vector<VertexModel> CreateQuad(const std::vector<FontLine> &lines);
 
-		void AddVerticesForCharacter(const float &cursorX, const float &cursorY, const FontCharacter &character, std::vector<IVertex *> &vertices);
+		void AddVerticesForCharacter(const float &cursorX, const float &cursorY, const FontCharacter &character, std::vector<VertexModel> &vertices);
 
-		void AddVertex(const float &vx, const float &vy, const float &tx, const float &ty, std::vector<IVertex *> &vertices);
+		void AddVertex(const float &vx, const float &vy, const float &tx, const float &ty, std::vector<VertexModel> &vertices);
 
-		void NormalizeQuad(Vector2 &bounding, std::vector<IVertex *> &vertices);
+		void NormalizeQuad(Vector2 &bounding, std::vector<VertexModel> &vertices);
 	};
 }
@@ -4,6 +4,10 @@
 #include <algorithm>
 #ifdef ACID_BUILD_WINDOWS
 #include <direct.h>
+#include <windows.h>
+// The Windows API macros would rename the helpers of the same name.
+#undef CreateFile
+#undef DeleteFile
 #define GetCurrentDir _getcwd
 #else
 #include <sys/stat.h>
@@ -35,6 +39,16 @@ namespace acid
 		return false;
 	}
 
+	bool FileSystem::RenameFile(const std::string &source, const std::string &destination)
+	{
+#ifdef ACID_BUILD_WINDOWS
+		return MoveFileExA(source.c_str(), destination.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+		// Rename replaces the destination atomically, so it is never missing.
+		return rename(source.c_str(), destination.c_str()) == 0;
+#endif
+	}
+
 	bool FileSystem::CreateFile(const std::string &filepath, const bool &createFolders)
 	{
 		if (FileExists(filepath))
@@ -67,6 +81,13 @@ namespace acid
 
 	bool FileSystem::CreateFolder(const std::string &path)
 	{
+		auto parentEnd = path.find_last_of("\\/");
+
+		if (parentEnd != std::string::npos && parentEnd != 0)
+		{
+			CreateFolder(path.substr(0, parentEnd));
+		}
+
 		int32_t nError = 0;
 
 #ifdef ACID_BUILD_WINDOWS
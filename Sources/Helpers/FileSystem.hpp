@@ -29,6 +29,14 @@ namespace acid
 		/// <returns> If the file was deleted. </returns>
 		static bool DeleteFile(const std::string &filepath);
 
+		/// <summary>
+		/// Renames a file, replacing the destination if it exists without a moment where neither file is there.
+		/// </summary>
+		/// <param name="source"> The file to rename. </param>
+		/// <param name="destination"> The new filepath. </param>
+		/// <returns> If the file was renamed. </returns>
+		static bool RenameFile(const std::string &source, const std::string &destination);
+
 		/// <summary>
 		/// Creates a file, and the folder path.
 		/// </summary>
@@ -45,7 +53,7 @@ namespace acid
 		static bool ClearFile(const std::string &filepath);
 
 		/// <summary>
-		/// Creates a directory.
+		/// Creates a directory, any missing parent directories are created first.
 		/// </summary>
 		/// <param name="path"> The directory to create. </param>
 		/// <returns> If the folder was created. </returns>
@@ -0,0 +1,122 @@
+#include "MappedFile.hpp"
+
+#ifdef ACID_BUILD_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "Engine/Log.hpp"
+
+namespace acid
+{
+	MappedFile::MappedFile(const std::string &filepath) :
+		m_data(nullptr),
+		m_size(0),
+		m_open(false),
+#ifdef ACID_BUILD_WINDOWS
+		m_file(INVALID_HANDLE_VALUE),
+		m_mapping(nullptr)
+#else
+		m_file(-1)
+#endif
+	{
+#ifdef ACID_BUILD_WINDOWS
+		m_file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (m_file == INVALID_HANDLE_VALUE)
+		{
+			Log::Error("Could not open file: '%s'\n", filepath.c_str());
+			return;
+		}
+
+		LARGE_INTEGER size;
+		GetFileSizeEx(m_file, &size);
+		m_size = static_cast<std::size_t>(size.QuadPart);
+		m_open = true;
+
+		if (m_size == 0)
+		{
+			return;
+		}
+
+		m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (m_mapping == nullptr)
+		{
+			Log::Error("Could not map file: '%s'\n", filepath.c_str());
+			m_open = false;
+			return;
+		}
+
+		m_data = static_cast<const char *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		m_file = open(filepath.c_str(), O_RDONLY);
+
+		if (m_file == -1)
+		{
+			Log::Error("Could not open file: '%s'\n", filepath.c_str());
+			return;
+		}
+
+		struct stat status = {};
+		fstat(m_file, &status);
+		m_size = static_cast<std::size_t>(status.st_size);
+		m_open = true;
+
+		if (m_size == 0)
+		{
+			return;
+		}
+
+		void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+
+		if (data == MAP_FAILED)
+		{
+			Log::Error("Could not map file: '%s'\n", filepath.c_str());
+			m_open = false;
+			return;
+		}
+
+		madvise(data, m_size, MADV_SEQUENTIAL);
+		m_data = static_cast<const char *>(data);
+#endif
+
+		if (m_data == nullptr)
+		{
+			m_open = false;
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+#ifdef ACID_BUILD_WINDOWS
+		if (m_data != nullptr)
+		{
+			UnmapViewOfFile(m_data);
+		}
+
+		if (m_mapping != nullptr)
+		{
+			CloseHandle(m_mapping);
+		}
+
+		if (m_file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(m_file);
+		}
+#else
+		if (m_data != nullptr)
+		{
+			munmap(const_cast<char *>(m_data), m_size);
+		}
+
+		if (m_file != -1)
+		{
+			close(m_file);
+		}
+#endif
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A read only view of a file mapped into memory, the file stays mapped for the lifetime of this object.
+	/// </summary>
+	class ACID_EXPORT MappedFile
+	{
+	private:
+		const char *m_data;
+		std::size_t m_size;
+		bool m_open;
+#ifdef ACID_BUILD_WINDOWS
+		void *m_file;
+		void *m_mapping;
+#else
+		int32_t m_file;
+#endif
+	public:
+		/// <summary>
+		/// Maps a file into memory.
+		/// </summary>
+		/// <param name="filepath"> The filepath. </param>
+		explicit MappedFile(const std::string &filepath);
+
+		MappedFile(const MappedFile &) = delete;
+
+		MappedFile &operator=(const MappedFile &) = delete;
+
+		~MappedFile();
+
+		/// <summary>
+		/// Gets if the file was opened and mapped, a empty file is open with no data.
+		/// </summary>
+		/// <returns> If the file is open. </returns>
+		bool IsOpen() const { return m_open; }
+
+		const char *GetData() const { return m_data; }
+
+		std::size_t GetSize() const { return m_size; }
+	};
+}
@@ -0,0 +1,59 @@
+#include "RadixSort.hpp"
+
+#include <array>
+
+namespace acid
+{
+	std::vector<uint32_t> RadixSort::SortIndices(const std::vector<uint64_t> &keys)
+	{
+		auto count = static_cast<uint32_t>(keys.size());
+		std::vector<uint32_t> indices(count);
+		std::vector<uint32_t> swap(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			indices[i] = i;
+		}
+
+		// Counts every byte in one pass over the keys.
+		std::array<std::array<uint32_t, 256>, 8> histograms = {};
+
+		for (auto &key : keys)
+		{
+			for (uint32_t pass = 0; pass < 8; pass++)
+			{
+				histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+			}
+		}
+
+		for (uint32_t pass = 0; pass < 8; pass++)
+		{
+			auto &histogram = histograms[pass];
+			uint32_t shift = pass * 8;
+
+			// A byte shared by every key would not reorder anything.
+			if (count == 0 || histogram[(keys[indices[0]] >> shift) & 0xFF] == count)
+			{
+				continue;
+			}
+
+			uint32_t offset = 0;
+
+			for (auto &bucket : histogram)
+			{
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (auto &index : indices)
+			{
+				swap[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+			}
+
+			indices.swap(swap);
+		}
+
+		return indices;
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A helper for sorting by integer keys in linear time.
+	/// </summary>
+	class ACID_EXPORT RadixSort
+	{
+	public:
+		/// <summary>
+		/// Sorts 64 bit keys least significant byte first, the sort is stable. Bytes that are equal in every key are skipped.
+		/// </summary>
+		/// <param name="keys"> The keys to sort. </param>
+		/// <returns> The indices of the keys in ascending key order. </returns>
+		static std::vector<uint32_t> SortIndices(const std::vector<uint64_t> &keys);
+	};
+}
@@ -42,6 +42,11 @@ namespace acid
 	{
 	}
 
+	std::optional<ModuleAccess> Keyboard::GetAccess() const
+	{
+		return ModuleAccess().Write<Keyboard>();
+	}
+
 	bool Keyboard::GetKey(const Key &key) const
 	{
 		if (key < 0 || key > KEY_END_RANGE)
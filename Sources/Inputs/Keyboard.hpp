@@ -162,6 +162,8 @@ namespace acid
 
 		void Update() override;
 
+		std::optional<ModuleAccess> GetAccess() const override;
+
 		/// <summary>
 		/// Gets whether or not a particular key is currently pressed.
 		/// <p>Actions: WSI_ACTION_PRESS, WSI_ACTION_RELEASE, WSI_ACTION_REPEAT</p>
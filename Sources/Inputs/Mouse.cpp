@@ -86,6 +86,11 @@ namespace acid
 		}
 	}
 
+	std::optional<ModuleAccess> Mouse::GetAccess() const
+	{
+		return ModuleAccess().Write<Mouse>();
+	}
+
 	void Mouse::SetCustomMouse(const std::string &filename)
 	{
 		// Loads a custom cursor.
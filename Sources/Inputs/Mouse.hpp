@@ -68,6 +68,8 @@ namespace acid
 
 		void Update() override;
 
+		std::optional<ModuleAccess> GetAccess() const override;
+
 		/// <summary>
 		/// Sets if the operating systems cursor is hidden whilst in the display.
 		/// </summary>
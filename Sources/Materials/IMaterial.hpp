@@ -28,5 +28,31 @@ namespace acid
 		virtual void PushDescriptors(DescriptorsHandler &descriptorSet) = 0;
 
 		virtual std::shared_ptr<PipelineMaterial> GetMaterial() const = 0;
+
+		/// <summary>
+		/// Gets the pipeline used to draw many objects sharing this material in one instanced draw.
+		/// </summary>
+		/// <returns> The instanced pipeline, or null if this material cannot be instanced. </returns>
+		virtual std::shared_ptr<PipelineMaterial> GetInstancedMaterial() const { return nullptr; }
+
+		/// <summary>
+		/// Gets if this material can be drawn in the same instanced draw as another, sharing its descriptors.
+		/// </summary>
+		/// <param name="other"> The other material. </param>
+		/// <returns> If the materials can share an instanced draw. </returns>
+		virtual bool IsInstanceCompatible(const IMaterial &other) const { return false; }
+
+		/// <summary>
+		/// Gets the size of the data written for each instance, laid out as the instanced shaders storage buffer element.
+		/// The element must start with the objects world matrix, which the GPU culling shader reads.
+		/// </summary>
+		/// <returns> The instance size. </returns>
+		virtual std::size_t GetInstanceSize() const { return 0; }
+
+		/// <summary>
+		/// Writes the per object data of this material into an instance buffer.
+		/// </summary>
+		/// <param name="instance"> The memory to write the instance to, of <seealso cref="#GetInstanceSize()"/> bytes. </param>
+		virtual void WriteInstance(void *instance) const {}
 	};
 }
@@ -6,6 +6,19 @@
 
 namespace acid
 {
+	/// <summary>
+	/// The std430 layout of an element of the instanced default shaders storage buffer.
+	/// </summary>
+	struct InstanceData
+	{
+		float m_transform[16];
+		float m_baseDiffuse[4];
+		float m_metallic;
+		float m_roughness;
+		float m_ignoreFog;
+		float m_ignoreLighting;
+	};
+
 	MaterialDefault::MaterialDefault(const Colour &baseDiffuse, const std::shared_ptr<Texture> &diffuseTexture,
 									 const float &metallic, const float &roughness, const std::shared_ptr<Texture> &materialTexture, const std::shared_ptr<Texture> &normalTexture,
 									 const bool &castsShadows, const bool &ignoreLighting, const bool &ignoreFog) :
@@ -19,7 +32,16 @@ namespace acid
 		m_castsShadows(castsShadows),
 		m_ignoreLighting(ignoreLighting),
 		m_ignoreFog(ignoreFog),
-		m_material(nullptr)
+		m_material(nullptr),
+		m_instancedMaterial(nullptr),
+		m_uniformBlock(nullptr),
+		m_uniformJointTransforms(nullptr),
+		m_uniformTransform(nullptr),
+		m_uniformBaseDiffuse(nullptr),
+		m_uniformMetallic(nullptr),
+		m_uniformRoughness(nullptr),
+		m_uniformIgnoreFog(nullptr),
+		m_uniformIgnoreLighting(nullptr)
 	{
 	}
 
@@ -40,6 +62,15 @@ namespace acid
 		m_animated = std::dynamic_pointer_cast<MeshAnimated>(mesh) != nullptr;
 		m_material = PipelineMaterial::Resource({1, 0}, PipelineCreate({"Shaders/Defaults/Default.vert", "Shaders/Defaults/Default.frag"},
 			mesh->GetVertexInput(), PIPELINE_MODE_MRT, VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, GetDefines()));
+
+		// Joint transforms are per object and too large to instance, animated meshes are always drawn one at a time.
+		if (!m_animated)
+		{
+			auto instancedDefines = GetDefines();
+			instancedDefines.emplace_back(PipelineDefine("INSTANCED", "TRUE"));
+			m_instancedMaterial = PipelineMaterial::Resource({1, 0}, PipelineCreate({"Shaders/Defaults/Default.vert", "Shaders/Defaults/Default.frag"},
+				mesh->GetVertexInput(), PIPELINE_MODE_MRT, VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, instancedDefines));
+		}
 	}
 
 	void MaterialDefault::Update()
@@ -78,19 +109,32 @@ namespace acid
 
 	void MaterialDefault::PushUniforms(UniformHandler &uniformObject)
 	{
+		// Uniforms are looked up by name once for each block, then pushed through their handles.
+		if (m_uniformBlock != uniformObject.GetUniformBlock())
+		{
+			m_uniformBlock = uniformObject.GetUniformBlock();
+			m_uniformJointTransforms = uniformObject.GetUniform("jointTransforms");
+			m_uniformTransform = uniformObject.GetUniform("transform");
+			m_uniformBaseDiffuse = uniformObject.GetUniform("baseDiffuse");
+			m_uniformMetallic = uniformObject.GetUniform("metallic");
+			m_uniformRoughness = uniformObject.GetUniform("roughness");
+			m_uniformIgnoreFog = uniformObject.GetUniform("ignoreFog");
+			m_uniformIgnoreLighting = uniformObject.GetUniform("ignoreLighting");
+		}
+
 		if (m_animated)
 		{
 			auto meshAnimated = GetGameObject()->GetComponent<MeshAnimated>();
 			auto joints = meshAnimated->GetJointTransforms();
-			uniformObject.Push("jointTransforms", *joints.data(), sizeof(Matrix4) * joints.size());
+			uniformObject.Push(m_uniformJointTransforms, *joints.data(), sizeof(Matrix4) * joints.size());
 		}
 
-		uniformObject.Push("transform", GetGameObject()->GetTransform().GetWorldMatrix());
-		uniformObject.Push("baseDiffuse", m_baseDiffuse);
-		uniformObject.Push("metallic", m_metallic);
-		uniformObject.Push("roughness", m_roughness);
-		uniformObject.Push("ignoreFog", static_cast<float>(m_ignoreFog));
-		uniformObject.Push("ignoreLighting", static_cast<float>(m_ignoreLighting));
+		uniformObject.Push(m_uniformTransform, GetGameObject()->GetTransform().GetWorldMatrix());
+		uniformObject.Push(m_uniformBaseDiffuse, m_baseDiffuse);
+		uniformObject.Push(m_uniformMetallic, m_metallic);
+		uniformObject.Push(m_uniformRoughness, m_roughness);
+		uniformObject.Push(m_uniformIgnoreFog, static_cast<float>(m_ignoreFog));
+		uniformObject.Push(m_uniformIgnoreLighting, static_cast<float>(m_ignoreLighting));
 	}
 
 	void MaterialDefault::PushDescriptors(DescriptorsHandler &descriptorSet)
@@ -100,6 +144,37 @@ namespace acid
 		descriptorSet.Push("samplerNormal", m_normalTexture);
 	}
 
+	bool MaterialDefault::IsInstanceCompatible(const IMaterial &other) const
+	{
+		auto otherDefault = dynamic_cast<const MaterialDefault *>(&other);
+
+		if (otherDefault == nullptr || m_instancedMaterial == nullptr)
+		{
+			return false;
+		}
+
+		// Textures are bound once for the whole draw, everything else is read from the instance.
+		return m_instancedMaterial == otherDefault->m_instancedMaterial && m_diffuseTexture == otherDefault->m_diffuseTexture &&
+			m_materialTexture == otherDefault->m_materialTexture && m_normalTexture == otherDefault->m_normalTexture;
+	}
+
+	std::size_t MaterialDefault::GetInstanceSize() const
+	{
+		return sizeof(InstanceData);
+	}
+
+	void MaterialDefault::WriteInstance(void *instance) const
+	{
+		auto data = static_cast<InstanceData *>(instance);
+		Matrix4 transform = GetGameObject()->GetTransform().GetWorldMatrix();
+		memcpy(data->m_transform, &transform, sizeof(data->m_transform));
+		memcpy(data->m_baseDiffuse, &m_baseDiffuse, sizeof(data->m_baseDiffuse));
+		data->m_metallic = m_metallic;
+		data->m_roughness = m_roughness;
+		data->m_ignoreFog = static_cast<float>(m_ignoreFog);
+		data->m_ignoreLighting = static_cast<float>(m_ignoreLighting);
+	}
+
 	std::vector<PipelineDefine> MaterialDefault::GetDefines()
 	{
 		std::vector<PipelineDefine> result = {};
@@ -28,6 +28,16 @@ namespace acid
 		bool m_ignoreFog;
 
 		std::shared_ptr<PipelineMaterial> m_material;
+		std::shared_ptr<PipelineMaterial> m_instancedMaterial;
+
+		std::shared_ptr<UniformBlock> m_uniformBlock;
+		std::shared_ptr<Uniform> m_uniformJointTransforms;
+		std::shared_ptr<Uniform> m_uniformTransform;
+		std::shared_ptr<Uniform> m_uniformBaseDiffuse;
+		std::shared_ptr<Uniform> m_uniformMetallic;
+		std::shared_ptr<Uniform> m_uniformRoughness;
+		std::shared_ptr<Uniform> m_uniformIgnoreFog;
+		std::shared_ptr<Uniform> m_uniformIgnoreLighting;
 	public:
 		MaterialDefault(const Colour &baseDiffuse = Colour::WHITE, const std::shared_ptr<Texture> &diffuseTexture = nullptr,
 						const float &metallic = 0.0f, const float &roughness = 0.0f, const std::shared_ptr<Texture> &materialTexture = nullptr, const std::shared_ptr<Texture> &normalTexture = nullptr,
@@ -111,5 +121,13 @@ namespace acid
 		void SetIgnoreFog(const bool &ignoreFog) { m_ignoreFog = ignoreFog; }
 
 		std::shared_ptr<PipelineMaterial> GetMaterial() const override { return m_material; }
+
+		std::shared_ptr<PipelineMaterial> GetInstancedMaterial() const override { return m_instancedMaterial; }
+
+		bool IsInstanceCompatible(const IMaterial &other) const override;
+
+		std::size_t GetInstanceSize() const override;
+
+		void WriteInstance(void *instance) const override;
 	};
 }
@@ -20,7 +20,7 @@ namespace acid
 
 	PipelineMaterial::PipelineMaterial(const GraphicsStage &graphicsStage, const PipelineCreate &pipelineCreate) :
 		m_filename(ToFilename(graphicsStage, pipelineCreate)),
-		m_pipeline(Pipeline(graphicsStage, pipelineCreate))
+		m_pipeline(Pipeline(graphicsStage, pipelineCreate, true))
 	{
 	}
 
@@ -8,7 +8,8 @@
 namespace acid
 {
 	/// <summary>
-	/// Class that represents a material pipeline.
+	/// Class that represents a material pipeline. The pipeline is built on the thread pool, so many materials can be loaded
+	/// at once, renderers must skip the material until <seealso cref="#IsReady()"/>.
 	/// </summary>
 	class ACID_EXPORT PipelineMaterial :
 		public IResource
@@ -35,6 +36,8 @@ namespace acid
 
 		std::string GetFilename() override { return m_filename; }
 
+		bool IsReady() const { return m_pipeline.IsReady(); }
+
 		Pipeline &GetPipeline() { return m_pipeline; }
 
 	private:
@@ -11,20 +11,6 @@ namespace acid
 	const Matrix4 Matrix4::IDENTITY = Matrix4(new float[16]{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
 	const Matrix4 Matrix4::ZERO = Matrix4(0.0f);
 
-	Matrix4::Matrix4(const float &diagonal)
-	{
-		memset(m_rows, 0, 4 * sizeof(Vector4));
-		m_rows[0][0] = diagonal;
-		m_rows[1][1] = diagonal;
-		m_rows[2][2] = diagonal;
-		m_rows[3][3] = diagonal;
-	}
-
-	Matrix4::Matrix4(const Matrix4 &source)
-	{
-		memcpy(m_rows, source.m_rows, 4 * sizeof(Vector4));
-	}
-
 	Matrix4::Matrix4(const float *source)
 	{
 		memcpy(m_rows, source, 4 * 4 * sizeof(float));
@@ -35,67 +21,6 @@ namespace acid
 		memcpy(m_rows, source, 4 * sizeof(Vector4));
 	}
 
-	Matrix4::~Matrix4()
-	{
-	}
-
-	Matrix4 Matrix4::Add(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] + other[row][col];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Subtract(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] - other[row][col];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Multiply(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[0][col] * other[row][0] + m_rows[1][col] * other[row][1] + m_rows[2][col] * other[row][2] + m_rows[3][col] * other[row][3];
-			}
-		}
-
-		return result;
-	}
-
-	Vector4 Matrix4::Multiply(const Vector4 &other) const
-	{
-		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Divide(const Matrix4 &other) const
 	{
 		Matrix4 result = Matrix4();
@@ -111,18 +36,6 @@ namespace acid
 		return result;
 	}
 
-	Vector4 Matrix4::Transform(const Vector4 &other) const
-	{
-		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Translate(const Vector2 &other) const
 	{
 		Matrix4 result = Matrix4(*this);
@@ -147,36 +60,6 @@ namespace acid
 		return result;
 	}
 
-	Matrix4 Matrix4::Scale(const Vector3 &other) const
-	{
-		Matrix4 result = Matrix4(*this);
-
-		for (int32_t row = 0; row < 3; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] *= other[row];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Scale(const Vector4 &other) const
-	{
-		Matrix4 result = Matrix4(*this);
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] *= other[row];
-			}
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Rotate(const float &angle, const Vector3 &axis) const
 	{
 		Matrix4 result = Matrix4(*this);
@@ -202,69 +85,27 @@ namespace acid
 		f[2][1] = yz * o - xs;
 		f[2][2] = axis.m_z * axis.m_z * o + c;
 
-		for (int32_t row = 0; row < 3; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[0][col] * f[row][0] + m_rows[1][col] * f[row][1] + m_rows[2][col] * f[row][2];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Negate() const
-	{
-		Matrix4 result = Matrix4();
+#if ACID_SIMD_SSE
+		__m128 row0 = m_rows[0].ToSimd();
+		__m128 row1 = m_rows[1].ToSimd();
+		__m128 row2 = m_rows[2].ToSimd();
 
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = -m_rows[row][col];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Invert() const
-	{
-		Matrix4 result = Matrix4(*this);
-
-		float det = Determinant();
-		assert(det != 0.0f && "Determinant cannot be zero!");
-
-		for (int32_t j = 0; j < 4; j++)
+		for (int32_t row = 0; row < 3; row++)
 		{
-			for (int32_t i = 0; i < 4; i++)
-			{
-				// Get minor of element [j][i] - not [i][j], this is where the transpose happens.
-				Matrix3 minorSubmatrix = GetSubmatrix(j, i);
-				float minor = minorSubmatrix.Determinant();
-
-				// Multiply by (−1)^{i+j}.
-				float factor = ((i + j) % 2 == 1) ? -1.0f : 1.0f;
-				float cofactor = minor * factor;
-
-				result[i][j] = cofactor / det;
-			}
+			__m128 sum = _mm_mul_ps(row0, _mm_set1_ps(f[row][0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(row1, _mm_set1_ps(f[row][1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(row2, _mm_set1_ps(f[row][2])));
+			result.m_rows[row] = Vector4::FromSimd(sum);
 		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Transpose() const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
+#else
+		for (int32_t row = 0; row < 3; row++)
 		{
 			for (int32_t col = 0; col < 4; col++)
 			{
-				result[row][col] = m_rows[col][row];
+				result[row][col] = m_rows[0][col] * f[row][0] + m_rows[1][col] * f[row][1] + m_rows[2][col] * f[row][2];
 			}
 		}
+#endif
 
 		return result;
 	}
@@ -320,10 +161,12 @@ namespace acid
 	{
 		Matrix4 result = Matrix4();
 
+#if !ACID_SIMD_SSE
 		if (translation.LengthSquared() != 0.0f)
 		{
 			result = result.Translate(translation);
 		}
+#endif
 
 		if (rotation.LengthSquared() != 0.0f)
 		{
@@ -332,10 +175,18 @@ namespace acid
 			result = result.Rotate(Maths::Radians(rotation.m_z), Vector3::FRONT); // Rotate the Z component.
 		}
 
+#if ACID_SIMD_SSE
+		// Rotations and scaling only touch the first three rows, so the translation row is written directly.
+		result.m_rows[0] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[0].ToSimd(), _mm_set1_ps(scale.m_x)));
+		result.m_rows[1] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[1].ToSimd(), _mm_set1_ps(scale.m_y)));
+		result.m_rows[2] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[2].ToSimd(), _mm_set1_ps(scale.m_z)));
+		result.m_rows[3] = Vector4(translation.m_x, translation.m_y, translation.m_z, 1.0f);
+#else
 		if (scale != Vector3::ONE)
 		{
 			result = result.Scale(scale);
 		}
+#endif
 
 		return result;
 	}
@@ -344,12 +195,20 @@ namespace acid
 	{
 		Matrix4 result = rotation.ToRotationMatrix();
 
+#if ACID_SIMD_SSE
+		// Scales the rotation rows in place and writes the translation row, instead of copying the matrix to scale it.
+		result.m_rows[0] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[0].ToSimd(), _mm_set1_ps(scale.m_x)));
+		result.m_rows[1] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[1].ToSimd(), _mm_set1_ps(scale.m_y)));
+		result.m_rows[2] = Vector4::FromSimd(_mm_mul_ps(result.m_rows[2].ToSimd(), _mm_set1_ps(scale.m_z)));
+		result.m_rows[3] = Vector4(translation.m_x, translation.m_y, translation.m_z, 1.0f);
+#else
 		result[3][0] = translation.m_x;
 		result[3][1] = translation.m_y;
 		result[3][2] = translation.m_z;
 		result[3][3] = 1.0f;
 
 		result = result.Scale(scale);
+#endif
 
 		return result;
 	}
@@ -483,133 +342,6 @@ namespace acid
 		metadata.SetChild<Vector4>("m3", m_rows[3]);
 	}
 
-	bool Matrix4::operator==(const Matrix4 &other) const
-	{
-		return m_rows[0] == other[0] && m_rows[1] == other[1] && m_rows[2] == other[2] && m_rows[3] == other[3];
-	}
-
-	bool Matrix4::operator!=(const Matrix4 &other) const
-	{
-		return !(*this == other);
-	}
-
-	Matrix4 Matrix4::operator-() const
-	{
-		return Negate();
-	}
-
-	const Vector4 &Matrix4::operator[](const uint32_t &index) const
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
-	Vector4 &Matrix4::operator[](const uint32_t &index)
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
-	Matrix4 operator+(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Add(right);
-	}
-
-	Matrix4 operator-(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Subtract(right);
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Multiply(right);
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Divide(right);
-	}
-
-	Matrix4 operator*(const Vector4 &left, const Matrix4 &right)
-	{
-		return right.Scale(left);
-	}
-
-	Matrix4 operator/(const Vector4 &left, const Matrix4 &right)
-	{
-		return right.Scale(1.0f / left);
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const Vector4 &right)
-	{
-		return left.Scale(right);
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const Vector4 &right)
-	{
-		return left.Scale(1.0f / right);
-	}
-
-	Matrix4 operator*(const float &left, const Matrix4 &right)
-	{
-		return right.Scale(Vector4(left, left, left, left));
-	}
-
-	Matrix4 operator/(const float &left, const Matrix4 &right)
-	{
-		return right.Scale(1.0f / Vector4(left, left, left, left));
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const float &right)
-	{
-		return left.Scale(Vector4(right, right, right, right));
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const float &right)
-	{
-		return left.Scale(1.0f / Vector4(right, right, right, right));
-	}
-
-	Matrix4 &Matrix4::operator+=(const Matrix4 &other)
-	{
-		return *this = Add(other);
-	}
-
-	Matrix4 &Matrix4::operator-=(const Matrix4 &other)
-	{
-		return *this = Subtract(other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const Matrix4 &other)
-	{
-		return *this = Multiply(other);
-	}
-
-	Matrix4 &Matrix4::operator/=(const Matrix4 &other)
-	{
-		return *this = Divide(other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const Vector4 &other)
-	{
-		return *this = Scale(other);
-	}
-
-	Matrix4 &Matrix4::operator/=(const Vector4 &other)
-	{
-		return *this = Scale(1.0f / other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const float &other)
-	{
-		return *this = Scale(Vector4(other, other, other, other));
-	}
-
-	Matrix4 &Matrix4::operator/=(const float &other)
-	{
-		return *this = Scale(1.0f / Vector4(other, other, other, other));
-	}
-
 	std::ostream &operator<<(std::ostream &stream, const Matrix4 &matrix)
 	{
 		stream << matrix.ToString();
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cassert>
 #include <ostream>
 #include <string>
 #include "Vector3.hpp"
 #include "Vector4.hpp"
 #include "Serialized/Metadata.hpp"
+#include "Simd.hpp"
 
 namespace acid
 {
@@ -40,13 +42,19 @@ namespace acid
 		/// Constructor for Matrix4. The matrix is initialised to the identity.
 		/// </summary>
 		/// <param name="diagonal"> The value set to the diagonals. </param>
-		Matrix4(const float &diagonal = 1.0f);
+		Matrix4(const float &diagonal = 1.0f)
+		{
+			m_rows[0] = Vector4(diagonal, 0.0f, 0.0f, 0.0f);
+			m_rows[1] = Vector4(0.0f, diagonal, 0.0f, 0.0f);
+			m_rows[2] = Vector4(0.0f, 0.0f, diagonal, 0.0f);
+			m_rows[3] = Vector4(0.0f, 0.0f, 0.0f, diagonal);
+		}
 
 		/// <summary>
 		/// Constructor for Matrix4.
 		/// </summary>
 		/// <param name="source"> Creates this matrix out of a existing one. </param>
-		Matrix4(const Matrix4 &source);
+		Matrix4(const Matrix4 &source) = default;
 
 		/// <summary>
 		/// Constructor for Matrix4.
@@ -60,35 +68,101 @@ namespace acid
 		/// <param name="source"> Creates this matrix out of a 4 vector array. </param>
 		Matrix4(const Vector4 source[4]);
 
-		~Matrix4();
+		~Matrix4() = default;
 
 		/// <summary>
 		/// Adds this matrix to another matrix.
 		/// </summary>
 		/// <param name="other"> The other matrix. </param>
 		/// <returns> The resultant matrix. </returns>
-		Matrix4 Add(const Matrix4 &other) const;
+		Matrix4 Add(const Matrix4 &other) const
+		{
+			Matrix4 result = Matrix4();
+
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = m_rows[row].Add(other[row]);
+			}
+
+			return result;
+		}
 
 		/// <summary>
 		/// Subtracts this matrix to another matrix.
 		/// </summary>
 		/// <param name="other"> The other matrix. </param>
 		/// <returns> The resultant matrix. </returns>
-		Matrix4 Subtract(const Matrix4 &other) const;
+		Matrix4 Subtract(const Matrix4 &other) const
+		{
+			Matrix4 result = Matrix4();
+
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = m_rows[row].Subtract(other[row]);
+			}
+
+			return result;
+		}
 
 		/// <summary>
 		/// Multiplies this matrix by another matrix.
 		/// </summary>
 		/// <param name="other"> The other matrix. </param>
 		/// <returns> The resultant matrix. </returns>
-		Matrix4 Multiply(const Matrix4 &other) const;
+		Matrix4 Multiply(const Matrix4 &other) const
+		{
+			Matrix4 result = Matrix4();
+
+#if ACID_SIMD_AVX
+			// Each 128 bit lane holds one row of the result, so two rows are computed at once.
+			__m256 row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m_rows[0].m_elements));
+			__m256 row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m_rows[1].m_elements));
+			__m256 row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m_rows[2].m_elements));
+			__m256 row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m_rows[3].m_elements));
+
+			for (int32_t row = 0; row < 4; row += 2)
+			{
+				__m256 factors = _mm256_loadu_ps(other.m_rows[row].m_elements);
+				__m256 sum = _mm256_mul_ps(row0, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(0, 0, 0, 0)));
+				sum = _mm256_add_ps(sum, _mm256_mul_ps(row1, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(1, 1, 1, 1))));
+				sum = _mm256_add_ps(sum, _mm256_mul_ps(row2, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(2, 2, 2, 2))));
+				sum = _mm256_add_ps(sum, _mm256_mul_ps(row3, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm256_storeu_ps(result.m_rows[row].m_elements, sum);
+			}
+#else
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = Multiply(other[row]);
+			}
+#endif
+
+			return result;
+		}
 
 		/// <summary>
 		/// Multiplies this matrix by a vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Multiply(const Vector4 &other) const;
+		Vector4 Multiply(const Vector4 &other) const
+		{
+#if ACID_SIMD_SSE
+			__m128 sum = _mm_mul_ps(m_rows[0].ToSimd(), _mm_set1_ps(other.m_x));
+			sum = _mm_add_ps(sum, _mm_mul_ps(m_rows[1].ToSimd(), _mm_set1_ps(other.m_y)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(m_rows[2].ToSimd(), _mm_set1_ps(other.m_z)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(m_rows[3].ToSimd(), _mm_set1_ps(other.m_w)));
+			return Vector4::FromSimd(sum);
+#else
+			Vector4 result = Vector4();
+
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
+			}
+
+			return result;
+#endif
+		}
 
 		/// <summary>
 		/// Divides this matrix by another matrix.
@@ -102,7 +176,7 @@ namespace acid
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Transform(const Vector4 &other) const;
+		Vector4 Transform(const Vector4 &other) const { return Multiply(other); }
 
 		/// <summary>
 		/// Translates this matrix by a vector.
@@ -123,14 +197,34 @@ namespace acid
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant matrix. </returns>
-		Matrix4 Scale(const Vector3 &other) const;
+		Matrix4 Scale(const Vector3 &other) const
+		{
+			Matrix4 result = Matrix4(*this);
+
+			for (int32_t row = 0; row < 3; row++)
+			{
+				result[row] = m_rows[row].Scale(other[row]);
+			}
+
+			return result;
+		}
 
 		/// <summary>
 		/// Scales this matrix by a vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant matrix. </returns>
-		Matrix4 Scale(const Vector4 &other) const;
+		Matrix4 Scale(const Vector4 &other) const
+		{
+			Matrix4 result = Matrix4(*this);
+
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = m_rows[row].Scale(other[row]);
+			}
+
+			return result;
+		}
 
 		/// <summary>
 		/// Rotates this matrix around the given axis the specified angle.
@@ -144,19 +238,174 @@ namespace acid
 		/// Inverts this matrix.
 		/// </summary>
 		/// <returns> The inverted matrix. </returns>
-		Matrix4 Negate() const;
+		Matrix4 Negate() const
+		{
+			Matrix4 result = Matrix4();
+
+			for (int32_t row = 0; row < 4; row++)
+			{
+				result[row] = m_rows[row].Negate();
+			}
+
+			return result;
+		}
 
 		/// <summary>
 		/// Negates this matrix.
 		/// </summary>
 		/// <returns> The negated matrix. </returns>
-		Matrix4 Invert() const;
+		Matrix4 Invert() const
+		{
+			Matrix4 result = Matrix4();
+
+#if ACID_SIMD_SSE
+			// Cramer's rule on the transposed rows, with the 2x2 sub determinants shared between cofactors.
+			__m128 in0 = m_rows[0].ToSimd();
+			__m128 in1 = m_rows[1].ToSimd();
+			__m128 in2 = m_rows[2].ToSimd();
+			__m128 in3 = m_rows[3].ToSimd();
+			__m128 tmp0 = _mm_movelh_ps(in0, in1);
+			__m128 tmp1 = _mm_movelh_ps(in2, in3);
+			__m128 tmp2 = _mm_movehl_ps(in1, in0);
+			__m128 tmp3 = _mm_movehl_ps(in3, in2);
+			__m128 row0 = _mm_shuffle_ps(tmp0, tmp1, 0x88);
+			__m128 row1 = _mm_shuffle_ps(tmp1, tmp0, 0xDD);
+			__m128 row2 = _mm_shuffle_ps(tmp2, tmp3, 0x88);
+			__m128 row3 = _mm_shuffle_ps(tmp3, tmp2, 0xDD);
+
+			__m128 tmp = _mm_mul_ps(row2, row3);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			__m128 minor0 = _mm_mul_ps(row1, tmp);
+			__m128 minor1 = _mm_mul_ps(row0, tmp);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+			minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+			minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+			tmp = _mm_mul_ps(row1, row2);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+			__m128 minor3 = _mm_mul_ps(row0, tmp);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+			minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+			minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+			tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+			minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+			__m128 minor2 = _mm_mul_ps(row0, tmp);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+			minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+			minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+			tmp = _mm_mul_ps(row0, row1);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+			minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+			minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+			tmp = _mm_mul_ps(row0, row3);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+			minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+			minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+			tmp = _mm_mul_ps(row0, row2);
+			tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+			minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+			minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+			tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+			minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+			minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+			__m128 det = _mm_mul_ps(row0, minor0);
+			det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+			det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+			assert(_mm_cvtss_f32(det) != 0.0f && "Determinant cannot be zero!");
+			det = _mm_shuffle_ps(det, det, 0x00);
+
+			_mm_storeu_ps(result.m_rows[0].m_elements, _mm_div_ps(minor0, det));
+			_mm_storeu_ps(result.m_rows[1].m_elements, _mm_div_ps(minor1, det));
+			_mm_storeu_ps(result.m_rows[2].m_elements, _mm_div_ps(minor2, det));
+			_mm_storeu_ps(result.m_rows[3].m_elements, _mm_div_ps(minor3, det));
+#else
+			// Cofactor expansion with the 2x2 sub determinants of the top and bottom row pairs shared between cofactors.
+			const float *m = m_linear;
+			float s0 = m[0] * m[5] - m[4] * m[1];
+			float s1 = m[0] * m[6] - m[4] * m[2];
+			float s2 = m[0] * m[7] - m[4] * m[3];
+			float s3 = m[1] * m[6] - m[5] * m[2];
+			float s4 = m[1] * m[7] - m[5] * m[3];
+			float s5 = m[2] * m[7] - m[6] * m[3];
+			float c5 = m[10] * m[15] - m[14] * m[11];
+			float c4 = m[9] * m[15] - m[13] * m[11];
+			float c3 = m[9] * m[14] - m[13] * m[10];
+			float c2 = m[8] * m[15] - m[12] * m[11];
+			float c1 = m[8] * m[14] - m[12] * m[10];
+			float c0 = m[8] * m[13] - m[12] * m[9];
+
+			float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+			assert(det != 0.0f && "Determinant cannot be zero!");
+
+			float *r = result.m_linear;
+			r[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) / det;
+			r[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) / det;
+			r[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) / det;
+			r[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) / det;
+			r[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) / det;
+			r[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) / det;
+			r[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) / det;
+			r[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) / det;
+			r[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) / det;
+			r[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) / det;
+			r[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) / det;
+			r[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) / det;
+			r[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) / det;
+			r[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) / det;
+			r[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) / det;
+			r[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) / det;
+#endif
+
+			return result;
+		}
 
 		/// <summary>
 		/// Transposes this matrix.
 		/// </summary>
 		/// <returns> The transposed matrix. </returns>
-		Matrix4 Transpose() const;
+		Matrix4 Transpose() const
+		{
+			Matrix4 result = Matrix4();
+
+#if ACID_SIMD_SSE
+			__m128 row0 = m_rows[0].ToSimd();
+			__m128 row1 = m_rows[1].ToSimd();
+			__m128 row2 = m_rows[2].ToSimd();
+			__m128 row3 = m_rows[3].ToSimd();
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+			_mm_storeu_ps(result.m_rows[0].m_elements, row0);
+			_mm_storeu_ps(result.m_rows[1].m_elements, row1);
+			_mm_storeu_ps(result.m_rows[2].m_elements, row2);
+			_mm_storeu_ps(result.m_rows[3].m_elements, row3);
+#else
+			for (int32_t row = 0; row < 4; row++)
+			{
+				for (int32_t col = 0; col < 4; col++)
+				{
+					result[row][col] = m_rows[col][row];
+				}
+			}
+#endif
+
+			return result;
+		}
 
 		/// <summary>
 		/// Takes the determinant of this matrix.
@@ -249,55 +498,63 @@ namespace acid
 
 		void Encode(Metadata &metadata) const;
 
-		bool operator==(const Matrix4 &other) const;
+		bool operator==(const Matrix4 &other) const { return m_rows[0] == other[0] && m_rows[1] == other[1] && m_rows[2] == other[2] && m_rows[3] == other[3]; }
 
-		bool operator!=(const Matrix4 &other) const;
+		bool operator!=(const Matrix4 &other) const { return !(*this == other); }
 
-		Matrix4 operator-() const;
+		Matrix4 operator-() const { return Negate(); }
 
-		const Vector4 &operator[](const uint32_t &index) const;
+		const Vector4 &operator[](const uint32_t &index) const
+		{
+			assert(index < 4);
+			return m_rows[index];
+		}
 
-		Vector4 &operator[](const uint32_t &index);
+		Vector4 &operator[](const uint32_t &index)
+		{
+			assert(index < 4);
+			return m_rows[index];
+		}
 
-		ACID_EXPORT friend Matrix4 operator+(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator+(const Matrix4 &left, const Matrix4 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Matrix4 operator-(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator-(const Matrix4 &left, const Matrix4 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator*(const Matrix4 &left, const Matrix4 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator/(const Matrix4 &left, const Matrix4 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Vector4 &left, const Matrix4 &right);
+		friend Matrix4 operator*(const Vector4 &left, const Matrix4 &right) { return right.Scale(left); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Vector4 &left, const Matrix4 &right);
+		friend Matrix4 operator/(const Vector4 &left, const Matrix4 &right) { return right.Scale(1.0f / left); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const Vector4 &right);
+		friend Matrix4 operator*(const Matrix4 &left, const Vector4 &right) { return left.Scale(right); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const Vector4 &right);
+		friend Matrix4 operator/(const Matrix4 &left, const Vector4 &right) { return left.Scale(1.0f / right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const float &left, const Matrix4 &right);
+		friend Matrix4 operator*(const float &left, const Matrix4 &right) { return right.Scale(Vector4(left, left, left, left)); }
 
-		ACID_EXPORT friend Matrix4 operator/(const float &left, const Matrix4 &right);
+		friend Matrix4 operator/(const float &left, const Matrix4 &right) { return right.Scale(1.0f / Vector4(left, left, left, left)); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const float &right);
+		friend Matrix4 operator*(const Matrix4 &left, const float &right) { return left.Scale(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const float &right);
+		friend Matrix4 operator/(const Matrix4 &left, const float &right) { return left.Scale(1.0f / Vector4(right, right, right, right)); }
 
-		Matrix4 &operator+=(const Matrix4 &other);
+		Matrix4 &operator+=(const Matrix4 &other) { return *this = Add(other); }
 
-		Matrix4 &operator-=(const Matrix4 &other);
+		Matrix4 &operator-=(const Matrix4 &other) { return *this = Subtract(other); }
 
-		Matrix4 &operator*=(const Matrix4 &other);
+		Matrix4 &operator*=(const Matrix4 &other) { return *this = Multiply(other); }
 
-		Matrix4 &operator/=(const Matrix4 &other);
+		Matrix4 &operator/=(const Matrix4 &other) { return *this = Divide(other); }
 
-		Matrix4 &operator*=(const Vector4 &other);
+		Matrix4 &operator*=(const Vector4 &other) { return *this = Scale(other); }
 
-		Matrix4 &operator/=(const Vector4 &other);
+		Matrix4 &operator/=(const Vector4 &other) { return *this = Scale(1.0f / other); }
 
-		Matrix4 &operator*=(const float &other);
+		Matrix4 &operator*=(const float &other) { return *this = Scale(Vector4(other, other, other, other)); }
 
-		Matrix4 &operator/=(const float &other);
+		Matrix4 &operator/=(const float &other) { return *this = Scale(1.0f / Vector4(other, other, other, other)); }
 
 		ACID_EXPORT friend std::ostream &operator<<(std::ostream &stream, const Matrix4 &matrix);
 
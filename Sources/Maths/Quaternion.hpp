@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cassert>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include "Matrix4.hpp"
 #include "Vector3.hpp"
 #include "Serialized/Metadata.hpp"
+#include "Simd.hpp"
 
 namespace acid
 {
@@ -38,7 +41,13 @@ namespace acid
 		/// <summary>
 		/// Constructor for Quaternion.
 		/// </summary>
-		Quaternion();
+		Quaternion() :
+			m_x(0.0f),
+			m_y(0.0f),
+			m_z(0.0f),
+			m_w(1.0f)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -47,7 +56,13 @@ namespace acid
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
 		/// <param name="w"> Start w. </param>
-		Quaternion(const float &x, const float &y, const float &z, const float &w);
+		Quaternion(const float &x, const float &y, const float &z, const float &w) :
+			m_x(x),
+			m_y(y),
+			m_z(z),
+			m_w(w)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -68,7 +83,7 @@ namespace acid
 		/// Constructor for Quaternion.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Quaternion(const Quaternion &source);
+		Quaternion(const Quaternion &source) = default;
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -84,49 +99,118 @@ namespace acid
 		/// <param name="axisZ"> The Z axis. </param>
 		Quaternion(const Vector3 &axisX, const Vector3 &axisY, const Vector3 &axisZ);
 
-		~Quaternion();
+		~Quaternion() = default;
+
+#if ACID_SIMD_SSE
+		/// <summary>
+		/// Loads this quaternion into a SSE register.
+		/// </summary>
+		/// <returns> The register. </returns>
+		__m128 ToSimd() const { return _mm_loadu_ps(m_elements); }
+
+		/// <summary>
+		/// Creates a quaternion from a SSE register.
+		/// </summary>
+		/// <param name="value"> The register. </param>
+		/// <returns> The quaternion. </returns>
+		static Quaternion FromSimd(const __m128 &value)
+		{
+			Quaternion result;
+			_mm_storeu_ps(result.m_elements, value);
+			return result;
+		}
+#endif
 
 		/// <summary>
 		/// Adds this quaternion to another quaternion.
 		/// </summary>
 		/// <param name="other"> The other quaternion. </param>
 		/// <returns> The resultant quaternion. </returns>
-		Quaternion Add(const Quaternion &other) const;
+		Quaternion Add(const Quaternion &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_add_ps(ToSimd(), other.ToSimd()));
+#else
+			return Quaternion(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z, m_w + other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Subtracts this quaternion to another quaternion.
 		/// </summary>
 		/// <param name="other"> The other quaternion. </param>
 		/// <returns> The resultant quaternion. </returns>
-		Quaternion Subtract(const Quaternion &other) const;
+		Quaternion Subtract(const Quaternion &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_sub_ps(ToSimd(), other.ToSimd()));
+#else
+			return Quaternion(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z, m_w - other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Multiplies this quaternion with another quaternion.
 		/// </summary>
 		/// <param name="other"> The other quaternion. </param>
 		/// <returns> The resultant quaternion. </returns>
-		Quaternion Multiply(const Quaternion &other) const;
+		Quaternion Multiply(const Quaternion &other) const
+		{
+			return Quaternion(m_x * other.m_w + m_w * other.m_x + m_y * other.m_z - m_z * other.m_y,
+				m_y * other.m_w + m_w * other.m_y + m_z * other.m_x - m_x * other.m_z,
+				m_z * other.m_w + m_w * other.m_z + m_x * other.m_y - m_y * other.m_x,
+				m_w * other.m_w - m_x * other.m_x - m_y * other.m_y - m_z * other.m_z);
+		}
 
 		/// <summary>
 		/// Multiplies this quaternion with another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector3 Multiply(const Vector3 &other) const;
+		Vector3 Multiply(const Vector3 &other) const
+		{
+			//	Matrix4 rotation = left.ToRotationMatrix();
+			//	return right * rotation;
+
+			Vector3 q = Vector3(m_x, m_y, m_z);
+			Vector3 cross1 = q.Cross(other);
+			Vector3 cross2 = q.Cross(cross1);
+
+			return other + 2.0f * (cross1 * m_w + cross2);
+		}
 
 		/// <summary>
 		/// Multiplies this quaternion with the inverse of another quaternion. The value of both argument quaternions is persevered (this = left * right^-1).
 		/// </summary>
 		/// <param name="other"> The other quaternion. </param>
 		/// <returns> The resultant quaternion. </returns>
-		Quaternion MultiplyInverse(const Quaternion &other) const;
+		Quaternion MultiplyInverse(const Quaternion &other) const
+		{
+			float n = other.LengthSquared();
+			n = (n == 0.0f ? n : 1.0f / n);
+			return Quaternion(
+				(m_x * other.m_w - m_w * other.m_x - m_y * other.m_z + m_z * other.m_y) * n,
+				(m_y * other.m_w - m_w * other.m_y - m_z * other.m_x + m_x * other.m_z) * n,
+				(m_z * other.m_w - m_w * other.m_z - m_x * other.m_y + m_y * other.m_x) * n,
+				(m_w * other.m_w + m_x * other.m_x + m_y * other.m_y + m_z * other.m_z) * n);
+		}
 
 		/// <summary>
 		/// Calculates the dot product of the this quaternion and another quaternion.
 		/// </summary>
 		/// <param name="other"> The other quaternion. </param>
 		/// <returns> The dot product. </returns>
-		float Dot(const Quaternion &other) const;
+		float Dot(const Quaternion &other) const
+		{
+#if ACID_SIMD_SSE
+			__m128 product = _mm_mul_ps(ToSimd(), other.ToSimd());
+			__m128 swapped = _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1));
+			__m128 sums = _mm_add_ps(product, swapped);
+			return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(swapped, sums)));
+#else
+			return m_w * other.m_w + m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
+#endif
+		}
 
 		/// <summary>
 		/// Calculates the slerp between this quaternion and another quaternion, they must be normalized!
@@ -141,31 +225,42 @@ namespace acid
 		/// </summary>
 		/// <param name="scalar"> The scalar value. </param>
 		/// <returns> The scaled quaternion. </returns>
-		Quaternion Scale(const float &scalar) const;
+		Quaternion Scale(const float &scalar) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_mul_ps(ToSimd(), _mm_set1_ps(scalar)));
+#else
+			return Quaternion(m_x * scalar, m_y * scalar, m_z * scalar, m_w * scalar);
+#endif
+		}
 
 		/// <summary>
 		/// Negates this quaternion.
 		/// </summary>
 		/// <returns> The negated quaternion. </returns>
-		Quaternion Negate() const;
+		Quaternion Negate() const { return Quaternion(-m_x, -m_y, -m_z, -m_w); }
 
 		/// <summary>
 		/// Normalizes this quaternion.
 		/// </summary>
 		/// <returns> The normalized quaternion. </returns>
-		Quaternion Normalize() const;
+		Quaternion Normalize() const
+		{
+			float l = Length();
+			return Quaternion(m_x / l, m_y / l, m_z / l, m_w / l);
+		}
 
 		/// <summary>
 		/// Gets the length squared of this quaternion.
 		/// </summary>
 		/// <returns> The length squared. </returns>
-		float LengthSquared() const;
+		float LengthSquared() const { return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w; }
 
 		/// <summary>
 		/// Gets the length of this quaternion.
 		/// </summary>
 		/// <returns> The length. </returns>
-		float Length() const;
+		float Length() const { return std::sqrt(LengthSquared()); }
 
 		/// <summary>
 		/// Gets the maximum value in this quaternion.
@@ -218,9 +313,9 @@ namespace acid
 
 		void Encode(Metadata &metadata) const;
 
-		bool operator==(const Quaternion &other) const;
+		bool operator==(const Quaternion &other) const { return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z && m_w == other.m_w; }
 
-		bool operator!=(const Quaternion &other) const;
+		bool operator!=(const Quaternion &other) const { return !(*this == other); }
 
 		bool operator<(const Quaternion &other) const;
 
@@ -230,33 +325,41 @@ namespace acid
 
 		bool operator>=(const Quaternion &other) const;
 
-		bool operator==(const float &value) const;
+		bool operator==(const float &value) const { return m_x == value && m_y == value && m_z == value && m_w == value; }
 
-		bool operator!=(const float &value) const;
+		bool operator!=(const float &value) const { return !(*this == value); }
 
-		Quaternion operator-() const;
+		Quaternion operator-() const { return Negate(); }
 
-		const float &operator[](const uint32_t &index) const;
+		const float &operator[](const uint32_t &index) const
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
-		float &operator[](const uint32_t &index);
+		float &operator[](const uint32_t &index)
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
-		ACID_EXPORT friend Quaternion operator+(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator+(const Quaternion &left, const Quaternion &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Quaternion operator-(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator-(const Quaternion &left, const Quaternion &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Quaternion operator*(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator*(const Quaternion &left, const Quaternion &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &right, const Quaternion &left);
+		friend Vector3 operator*(const Vector3 &left, const Quaternion &right) { return right.Multiply(left); }
 
-		ACID_EXPORT friend Vector3 operator*(const Quaternion &left, const Vector3 &right);
+		friend Vector3 operator*(const Quaternion &left, const Vector3 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Quaternion operator*(const float &left, const Quaternion &right);
+		friend Quaternion operator*(const float &left, const Quaternion &right) { return right.Scale(left); }
 
-		ACID_EXPORT friend Quaternion operator*(const Quaternion &left, const float &right);
+		friend Quaternion operator*(const Quaternion &left, const float &right) { return left.Scale(right); }
 
-		Quaternion &operator*=(const Quaternion &other);
+		Quaternion &operator*=(const Quaternion &other) { return *this = Multiply(other); }
 
-		Quaternion &operator*=(const float &other);
+		Quaternion &operator*=(const float &other) { return *this = Scale(other); }
 
 		ACID_EXPORT friend std::ostream &operator<<(std::ostream &stream, const Quaternion &quaternion);
 
@@ -0,0 +1,11 @@
+#pragma once
+
+// SSE is used by the maths classes when the target supports it, defining ACID_NO_SIMD forces the scalar fallbacks.
+#if !defined(ACID_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ACID_SIMD_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define ACID_SIMD_AVX 1
+#include <immintrin.h>
+#endif
+#endif
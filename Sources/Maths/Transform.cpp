@@ -5,28 +5,44 @@ namespace acid
 	Transform::Transform() :
 		m_position(Vector3()),
 		m_rotation(Vector3()),
-		m_scaling(Vector3(1.0f, 1.0f, 1.0f))
+		m_scaling(Vector3(1.0f, 1.0f, 1.0f)),
+		m_parent(nullptr),
+		m_worldMatrix(Matrix4()),
+		m_dirty(true),
+		m_version(0)
 	{
 	}
 
 	Transform::Transform(const Transform &source) :
 		m_position(source.m_position),
 		m_rotation(source.m_rotation),
-		m_scaling(source.m_scaling)
+		m_scaling(source.m_scaling),
+		m_parent(nullptr),
+		m_worldMatrix(Matrix4()),
+		m_dirty(true),
+		m_version(0)
 	{
 	}
 
 	Transform::Transform(const Vector3 &position, const Vector3 &rotation, const Vector3 &scaling) :
 		m_position(position),
 		m_rotation(rotation),
-		m_scaling(scaling)
+		m_scaling(scaling),
+		m_parent(nullptr),
+		m_worldMatrix(Matrix4()),
+		m_dirty(true),
+		m_version(0)
 	{
 	}
 
 	Transform::Transform(const Vector3 &position, const Vector3 &rotation, const float &scale) :
 		m_position(position),
 		m_rotation(rotation),
-		m_scaling(Vector3(scale, scale, scale))
+		m_scaling(Vector3(scale, scale, scale)),
+		m_parent(nullptr),
+		m_worldMatrix(Matrix4()),
+		m_dirty(true),
+		m_version(0)
 	{
 	}
 
@@ -34,11 +50,31 @@ namespace acid
 	{
 	}
 
-	Matrix4 Transform::GetWorldMatrix() const
+	Matrix4 Transform::GetLocalMatrix() const
 	{
 		return Matrix4::TransformationMatrix(m_position, m_rotation, m_scaling);
 	}
 
+	Matrix4 Transform::GetWorldMatrix() const
+	{
+		// Normally already rebuilt by the scenes transform pass, transforms changed since then are built here and not cached.
+		if (!IsStale())
+		{
+			return m_worldMatrix;
+		}
+
+		return m_parent != nullptr ? m_parent->GetWorldMatrix() * GetLocalMatrix() : GetLocalMatrix();
+	}
+
+	void Transform::SetParent(const Transform *parent)
+	{
+		if (m_parent != parent)
+		{
+			m_parent = parent;
+			m_dirty = true;
+		}
+	}
+
 	Matrix4 Transform::GetModelMatrix() const
 	{
 		return Matrix4::TransformationMatrix(Vector3::ZERO, m_rotation, Vector3::ZERO);
@@ -49,6 +85,7 @@ namespace acid
 		m_position = metadata.GetChild<Vector3>("Position");
 		m_rotation = metadata.GetChild<Vector3>("Rotation");
 		m_scaling = metadata.GetChild<Vector3>("Scaling");
+		m_dirty = true;
 	}
 
 	void Transform::Encode(Metadata &metadata) const
@@ -58,6 +95,16 @@ namespace acid
 		metadata.SetChild<Vector3>("Scaling", m_scaling);
 	}
 
+	Transform &Transform::operator=(const Transform &other)
+	{
+		// The parent belongs to the object holding this transform, only the local values are copied.
+		m_position = other.m_position;
+		m_rotation = other.m_rotation;
+		m_scaling = other.m_scaling;
+		m_dirty = true;
+		return *this;
+	}
+
 	bool Transform::operator==(const Transform &other) const
 	{
 		return m_position == other.m_position && m_rotation == other.m_rotation && m_scaling == other.m_scaling;
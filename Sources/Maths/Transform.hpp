@@ -9,6 +9,8 @@ namespace acid
 {
 	/// <summary>
 	/// Holds position, rotation, and scale components.
+	/// The world matrix is cached, it is rebuilt by <seealso cref="SceneTransforms"/> once per frame. Reading it while this
+	/// transform or a parent is dirty builds it without caching, so the change still reaches the pass and the children.
 	/// </summary>
 	class ACID_EXPORT Transform
 	{
@@ -16,6 +18,12 @@ namespace acid
 		Vector3 m_position;
 		Vector3 m_rotation;
 		Vector3 m_scaling;
+		const Transform *m_parent;
+		Matrix4 m_worldMatrix;
+		bool m_dirty;
+		uint32_t m_version;
+
+		friend class SceneTransforms;
 	public:
 		/// <summary>
 		/// Constructor for Transform.
@@ -46,26 +54,78 @@ namespace acid
 
 		~Transform();
 
+		/// <summary>
+		/// Gets the matrix built from this transforms own position, rotation and scaling.
+		/// </summary>
+		/// <returns> The local matrix. </returns>
+		Matrix4 GetLocalMatrix() const;
+
+		/// <summary>
+		/// Gets the world matrix, this is the local matrix multiplied onto the parents world matrix. Nothing is written, so
+		/// it may be read from several threads while the scene is not updating.
+		/// </summary>
+		/// <returns> The world matrix. </returns>
 		Matrix4 GetWorldMatrix() const;
 
 		Matrix4 GetModelMatrix() const;
 
 		Vector3 GetPosition() const { return m_position; }
 
-		void SetPosition(const Vector3 &position) { m_position = position; }
+		void SetPosition(const Vector3 &position)
+		{
+			m_position = position;
+			m_dirty = true;
+		}
 
 		Vector3 GetRotation() const { return m_rotation; }
 
-		void SetRotation(const Vector3 &rotation) { m_rotation = rotation; }
+		void SetRotation(const Vector3 &rotation)
+		{
+			m_rotation = rotation;
+			m_dirty = true;
+		}
 
 		Vector3 GetScaling() const { return m_scaling; }
 
-		void SetScaling(const Vector3 &scaling) { m_scaling = scaling; }
+		void SetScaling(const Vector3 &scaling)
+		{
+			m_scaling = scaling;
+			m_dirty = true;
+		}
+
+		const Transform *GetParent() const { return m_parent; }
+
+		/// <summary>
+		/// Sets the transform this transform is relative to.
+		/// </summary>
+		/// <param name="parent"> The parent transform, or null if this transform is in world space. </param>
+		void SetParent(const Transform *parent);
+
+		/// <summary>
+		/// Gets if the world matrix needs to be rebuilt.
+		/// </summary>
+		/// <returns> If this transform is dirty. </returns>
+		bool IsDirty() const { return m_dirty; }
+
+		/// <summary>
+		/// Gets if the cached world matrix is out of date, because this transform or one of its parents is dirty.
+		/// </summary>
+		/// <returns> If the cached world matrix is out of date. </returns>
+		bool IsStale() const { return m_dirty || (m_parent != nullptr && m_parent->IsStale()); }
+
+		/// <summary>
+		/// Gets a counter that is incremented every time the cached world matrix is rebuilt, data derived from the world matrix
+		/// can be cached until it changes.
+		/// </summary>
+		/// <returns> The world matrix version. </returns>
+		uint32_t GetVersion() const { return m_version; }
 
 		void Decode(const Metadata &metadata);
 
 		void Encode(Metadata &metadata) const;
 
+		Transform &operator=(const Transform &other);
+
 		bool operator==(const Transform &other) const;
 
 		bool operator!=(const Transform &other) const;
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include "Engine/Exports.hpp"
@@ -48,7 +51,12 @@ namespace acid
 		/// <summary>
 		/// Constructor for Vector3.
 		/// </summary>
-		Vector3();
+		Vector3() :
+			m_x(0.0f),
+			m_y(0.0f),
+			m_z(0.0f)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -56,7 +64,12 @@ namespace acid
 		/// <param name="x"> Start x. </param>
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
-		Vector3(const float &x, const float &y, const float &z);
+		Vector3(const float &x, const float &y, const float &z) :
+			m_x(x),
+			m_y(y),
+			m_z(z)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -69,7 +82,7 @@ namespace acid
 		/// Constructor for Vector3.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Vector3(const Vector3 &source);
+		Vector3(const Vector3 &source) = default;
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -83,35 +96,35 @@ namespace acid
 		/// <param name="source"> Creates this vector out of a existing colour. </param>
 		Vector3(const Colour &source);
 
-		~Vector3();
+		~Vector3() = default;
 
 		/// <summary>
 		/// Adds this vector to another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector3 Add(const Vector3 &other) const;
+		Vector3 Add(const Vector3 &other) const { return Vector3(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z); }
 
 		/// <summary>
 		/// Subtracts this vector to another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector3 Subtract(const Vector3 &other) const;
+		Vector3 Subtract(const Vector3 &other) const { return Vector3(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z); }
 
 		/// <summary>
 		/// Multiplies this vector with another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector3 Multiply(const Vector3 &other) const;
+		Vector3 Multiply(const Vector3 &other) const { return Vector3(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z); }
 
 		/// <summary>
 		/// Divides this vector by another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector3 Divide(const Vector3 &other) const;
+		Vector3 Divide(const Vector3 &other) const { return Vector3(m_x / other.m_x, m_y / other.m_y, m_z / other.m_z); }
 
 		/// <summary>
 		/// Calculates the angle between this vector and another vector.
@@ -125,21 +138,21 @@ namespace acid
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The dot product. </returns>
-		float Dot(const Vector3 &other) const;
+		float Dot(const Vector3 &other) const { return m_x * other.m_x + m_y * other.m_y; }
 
 		/// <summary>
 		/// Calculates the cross product of the this vector and another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The cross product. </returns>
-		Vector3 Cross(const Vector3 &other) const;
+		Vector3 Cross(const Vector3 &other) const { return Vector3(m_y * other.m_z - m_z * other.m_y, other.m_x * m_z - other.m_z * m_x, m_x * other.m_y - m_y * other.m_x); }
 
 		/// <summary>
 		/// Scales this vector by a scalar.
 		/// </summary>
 		/// <param name="scalar"> The scalar value. </param>
 		/// <returns> The scaled vector. </returns>
-		Vector3 Scale(const float &scalar) const;
+		Vector3 Scale(const float &scalar) const { return Vector3(m_x * scalar, m_y * scalar, m_z * scalar); }
 
 		/// <summary>
 		/// Rotates this vector by a angle around the origin.
@@ -152,25 +165,29 @@ namespace acid
 		/// Negates this vector.
 		/// </summary>
 		/// <returns> The negated vector. </returns>
-		Vector3 Negate() const;
+		Vector3 Negate() const { return Vector3(-m_x, -m_y, -m_z); }
 
 		/// <summary>
 		/// Normalizes this vector.
 		/// </summary>
 		/// <returns> The normalized vector. </returns>
-		Vector3 Normalize() const;
+		Vector3 Normalize() const
+		{
+			float l = Length();
+			return Vector3(m_x / l, m_y / l, m_z / l);
+		}
 
 		/// <summary>
 		/// Gets the length squared of this vector.
 		/// </summary>
 		/// <returns> The length squared. </returns>
-		float LengthSquared() const;
+		float LengthSquared() const { return m_x * m_x + m_y * m_y + m_z * m_z; }
 
 		/// <summary>
 		/// Gets the length of this vector.
 		/// </summary>
 		/// <returns> The length. </returns>
-		float Length() const;
+		float Length() const { return std::sqrt(LengthSquared()); }
 
 		/// <summary>
 		/// Gets the maximum value in this vector.
@@ -301,9 +318,9 @@ namespace acid
 
 		void Encode(Metadata &metadata) const;
 
-		bool operator==(const Vector3 &other) const;
+		bool operator==(const Vector3 &other) const { return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z; }
 
-		bool operator!=(const Vector3 &other) const;
+		bool operator!=(const Vector3 &other) const { return !(*this == other); }
 
 		bool operator<(const Vector3 &other) const;
 
@@ -313,55 +330,63 @@ namespace acid
 
 		bool operator>=(const Vector3 &other) const;
 
-		bool operator==(const float &value) const;
+		bool operator==(const float &value) const { return m_x == value && m_y == value && m_z == value; }
 
-		bool operator!=(const float &value) const;
+		bool operator!=(const float &value) const { return !(*this == value); }
 
-		Vector3 operator-() const;
+		Vector3 operator-() const { return Negate(); }
 
-		const float &operator[](const uint32_t &index) const;
+		const float &operator[](const uint32_t &index) const
+		{
+			assert(index < 3);
+			return m_elements[index];
+		}
 
-		float &operator[](const uint32_t &index);
+		float &operator[](const uint32_t &index)
+		{
+			assert(index < 3);
+			return m_elements[index];
+		}
 
-		ACID_EXPORT friend Vector3 operator+(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator+(const Vector3 &left, const Vector3 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Vector3 operator-(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator-(const Vector3 &left, const Vector3 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator*(const Vector3 &left, const Vector3 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator/(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator/(const Vector3 &left, const Vector3 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Vector3 operator+(const float &left, const Vector3 &right);
+		friend Vector3 operator+(const float &left, const Vector3 &right) { return Vector3(left, left, left).Add(right); }
 
-		ACID_EXPORT friend Vector3 operator-(const float &left, const Vector3 &right);
+		friend Vector3 operator-(const float &left, const Vector3 &right) { return Vector3(left, left, left).Subtract(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const float &left, const Vector3 &right);
+		friend Vector3 operator*(const float &left, const Vector3 &right) { return Vector3(left, left, left).Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator/(const float &left, const Vector3 &right);
+		friend Vector3 operator/(const float &left, const Vector3 &right) { return Vector3(left, left, left).Divide(right); }
 
-		ACID_EXPORT friend Vector3 operator+(const Vector3 &left, const float &right);
+		friend Vector3 operator+(const Vector3 &left, const float &right) { return left.Add(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator-(const Vector3 &left, const float &right);
+		friend Vector3 operator-(const Vector3 &left, const float &right) { return left.Subtract(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &left, const float &right);
+		friend Vector3 operator*(const Vector3 &left, const float &right) { return left.Multiply(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator/(const Vector3 &left, const float &right);
+		friend Vector3 operator/(const Vector3 &left, const float &right) { return left.Divide(Vector3(right, right, right)); }
 
-		Vector3 &operator+=(const Vector3 &other);
+		Vector3 &operator+=(const Vector3 &other) { return *this = Add(other); }
 
-		Vector3 &operator-=(const Vector3 &other);
+		Vector3 &operator-=(const Vector3 &other) { return *this = Subtract(other); }
 
-		Vector3 &operator*=(const Vector3 &other);
+		Vector3 &operator*=(const Vector3 &other) { return *this = Multiply(other); }
 
-		Vector3 &operator/=(const Vector3 &other);
+		Vector3 &operator/=(const Vector3 &other) { return *this = Divide(other); }
 
-		Vector3 &operator+=(const float &other);
+		Vector3 &operator+=(const float &other) { return *this = Add(Vector3(other, other, other)); }
 
-		Vector3 &operator-=(const float &other);
+		Vector3 &operator-=(const float &other) { return *this = Subtract(Vector3(other, other, other)); }
 
-		Vector3 &operator*=(const float &other);
+		Vector3 &operator*=(const float &other) { return *this = Multiply(Vector3(other, other, other)); }
 
-		Vector3 &operator/=(const float &other);
+		Vector3 &operator/=(const float &other) { return *this = Divide(Vector3(other, other, other)); }
 
 		ACID_EXPORT friend std::ostream &operator<<(std::ostream &stream, const Vector3 &vector);
 
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include "Engine/Exports.hpp"
 #include "Serialized/Metadata.hpp"
+#include "Simd.hpp"
 
 namespace acid
 {
@@ -38,7 +42,13 @@ namespace acid
 		/// <summary>
 		/// Constructor for Vector4.
 		/// </summary>
-		Vector4();
+		Vector4() :
+			m_x(0.0f),
+			m_y(0.0f),
+			m_z(0.0f),
+			m_w(1.0f)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -47,7 +57,13 @@ namespace acid
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
 		/// <param name="w"> Start w. </param>
-		Vector4(const float &x, const float &y, const float &z, const float &w);
+		Vector4(const float &x, const float &y, const float &z, const float &w) :
+			m_x(x),
+			m_y(y),
+			m_z(z),
+			m_w(w)
+		{
+		}
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -60,7 +76,7 @@ namespace acid
 		/// Constructor for Vector4.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Vector4(const Vector4 &source);
+		Vector4(const Vector4 &source) = default;
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -68,35 +84,83 @@ namespace acid
 		/// <param name="source"> Creates this vector out of a existing colour. </param>
 		Vector4(const Colour &source);
 
-		~Vector4();
+		~Vector4() = default;
+
+#if ACID_SIMD_SSE
+		/// <summary>
+		/// Loads this vector into a SSE register.
+		/// </summary>
+		/// <returns> The register. </returns>
+		__m128 ToSimd() const { return _mm_loadu_ps(m_elements); }
+
+		/// <summary>
+		/// Creates a vector from a SSE register.
+		/// </summary>
+		/// <param name="value"> The register. </param>
+		/// <returns> The vector. </returns>
+		static Vector4 FromSimd(const __m128 &value)
+		{
+			Vector4 result;
+			_mm_storeu_ps(result.m_elements, value);
+			return result;
+		}
+#endif
 
 		/// <summary>
 		/// Adds this vector to another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Add(const Vector4 &other) const;
+		Vector4 Add(const Vector4 &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_add_ps(ToSimd(), other.ToSimd()));
+#else
+			return Vector4(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z, m_w + other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Subtracts this vector to another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Subtract(const Vector4 &other) const;
+		Vector4 Subtract(const Vector4 &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_sub_ps(ToSimd(), other.ToSimd()));
+#else
+			return Vector4(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z, m_w - other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Multiplies this vector with another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Multiply(const Vector4 &other) const;
+		Vector4 Multiply(const Vector4 &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_mul_ps(ToSimd(), other.ToSimd()));
+#else
+			return Vector4(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z, m_w * other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Divides this vector by another vector.
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The resultant vector. </returns>
-		Vector4 Divide(const Vector4 &other) const;
+		Vector4 Divide(const Vector4 &other) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_div_ps(ToSimd(), other.ToSimd()));
+#else
+			return Vector4(m_x / other.m_x, m_y / other.m_y, m_z / other.m_z, m_w / other.m_w);
+#endif
+		}
 
 		/// <summary>
 		/// Calculates the angle between this vector and another vector.
@@ -110,38 +174,49 @@ namespace acid
 		/// </summary>
 		/// <param name="other"> The other vector. </param>
 		/// <returns> The dot product. </returns>
-		float Dot(const Vector4 &other) const;
+		float Dot(const Vector4 &other) const { return m_x * other.m_x + m_y * other.m_y + m_w * other.m_w; }
 
 		/// <summary>
 		/// Scales this vector by a scalar.
 		/// </summary>
 		/// <param name="scalar"> The scalar value. </param>
 		/// <returns> The scaled vector. </returns>
-		Vector4 Scale(const float &scalar) const;
+		Vector4 Scale(const float &scalar) const
+		{
+#if ACID_SIMD_SSE
+			return FromSimd(_mm_mul_ps(ToSimd(), _mm_set1_ps(scalar)));
+#else
+			return Vector4(m_x * scalar, m_y * scalar, m_z * scalar, m_w * scalar);
+#endif
+		}
 
 		/// <summary>
 		/// Negates this vector.
 		/// </summary>
 		/// <returns> The negated vector. </returns>
-		Vector4 Negate() const;
+		Vector4 Negate() const { return Vector4(-m_x, -m_y, -m_z, -m_w); }
 
 		/// <summary>
 		/// Normalizes this vector.
 		/// </summary>
 		/// <returns> The normalized vector. </returns>
-		Vector4 Normalize() const;
+		Vector4 Normalize() const
+		{
+			float l = Length();
+			return Vector4(m_x / l, m_y / l, m_z / l, m_w / l);
+		}
 
 		/// <summary>
 		/// Gets the length squared of this vector.
 		/// </summary>
 		/// <returns> The length squared. </returns>
-		float LengthSquared() const;
+		float LengthSquared() const { return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w; }
 
 		/// <summary>
 		/// Gets the length of this vector.
 		/// </summary>
 		/// <returns> The length. </returns>
-		float Length() const;
+		float Length() const { return std::sqrt(LengthSquared()); }
 
 		/// <summary>
 		/// Gets the maximum value in this vector.
@@ -204,9 +279,9 @@ namespace acid
 
 		void Encode(Metadata &metadata) const;
 
-		bool operator==(const Vector4 &other) const;
+		bool operator==(const Vector4 &other) const { return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z && m_w == other.m_w; }
 
-		bool operator!=(const Vector4 &other) const;
+		bool operator!=(const Vector4 &other) const { return !(*this == other); }
 
 		bool operator<(const Vector4 &other) const;
 
@@ -216,55 +291,63 @@ namespace acid
 
 		bool operator>=(const Vector4 &other) const;
 
-		bool operator==(const float &value) const;
+		bool operator==(const float &value) const { return m_x == value && m_y == value && m_z == value && m_w == value; }
 
-		bool operator!=(const float &value) const;
+		bool operator!=(const float &value) const { return !(*this == value); }
 
-		Vector4 operator-() const;
+		Vector4 operator-() const { return Negate(); }
 
-		const float &operator[](const uint32_t &index) const;
+		const float &operator[](const uint32_t &index) const
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
-		float &operator[](const uint32_t &index);
+		float &operator[](const uint32_t &index)
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
-		ACID_EXPORT friend Vector4 operator+(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator+(const Vector4 &left, const Vector4 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Vector4 operator-(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator-(const Vector4 &left, const Vector4 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Vector4 operator*(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator*(const Vector4 &left, const Vector4 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector4 operator/(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator/(const Vector4 &left, const Vector4 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Vector4 operator+(const float &left, const Vector4 &right);
+		friend Vector4 operator+(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Add(right); }
 
-		ACID_EXPORT friend Vector4 operator-(const float &left, const Vector4 &right);
+		friend Vector4 operator-(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Subtract(right); }
 
-		ACID_EXPORT friend Vector4 operator*(const float &left, const Vector4 &right);
+		friend Vector4 operator*(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Multiply(right); }
 
-		ACID_EXPORT friend Vector4 operator/(const float &left, const Vector4 &right);
+		friend Vector4 operator/(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Divide(right); }
 
-		ACID_EXPORT friend Vector4 operator+(const Vector4 &left, const float &right);
+		friend Vector4 operator+(const Vector4 &left, const float &right) { return left.Add(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator-(const Vector4 &left, const float &right);
+		friend Vector4 operator-(const Vector4 &left, const float &right) { return left.Subtract(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator*(const Vector4 &left, const float &right);
+		friend Vector4 operator*(const Vector4 &left, const float &right) { return left.Multiply(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator/(const Vector4 &left, const float &right);
+		friend Vector4 operator/(const Vector4 &left, const float &right) { return left.Divide(Vector4(right, right, right, right)); }
 
-		Vector4 &operator+=(const Vector4 &other);
+		Vector4 &operator+=(const Vector4 &other) { return *this = Add(other); }
 
-		Vector4 &operator-=(const Vector4 &other);
+		Vector4 &operator-=(const Vector4 &other) { return *this = Subtract(other); }
 
-		Vector4 &operator*=(const Vector4 &other);
+		Vector4 &operator*=(const Vector4 &other) { return *this = Multiply(other); }
 
-		Vector4 &operator/=(const Vector4 &other);
+		Vector4 &operator/=(const Vector4 &other) { return *this = Divide(other); }
 
-		Vector4 &operator+=(const float &other);
+		Vector4 &operator+=(const float &other) { return *this = Add(Vector4(other, other, other, other)); }
 
-		Vector4 &operator-=(const float &other);
+		Vector4 &operator-=(const float &other) { return *this = Subtract(Vector4(other, other, other, other)); }
 
-		Vector4 &operator*=(const float &other);
+		Vector4 &operator*=(const float &other) { return *this = Multiply(Vector4(other, other, other, other)); }
 
-		Vector4 &operator/=(const float &other);
+		Vector4 &operator/=(const float &other) { return *this = Divide(Vector4(other, other, other, other)); }
 
 		ACID_EXPORT friend std::ostream &operator<<(std::ostream &stream, const Vector4 &vector);
 
@@ -0,0 +1,165 @@
+#include "InstanceBatch.hpp"
+
+#include "Objects/GameObject.hpp"
+#include "Renderer/Renderer.hpp"
+#include "MeshRender.hpp"
+
+namespace acid
+{
+	InstanceBatch::InstanceBatch() :
+		m_descriptorSet(DescriptorsHandler()),
+		m_descriptorCull(DescriptorsHandler()),
+		m_uniformCull(UniformHandler()),
+		m_frames(std::vector<Frame>()),
+		m_instances(std::vector<char>()),
+		m_material(nullptr),
+		m_model(nullptr),
+		m_instanceCount(0),
+		m_culled(false)
+	{
+	}
+
+	InstanceBatch::~InstanceBatch()
+	{
+	}
+
+	void InstanceBatch::CmdCull(const CommandBuffer &commandBuffer, const Compute &compute, const Frustum &frustum, const std::vector<MeshRender *> &meshRenders)
+	{
+		m_material = meshRenders.front()->GetGameObject()->GetComponent<IMaterial>();
+		m_model = meshRenders.front()->GetGameObject()->GetComponent<Mesh>()->GetModel();
+		m_instanceCount = static_cast<uint32_t>(meshRenders.size());
+		m_culled = false;
+
+		// Writes every instance, then copies them into this frames storage buffer.
+		std::size_t instanceSize = m_material->GetInstanceSize();
+		m_instances.resize(instanceSize * meshRenders.size());
+
+		for (std::size_t i = 0; i < meshRenders.size(); i++)
+		{
+			meshRenders[i]->GetGameObject()->GetComponent<IMaterial>()->WriteInstance(&m_instances[i * instanceSize]);
+		}
+
+		auto &frame = GetFrame(static_cast<VkDeviceSize>(m_instances.size()));
+		frame.m_instances->Update(m_instances.data(), static_cast<VkDeviceSize>(m_instances.size()));
+
+		// Models without indices or loaded bounds cannot be culled, every instance is drawn.
+		Aabb bounds = Aabb(m_model->GetMinExtents(), m_model->GetMaxExtents());
+
+		if (m_model->GetIndexBuffer() == nullptr || bounds.IsEmpty())
+		{
+			return;
+		}
+
+		m_uniformCull.Push("frustum", frustum.GetPlanes());
+		m_uniformCull.Push("boundsMin", Vector4(bounds.m_min));
+		m_uniformCull.Push("boundsMax", Vector4(bounds.m_max));
+		m_uniformCull.Push("instanceCount", m_instanceCount);
+		m_uniformCull.Push("instanceStride", static_cast<uint32_t>(instanceSize / sizeof(uint32_t)));
+
+		m_descriptorCull.Push("UboCull", m_uniformCull);
+		m_descriptorCull.Push("Instances", frame.m_instances.get());
+		m_descriptorCull.Push("Visible", frame.m_visible.get());
+		m_descriptorCull.Push("Draw", frame.m_draw.get());
+		bool updateSuccess = m_descriptorCull.Update(compute);
+
+		if (!updateSuccess)
+		{
+			return;
+		}
+
+		// Resets the draw inside the command buffer, the instance count is then counted up by the compute shader.
+		VkDrawIndexedIndirectCommand drawCommand = {};
+		drawCommand.indexCount = m_model->GetIndexBuffer()->GetIndexCount();
+		vkCmdUpdateBuffer(commandBuffer.GetCommandBuffer(), frame.m_draw->GetBuffer(), 0, sizeof(VkDrawIndexedIndirectCommand), &drawCommand);
+
+		VkMemoryBarrier resetBarrier = {};
+		resetBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		resetBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		resetBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+			1, &resetBarrier, 0, nullptr, 0, nullptr);
+
+		compute.BindPipeline(commandBuffer);
+		m_descriptorCull.BindDescriptor(commandBuffer);
+		compute.CmdRender(commandBuffer, m_instanceCount, 1);
+
+		// The draw reads the command and the compacted instances written by the compute shader.
+		VkMemoryBarrier cullBarrier = {};
+		cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+			1, &cullBarrier, 0, nullptr, 0, nullptr);
+
+		m_culled = true;
+	}
+
+	void InstanceBatch::CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene)
+	{
+		auto instancedMaterial = m_material->GetInstancedMaterial();
+
+		// Skips the draw while the instanced pipeline is still being built.
+		if (!instancedMaterial->IsReady())
+		{
+			return;
+		}
+
+		auto &frame = m_frames[Renderer::Get()->GetFrameIndex() % m_frames.size()];
+
+		// Binds the instanced pipeline.
+		instancedMaterial->GetPipeline().BindPipeline(commandBuffer);
+
+		// Updates descriptors, culled batches read the instances compacted by the compute shader.
+		m_descriptorSet.Push("UboScene", uniformScene);
+		m_descriptorSet.Push("Instances", m_culled ? frame.m_visible.get() : frame.m_instances.get());
+		m_material->PushDescriptors(m_descriptorSet);
+		bool updateSuccess = m_descriptorSet.Update(instancedMaterial->GetPipeline());
+
+		if (!updateSuccess)
+		{
+			return;
+		}
+
+		// Draws every visible object.
+		m_descriptorSet.BindDescriptor(commandBuffer);
+
+		if (m_culled)
+		{
+			m_model->CmdRenderIndirect(commandBuffer, frame.m_draw->GetBuffer());
+		}
+		else
+		{
+			m_model->CmdRender(commandBuffer, m_instanceCount);
+		}
+	}
+
+	InstanceBatch::Frame &InstanceBatch::GetFrame(const VkDeviceSize &size)
+	{
+		auto renderer = Renderer::Get();
+
+		if (m_frames.size() != renderer->GetFramesInFlight())
+		{
+			m_frames.clear();
+			m_frames.resize(renderer->GetFramesInFlight());
+		}
+
+		// The buffers of the frame being recorded are no longer read by the GPU, they are doubled when too small.
+		auto &frame = m_frames[renderer->GetFrameIndex() % m_frames.size()];
+
+		if (frame.m_instances == nullptr || frame.m_instances->GetSize() < size)
+		{
+			VkDeviceSize newSize = frame.m_instances == nullptr ? size : std::max(size, 2 * frame.m_instances->GetSize());
+			frame.m_instances = std::make_unique<StorageBuffer>(newSize);
+			frame.m_visible = std::make_unique<StorageBuffer>(newSize);
+		}
+
+		if (frame.m_draw == nullptr)
+		{
+			frame.m_draw = std::make_unique<StorageBuffer>(sizeof(VkDrawIndexedIndirectCommand),
+				VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+		}
+
+		return frame;
+	}
+}
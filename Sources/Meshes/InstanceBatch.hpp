@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Materials/IMaterial.hpp"
+#include "Models/Model.hpp"
+#include "Physics/Frustum.hpp"
+#include "Renderer/Buffers/StorageBuffer.hpp"
+#include "Renderer/Handlers/DescriptorsHandler.hpp"
+#include "Renderer/Handlers/UniformHandler.hpp"
+#include "Renderer/Pipelines/Compute.hpp"
+
+namespace acid
+{
+	class MeshRender;
+
+	/// <summary>
+	/// Draws a group of mesh renders sharing a model and an instanced material in one draw, their per object data is
+	/// written into a storage buffer indexed by the instance index. A compute shader culls the instances against the view
+	/// frustum, compacting the visible ones and writing the instance count of an indirect draw.
+	/// </summary>
+	class ACID_EXPORT InstanceBatch
+	{
+	private:
+		/// <summary>
+		/// The buffers written and read by one frame in flight.
+		/// </summary>
+		struct Frame
+		{
+			std::unique_ptr<StorageBuffer> m_instances;
+			std::unique_ptr<StorageBuffer> m_visible;
+			std::unique_ptr<StorageBuffer> m_draw;
+		};
+
+		DescriptorsHandler m_descriptorSet;
+		DescriptorsHandler m_descriptorCull;
+		UniformHandler m_uniformCull;
+		std::vector<Frame> m_frames;
+		std::vector<char> m_instances;
+		std::shared_ptr<IMaterial> m_material;
+		std::shared_ptr<Model> m_model;
+		uint32_t m_instanceCount;
+		bool m_culled;
+	public:
+		InstanceBatch();
+
+		~InstanceBatch();
+
+		/// <summary>
+		/// Writes the instances of a group, and records the compute pass that culls them. Must be recorded outside of a
+		/// render pass, before the batch is drawn.
+		/// </summary>
+		/// <param name="commandBuffer"> The command buffer to record into. </param>
+		/// <param name="compute"> The culling compute pipeline. </param>
+		/// <param name="frustum"> The view frustum. </param>
+		/// <param name="meshRenders"> The mesh renders of the group, the materials must be instance compatible. </param>
+		void CmdCull(const CommandBuffer &commandBuffer, const Compute &compute, const Frustum &frustum, const std::vector<MeshRender *> &meshRenders);
+
+		/// <summary>
+		/// Records the instanced draw of the group last culled, the first mesh render provides the model, pipeline and
+		/// textures. When the cull could not be recorded every instance is drawn.
+		/// </summary>
+		/// <param name="commandBuffer"> The command buffer to record into. </param>
+		/// <param name="uniformScene"> The scene uniform. </param>
+		void CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene);
+	private:
+		Frame &GetFrame(const VkDeviceSize &size);
+	};
+}
@@ -1,6 +1,7 @@
 #include "Mesh.hpp"
 
 #include "Helpers/FileSystem.hpp"
+#include "Models/Baked/ModelBaked.hpp"
 #include "Models/Shapes/ModelCube.hpp"
 #include "Models/Shapes/ModelCylinder.hpp"
 #include "Models/Shapes/ModelDisk.hpp"
@@ -96,6 +97,12 @@ namespace acid
 			return;
 		}
 
+		if (FileSystem::FindExt(filename) == "acidmesh")
+		{
+			m_model = ModelBaked::Resource(filename);
+			return;
+		}
+
 		Log::Error("Could not determine mesh model type: '%s'\n", filename.c_str());
 	}
 }
@@ -34,18 +34,7 @@ namespace acid
 
 	void MeshRender::CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage)
 	{
-		// Checks if the mesh is in view.
-		/*auto shape = GetGameObject()->GetComponent<Collider>();
-
-		if (shape != nullptr)
-		{
-			if (!shape->InFrustum(Scenes::Get()->GetCamera()->GetViewFrustum()))
-			{
-				return;
-			}
-		}*/
-
-		// Gets required components.
+		// Gets required components, meshes out of view have already been culled by the renderer.
 		auto material = GetGameObject()->GetComponent<IMaterial>();
 		auto mesh = GetGameObject()->GetComponent<Mesh>();
 
@@ -59,6 +48,12 @@ namespace acid
 			return;
 		}
 
+		// Skips the draw while the material pipeline is still being built.
+		if (!material->GetMaterial()->IsReady())
+		{
+			return;
+		}
+
 		// Binds the material pipeline.
 		material->GetMaterial()->GetPipeline().BindPipeline(commandBuffer);
 
@@ -85,14 +80,4 @@ namespace acid
 	void MeshRender::Encode(Metadata &metadata) const
 	{
 	}
-
-	bool MeshRender::operator<(const MeshRender &other) const
-	{
-		auto camera = Scenes::Get()->GetCamera();
-
-		float thisDistance2 = (camera->GetPosition() - GetGameObject()->GetTransform().GetPosition()).LengthSquared();
-		float otherDistance2 = (camera->GetPosition() - other.GetGameObject()->GetTransform().GetPosition()).LengthSquared();
-
-		return thisDistance2 > otherDistance2;
-	}
 }
@@ -27,7 +27,5 @@ namespace acid
 		void CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage);
 
 		UniformHandler GetUniformObject() const { return m_uniformObject; }
-
-		bool operator<(const MeshRender &other) const;
 	};
 }
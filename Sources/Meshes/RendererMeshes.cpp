@@ -1,42 +1,241 @@
 ﻿#include "RendererMeshes.hpp"
 
+#include <map>
+#include <unordered_map>
+#include "Helpers/RadixSort.hpp"
+#include "Objects/GameObject.hpp"
+#include "Physics/FrustumCuller.hpp"
 #include "Scenes/Scenes.hpp"
 #include "MeshRender.hpp"
 
 namespace acid
 {
+	const uint32_t RendererMeshes::MESHES_PER_CHUNK = 256;
+	const uint64_t RendererMeshes::PIPELINE_ID_MASK = 0x7FFF;
+	const uint64_t RendererMeshes::MODEL_ID_MASK = 0xFFFF;
+	const uint32_t RendererMeshes::CULL_WORKGROUP_SIZE = 64;
+
 	RendererMeshes::RendererMeshes(const GraphicsStage &graphicsStage, const MeshSort &meshSort) :
 		IRenderer(graphicsStage),
 		m_meshSort(meshSort),
-		m_uniformScene(UniformHandler(true))
+		m_uniformScene(UniformHandler(true)),
+		m_compute(nullptr),
+		m_batches(std::vector<std::unique_ptr<InstanceBatch>>()),
+		m_batchCount(0),
+		m_meshRenders(std::vector<MeshRender *>())
 	{
+		// Only unsorted renderers instance, so only they cull on the GPU.
+		if (m_meshSort == SORT_NONE)
+		{
+			m_compute = std::make_unique<Compute>(ComputeCreate("Shaders/Defaults/Culling.comp", 1, 1, CULL_WORKGROUP_SIZE));
+		}
 	}
 
 	RendererMeshes::~RendererMeshes()
 	{
 	}
 
-	void RendererMeshes::Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera)
+	void RendererMeshes::RenderCompute(const CommandBuffer &commandBuffer, const ICamera &camera)
 	{
 		m_uniformScene.Push("projection", camera.GetProjectionMatrix());
 		m_uniformScene.Push("view", camera.GetViewMatrix());
 		m_uniformScene.Push("cameraPos", camera.GetPosition());
 
-		auto sceneMeshRenders = Scenes::Get()->GetStructure()->QueryComponents<MeshRender>();
+		// Instanced runs are culled on the GPU, the mesh renders left are culled here and drawn one at a time.
+		auto frustum = camera.GetViewFrustum();
+		auto &sceneMeshRenders = Scenes::Get()->GetStructure()->QueryComponents<MeshRender>();
+		std::vector<MeshRender *> singles;
+		auto runs = GetInstanceRuns(sceneMeshRenders, singles);
+		m_meshRenders = SortMeshRenders(FrustumCuller(frustum).Cull(singles), camera);
+		m_batchCount = 0;
+
+		for (auto &run : runs)
+		{
+			if (m_batchCount == m_batches.size())
+			{
+				m_batches.emplace_back(std::make_unique<InstanceBatch>());
+			}
+
+			m_batches[m_batchCount++]->CmdCull(commandBuffer, *m_compute, frustum, run);
+		}
+	}
+
+	void RendererMeshes::Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera)
+	{
+		for (uint32_t i = 0; i < m_batchCount; i++)
+		{
+			m_batches[i]->CmdRender(commandBuffer, m_uniformScene);
+		}
+
+		for (auto &meshRender : m_meshRenders)
+		{
+			meshRender->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
+		}
+	}
+
+	std::vector<std::shared_ptr<CommandBuffer>> RendererMeshes::RenderSecondary(const Vector4 &clipPlane, const ICamera &camera)
+	{
+		// The scene uniform is shared by every chunk, until its block is known the first draw creates it on one thread.
+		if (m_meshRenders.size() <= MESHES_PER_CHUNK || m_uniformScene.GetUniformBlock() == nullptr)
+		{
+			return IRenderer::RenderSecondary(clipPlane, camera);
+		}
+
+		// Writes the scene uniform before the chunks, so they only read it.
+		m_uniformScene.Update(m_uniformScene.GetUniformBlock());
+
+		// Instance batches were culled before the render pass, their draws are recorded on this thread before the chunks.
+		auto instancesCommandBuffer = Renderer::Get()->BeginSecondary();
+
+		for (uint32_t i = 0; i < m_batchCount; i++)
+		{
+			m_batches[i]->CmdRender(*instancesCommandBuffer, m_uniformScene);
+		}
+
+		instancesCommandBuffer->End();
+
+		auto chunkCount = static_cast<uint32_t>((m_meshRenders.size() + MESHES_PER_CHUNK - 1) / MESHES_PER_CHUNK);
+		std::vector<std::shared_ptr<CommandBuffer>> commandBuffers(chunkCount + 1);
+		commandBuffers[0] = instancesCommandBuffer;
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		auto handle = threadPool.ParallelFor(0, static_cast<uint32_t>(m_meshRenders.size()), [&](uint32_t begin, uint32_t end)
+		{
+			auto commandBuffer = Renderer::Get()->BeginSecondary();
+
+			for (uint32_t i = begin; i < end; i++)
+			{
+				m_meshRenders[i]->CmdRender(*commandBuffer, m_uniformScene, GetGraphicsStage());
+			}
+
+			commandBuffer->End();
+			commandBuffers[1 + begin / MESHES_PER_CHUNK] = commandBuffer;
+		}, MESHES_PER_CHUNK);
+		threadPool.Wait(handle);
+
+		return commandBuffers;
+	}
+
+	std::vector<MeshRender *> RendererMeshes::SortMeshRenders(const std::vector<MeshRender *> &meshRenders, const ICamera &camera)
+	{
+		// Builds a key per draw once, pipelines and models get small ids in the order they are first seen this frame.
+		std::unordered_map<PipelineMaterial *, uint64_t> pipelineIds;
+		std::unordered_map<Model *, uint64_t> modelIds;
+		std::vector<MeshRender *> drawable;
+		std::vector<uint64_t> keys;
+		drawable.reserve(meshRenders.size());
+		keys.reserve(meshRenders.size());
+
+		for (auto &meshRender : meshRenders)
+		{
+			auto material = meshRender->GetGameObject()->GetComponent<IMaterial>();
+			auto mesh = meshRender->GetGameObject()->GetComponent<Mesh>();
+
+			if (material == nullptr || mesh == nullptr || mesh->GetModel() == nullptr ||
+				material->GetMaterial()->GetPipeline().GetGraphicsStage() != GetGraphicsStage())
+			{
+				continue;
+			}
+
+			uint64_t pipelineId = pipelineIds.emplace(material->GetMaterial().get(), pipelineIds.size()).first->second;
+			uint64_t modelId = modelIds.emplace(mesh->GetModel().get(), modelIds.size()).first->second;
+			uint64_t bindKey = (std::min(pipelineId, PIPELINE_ID_MASK) << 16) | std::min(modelId, MODEL_ID_MASK);
+
+			// Non negative floats order the same as their bits.
+			float distance2 = (camera.GetPosition() - meshRender->GetGameObject()->GetTransform().GetPosition()).LengthSquared();
+			uint32_t depth = 0;
+			memcpy(&depth, &distance2, sizeof(depth));
+
+			switch (m_meshSort)
+			{
+			case SORT_NONE:
+				// Groups binds first, then draws front to back inside a bind to help early depth testing.
+				keys.emplace_back((bindKey << 32) | depth);
+				break;
+			case SORT_FRONT:
+				keys.emplace_back((static_cast<uint64_t>(depth) << 32) | bindKey);
+				break;
+			case SORT_BACK:
+				keys.emplace_back((static_cast<uint64_t>(~depth) << 32) | bindKey);
+				break;
+			}
+
+			drawable.emplace_back(meshRender);
+		}
+
+		auto result = std::vector<MeshRender *>();
+		result.reserve(drawable.size());
+
+		for (auto &index : RadixSort::SortIndices(keys))
+		{
+			result.emplace_back(drawable[index]);
+		}
+
+		return result;
+	}
+
+	std::vector<std::vector<MeshRender *>> RendererMeshes::GetInstanceRuns(const std::vector<MeshRender *> &meshRenders, std::vector<MeshRender *> &singles)
+	{
+		auto result = std::vector<std::vector<MeshRender *>>();
 
 		if (m_meshSort != SORT_NONE)
 		{
-			std::sort(sceneMeshRenders.begin(), sceneMeshRenders.end());
+			singles = meshRenders;
+			return result;
+		}
+
+		// Groups by instanced pipeline and model, each group is split again into runs of compatible materials.
+		std::map<std::pair<PipelineMaterial *, Model *>, std::vector<std::vector<MeshRender *>>> groups;
+		singles.reserve(meshRenders.size());
+
+		for (auto &meshRender : meshRenders)
+		{
+			if (!meshRender->IsEnabled())
+			{
+				continue;
+			}
+
+			auto material = meshRender->GetGameObject()->GetComponent<IMaterial>();
+			auto mesh = meshRender->GetGameObject()->GetComponent<Mesh>();
+
+			if (material == nullptr || mesh == nullptr || mesh->GetModel() == nullptr || material->GetInstancedMaterial() == nullptr ||
+				material->GetInstancedMaterial()->GetPipeline().GetGraphicsStage() != GetGraphicsStage())
+			{
+				singles.emplace_back(meshRender);
+				continue;
+			}
+
+			auto &runs = groups[std::make_pair(material->GetInstancedMaterial().get(), mesh->GetModel().get())];
+			auto it = std::find_if(runs.begin(), runs.end(), [&](const std::vector<MeshRender *> &run)
+			{
+				return run.front()->GetGameObject()->GetComponent<IMaterial>()->IsInstanceCompatible(*material);
+			});
 
-			if (m_meshSort == SORT_FRONT)
+			if (it == runs.end())
+			{
+				runs.emplace_back(std::vector<MeshRender *>{meshRender});
+			}
+			else
 			{
-				std::reverse(sceneMeshRenders.begin(), sceneMeshRenders.end());
+				it->emplace_back(meshRender);
 			}
 		}
 
-		for (auto &meshRender : sceneMeshRenders)
+		for (auto &[key, runs] : groups)
 		{
-			meshRender->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
+			for (auto &run : runs)
+			{
+				// An instance buffer costs more than a uniform for a lone object.
+				if (run.size() < 2)
+				{
+					singles.emplace_back(run.front());
+					continue;
+				}
+
+				result.emplace_back(std::move(run));
+			}
 		}
+
+		return result;
 	}
 }
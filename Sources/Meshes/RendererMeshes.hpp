@@ -3,7 +3,9 @@
 #include "Renderer/Buffers/UniformBuffer.hpp"
 #include "Renderer/IRenderer.hpp"
 #include "Renderer/Handlers/UniformHandler.hpp"
+#include "Renderer/Pipelines/Compute.hpp"
 #include "Renderer/Pipelines/Pipeline.hpp"
+#include "InstanceBatch.hpp"
 
 namespace acid
 {
@@ -14,17 +16,50 @@ namespace acid
 		SORT_BACK = 2
 	};
 
+	class MeshRender;
+
 	class ACID_EXPORT RendererMeshes :
 		public IRenderer
 	{
+	public:
+		static const uint32_t MESHES_PER_CHUNK;
+		static const uint64_t PIPELINE_ID_MASK;
+		static const uint64_t MODEL_ID_MASK;
+		static const uint32_t CULL_WORKGROUP_SIZE;
 	private:
 		MeshSort m_meshSort;
 		UniformHandler m_uniformScene;
+		std::unique_ptr<Compute> m_compute;
+		std::vector<std::unique_ptr<InstanceBatch>> m_batches;
+		uint32_t m_batchCount;
+		std::vector<MeshRender *> m_meshRenders;
 	public:
 		RendererMeshes(const GraphicsStage &graphicsStage, const MeshSort &meshSort = SORT_NONE);
 
 		~RendererMeshes();
 
+		void RenderCompute(const CommandBuffer &commandBuffer, const ICamera &camera) override;
+
 		void Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera) override;
+
+		std::vector<std::shared_ptr<CommandBuffer>> RenderSecondary(const Vector4 &clipPlane, const ICamera &camera) override;
+	private:
+		/// <summary>
+		/// Orders mesh renders by a 64 bit key per draw, and drops the ones this renderer does not draw. Unsorted renderers
+		/// order by pipeline and model to reduce rebinds, sorted renderers order by camera distance first.
+		/// </summary>
+		/// <param name="meshRenders"> The mesh renders to order. </param>
+		/// <param name="camera"> The camera. </param>
+		/// <returns> The mesh renders in draw order. </returns>
+		std::vector<MeshRender *> SortMeshRenders(const std::vector<MeshRender *> &meshRenders, const ICamera &camera);
+
+		/// <summary>
+		/// Groups mesh renders sharing a model and a compatible instanced material into runs drawn by one instanced draw.
+		/// Sorted renderers keep their draw order, so nothing is instanced. Disabled mesh renders are left out of runs.
+		/// </summary>
+		/// <param name="meshRenders"> The mesh renders to group. </param>
+		/// <param name="singles"> Filled with the mesh renders that must be drawn one at a time. </param>
+		/// <returns> The runs of mesh renders to instance. </returns>
+		std::vector<std::vector<MeshRender *>> GetInstanceRuns(const std::vector<MeshRender *> &meshRenders, std::vector<MeshRender *> &singles);
 	};
 }
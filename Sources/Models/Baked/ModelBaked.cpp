@@ -0,0 +1,290 @@
+#include "ModelBaked.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Helpers/FileSystem.hpp"
+#include "Helpers/MappedFile.hpp"
+#include "Models/Obj/ModelObj.hpp"
+#include "Resources/Resources.hpp"
+
+namespace acid
+{
+	const uint32_t ModelBaked::MESHLET_MAX_VERTICES = 64;
+	const uint32_t ModelBaked::MESHLET_MAX_TRIANGLES = 124;
+
+	static const char MESH_MAGIC[4] = {'A', 'M', 'S', 'H'};
+	static const uint32_t MESH_VERSION = 2;
+
+	/// <summary>
+	/// The header at the start of a .acidmesh file. It is followed by the vertices, indices, point cloud, meshlets,
+	/// meshlet vertices and meshlet triangles, every section but the last is four byte aligned.
+	/// </summary>
+	struct MeshHeader
+	{
+		char m_magic[4];
+		uint32_t m_version;
+		uint32_t m_vertexStride;
+		uint32_t m_vertexCount;
+		uint32_t m_indexCount;
+		uint32_t m_meshletCount;
+		uint32_t m_meshletVertexCount;
+		uint32_t m_meshletTriangleCount;
+		float m_minExtents[3];
+		float m_maxExtents[3];
+	};
+
+	static void AppendData(std::vector<char> &data, const void *source, const std::size_t &size)
+	{
+		auto bytes = static_cast<const char *>(source);
+		data.insert(data.end(), bytes, bytes + size);
+	}
+
+	static void BuildMeshlets(const std::vector<VertexModel> &vertices, const std::vector<uint32_t> &indices, std::vector<Meshlet> &meshlets,
+		std::vector<uint32_t> &meshletVertices, std::vector<uint8_t> &meshletTriangles)
+	{
+		std::vector<int32_t> local(vertices.size(), -1);
+		Meshlet meshlet = {};
+
+		auto finish = [&]()
+		{
+			Vector3 min = Vector3(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+			Vector3 max = Vector3(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+			for (uint32_t i = meshlet.m_vertexOffset; i < meshlet.m_vertexOffset + meshlet.m_vertexCount; i++)
+			{
+				const Vector3 &position = vertices[meshletVertices[i]].m_position;
+				min = Vector3(std::min(min.m_x, position.m_x), std::min(min.m_y, position.m_y), std::min(min.m_z, position.m_z));
+				max = Vector3(std::max(max.m_x, position.m_x), std::max(max.m_y, position.m_y), std::max(max.m_z, position.m_z));
+				local[meshletVertices[i]] = -1;
+			}
+
+			Vector3 center = (min + max) / 2.0f;
+			meshlet.m_center[0] = center.m_x;
+			meshlet.m_center[1] = center.m_y;
+			meshlet.m_center[2] = center.m_z;
+			meshlet.m_radius = 0.0f;
+
+			for (uint32_t i = meshlet.m_vertexOffset; i < meshlet.m_vertexOffset + meshlet.m_vertexCount; i++)
+			{
+				meshlet.m_radius = std::max(meshlet.m_radius, (vertices[meshletVertices[i]].m_position - center).Length());
+			}
+
+			meshlets.emplace_back(meshlet);
+			meshlet = {};
+			meshlet.m_vertexOffset = static_cast<uint32_t>(meshletVertices.size());
+			meshlet.m_triangleOffset = static_cast<uint32_t>(meshletTriangles.size() / 3);
+		};
+
+		for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			uint32_t added = 0;
+
+			for (std::size_t j = 0; j < 3; j++)
+			{
+				if (local[indices[i + j]] == -1)
+				{
+					added++;
+				}
+			}
+
+			if (meshlet.m_vertexCount + added > ModelBaked::MESHLET_MAX_VERTICES || meshlet.m_triangleCount + 1 > ModelBaked::MESHLET_MAX_TRIANGLES)
+			{
+				finish();
+			}
+
+			for (std::size_t j = 0; j < 3; j++)
+			{
+				uint32_t index = indices[i + j];
+
+				if (local[index] == -1)
+				{
+					local[index] = static_cast<int32_t>(meshlet.m_vertexCount++);
+					meshletVertices.emplace_back(index);
+				}
+
+				meshletTriangles.emplace_back(static_cast<uint8_t>(local[index]));
+			}
+
+			meshlet.m_triangleCount++;
+		}
+
+		if (meshlet.m_triangleCount != 0)
+		{
+			finish();
+		}
+	}
+
+	std::shared_ptr<ModelBaked> ModelBaked::Resource(const std::string &filename)
+	{
+		std::string realFilename = Files::SearchFile(filename);
+		auto resource = Resources::Get()->Get(realFilename);
+
+		if (resource != nullptr)
+		{
+			return std::dynamic_pointer_cast<ModelBaked>(resource);
+		}
+
+		auto result = std::make_shared<ModelBaked>(realFilename);
+		Resources::Get()->Add(std::dynamic_pointer_cast<IResource>(result));
+		return result;
+	}
+
+	ModelBaked::ModelBaked(const std::string &filename) :
+		Model(),
+		m_meshlets(std::vector<Meshlet>()),
+		m_meshletVertices(std::vector<uint32_t>()),
+		m_meshletTriangles(std::vector<uint8_t>())
+	{
+#if ACID_VERBOSE
+		float debugStart = Engine::Get()->GetTimeMs();
+#endif
+
+		MappedFile file = MappedFile(filename);
+
+		if (!file.IsOpen())
+		{
+			return;
+		}
+
+		MeshHeader header = {};
+
+		if (file.GetSize() < sizeof(MeshHeader))
+		{
+			Log::Error("Baked mesh '%s' is too small for a header\n", filename.c_str());
+			return;
+		}
+
+		memcpy(&header, file.GetData(), sizeof(MeshHeader));
+
+		if (memcmp(header.m_magic, MESH_MAGIC, sizeof(MESH_MAGIC)) != 0 || header.m_version != MESH_VERSION)
+		{
+			Log::Error("Baked mesh '%s' has a unknown magic or version\n", filename.c_str());
+			return;
+		}
+
+		if (header.m_vertexStride != sizeof(VertexModel))
+		{
+			Log::Error("Baked mesh '%s' has a vertex stride of %i, expected %i, the mesh must be baked again\n", filename.c_str(),
+				header.m_vertexStride, static_cast<uint32_t>(sizeof(VertexModel)));
+			return;
+		}
+
+		std::size_t vertexOffset = sizeof(MeshHeader);
+		std::size_t indexOffset = vertexOffset + (static_cast<std::size_t>(header.m_vertexCount) * header.m_vertexStride);
+		std::size_t pointCloudOffset = indexOffset + (static_cast<std::size_t>(header.m_indexCount) * sizeof(uint32_t));
+		std::size_t meshletOffset = pointCloudOffset + (static_cast<std::size_t>(header.m_vertexCount) * 3 * sizeof(float));
+		std::size_t meshletVertexOffset = meshletOffset + (static_cast<std::size_t>(header.m_meshletCount) * sizeof(Meshlet));
+		std::size_t meshletTriangleOffset = meshletVertexOffset + (static_cast<std::size_t>(header.m_meshletVertexCount) * sizeof(uint32_t));
+		std::size_t fileEnd = meshletTriangleOffset + (static_cast<std::size_t>(header.m_meshletTriangleCount) * 3);
+
+		if (file.GetSize() < fileEnd)
+		{
+			Log::Error("Baked mesh '%s' is truncated\n", filename.c_str());
+			return;
+		}
+
+		const char *data = file.GetData();
+		Model::Set(data + vertexOffset, header.m_vertexStride, header.m_vertexCount, reinterpret_cast<const uint32_t *>(data + indexOffset),
+			header.m_indexCount, reinterpret_cast<const float *>(data + pointCloudOffset),
+			Vector3(header.m_minExtents[0], header.m_minExtents[1], header.m_minExtents[2]),
+			Vector3(header.m_maxExtents[0], header.m_maxExtents[1], header.m_maxExtents[2]), filename);
+
+		auto meshlets = reinterpret_cast<const Meshlet *>(data + meshletOffset);
+		auto meshletVertices = reinterpret_cast<const uint32_t *>(data + meshletVertexOffset);
+		auto meshletTriangles = reinterpret_cast<const uint8_t *>(data + meshletTriangleOffset);
+		m_meshlets.assign(meshlets, meshlets + header.m_meshletCount);
+		m_meshletVertices.assign(meshletVertices, meshletVertices + header.m_meshletVertexCount);
+		m_meshletTriangles.assign(meshletTriangles, meshletTriangles + (header.m_meshletTriangleCount * 3));
+
+#if ACID_VERBOSE
+		float debugEnd = Engine::Get()->GetTimeMs();
+		Log::Out("Baked mesh '%s' loaded in %fms\n", filename.c_str(), debugEnd - debugStart);
+#endif
+	}
+
+	ModelBaked::~ModelBaked()
+	{
+	}
+
+	std::size_t ModelBaked::GetMemorySize() const
+	{
+		return Model::GetMemorySize() + (m_meshlets.size() * sizeof(Meshlet)) + (m_meshletVertices.size() * sizeof(uint32_t)) +
+			m_meshletTriangles.size();
+	}
+
+	bool ModelBaked::Bake(const std::string &filename, const std::vector<VertexModel> &vertices, const std::vector<uint32_t> &indices, const bool &meshlets)
+	{
+		std::vector<Meshlet> meshletList = {};
+		std::vector<uint32_t> meshletVertices = {};
+		std::vector<uint8_t> meshletTriangles = {};
+
+		if (meshlets)
+		{
+			BuildMeshlets(vertices, indices, meshletList, meshletVertices, meshletTriangles);
+		}
+
+		MeshHeader header = {};
+		memcpy(header.m_magic, MESH_MAGIC, sizeof(MESH_MAGIC));
+		header.m_version = MESH_VERSION;
+		header.m_vertexStride = sizeof(VertexModel);
+		header.m_vertexCount = static_cast<uint32_t>(vertices.size());
+		header.m_indexCount = static_cast<uint32_t>(indices.size());
+		header.m_meshletCount = static_cast<uint32_t>(meshletList.size());
+		header.m_meshletVertexCount = static_cast<uint32_t>(meshletVertices.size());
+		header.m_meshletTriangleCount = static_cast<uint32_t>(meshletTriangles.size() / 3);
+
+		std::vector<float> pointCloud = {};
+		pointCloud.reserve(vertices.size() * 3);
+		Vector3 min = Vector3(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+		Vector3 max = Vector3(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+		for (auto &vertex : vertices)
+		{
+			pointCloud.emplace_back(vertex.m_position.m_x);
+			pointCloud.emplace_back(vertex.m_position.m_y);
+			pointCloud.emplace_back(vertex.m_position.m_z);
+			min = Vector3(std::min(min.m_x, vertex.m_position.m_x), std::min(min.m_y, vertex.m_position.m_y), std::min(min.m_z, vertex.m_position.m_z));
+			max = Vector3(std::max(max.m_x, vertex.m_position.m_x), std::max(max.m_y, vertex.m_position.m_y), std::max(max.m_z, vertex.m_position.m_z));
+		}
+
+		header.m_minExtents[0] = min.m_x;
+		header.m_minExtents[1] = min.m_y;
+		header.m_minExtents[2] = min.m_z;
+		header.m_maxExtents[0] = max.m_x;
+		header.m_maxExtents[1] = max.m_y;
+		header.m_maxExtents[2] = max.m_z;
+
+		std::vector<char> data = {};
+		data.reserve(sizeof(MeshHeader) + (vertices.size() * sizeof(VertexModel)) + (indices.size() * sizeof(uint32_t)) + (pointCloud.size() * sizeof(float)));
+		AppendData(data, &header, sizeof(MeshHeader));
+
+		AppendData(data, vertices.data(), vertices.size() * sizeof(VertexModel));
+		AppendData(data, indices.data(), indices.size() * sizeof(uint32_t));
+		AppendData(data, pointCloud.data(), pointCloud.size() * sizeof(float));
+		AppendData(data, meshletList.data(), meshletList.size() * sizeof(Meshlet));
+		AppendData(data, meshletVertices.data(), meshletVertices.size() * sizeof(uint32_t));
+		AppendData(data, meshletTriangles.data(), meshletTriangles.size());
+		return FileSystem::WriteBinaryFile<char>(filename, data);
+	}
+
+	bool ModelBaked::Bake(const std::string &source, const std::string &destination, const bool &meshlets)
+	{
+		if (FileSystem::FindExt(source) != "obj")
+		{
+			Log::Error("Could not bake mesh '%s', unsupported source type\n", source.c_str());
+			return false;
+		}
+
+		std::vector<VertexModel> vertices = {};
+		std::vector<uint32_t> indices = {};
+
+		if (!ModelObj::Load(source, vertices, indices))
+		{
+			Log::Error("Could not bake mesh '%s', the source could not be read\n", source.c_str());
+			return false;
+		}
+
+		return Bake(destination, vertices, indices, meshlets);
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Models/Model.hpp"
+#include "Models/VertexModel.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A cluster of up to <seealso cref="ModelBaked#MESHLET_MAX_VERTICES"/> vertices and <seealso cref="ModelBaked#MESHLET_MAX_TRIANGLES"/> triangles.
+	/// Vertices index into the models meshlet vertex list, triangles are three local bytes each into the meshlets own vertices.
+	/// </summary>
+	struct ACID_EXPORT Meshlet
+	{
+		uint32_t m_vertexOffset;
+		uint32_t m_vertexCount;
+		uint32_t m_triangleOffset;
+		uint32_t m_triangleCount;
+		float m_center[3];
+		float m_radius;
+	};
+
+	/// <summary>
+	/// Class that represents a model baked into a .acidmesh file. The file is mapped into memory and its packed buffers
+	/// are copied straight into staging buffers, no text is parsed and no per vertex objects are created.
+	/// </summary>
+	class ACID_EXPORT ModelBaked :
+		public Model
+	{
+	public:
+		static const uint32_t MESHLET_MAX_VERTICES;
+		static const uint32_t MESHLET_MAX_TRIANGLES;
+	private:
+		std::vector<Meshlet> m_meshlets;
+		std::vector<uint32_t> m_meshletVertices;
+		std::vector<uint8_t> m_meshletTriangles;
+	public:
+		/// <summary>
+		/// Will find an existing baked model with the same filename, or create a new baked model.
+		/// </summary>
+		/// <param name="filename"> The file to load the baked model from. </param>
+		static std::shared_ptr<ModelBaked> Resource(const std::string &filename);
+
+		/// <summary>
+		/// Creates a new baked model.
+		/// </summary>
+		/// <param name="filename"> The file to load the model from. </param>
+		ModelBaked(const std::string &filename);
+
+		~ModelBaked();
+
+		std::size_t GetMemorySize() const override;
+
+		/// <summary>
+		/// Bakes packed vertices and indices into a .acidmesh file.
+		/// </summary>
+		/// <param name="filename"> The file to write. </param>
+		/// <param name="vertices"> The model vertices. </param>
+		/// <param name="indices"> The model indices, as a triangle list. </param>
+		/// <param name="meshlets"> If meshlets should be built and stored. </param>
+		/// <returns> If the file was written. </returns>
+		static bool Bake(const std::string &filename, const std::vector<VertexModel> &vertices, const std::vector<uint32_t> &indices, const bool &meshlets = true);
+
+		/// <summary>
+		/// Bakes a source model file into a .acidmesh file, this is meant to be run offline as a asset build step.
+		/// </summary>
+		/// <param name="source"> The source model, only OBJ files are supported. </param>
+		/// <param name="destination"> The file to write. </param>
+		/// <param name="meshlets"> If meshlets should be built and stored. </param>
+		/// <returns> If the file was written. </returns>
+		static bool Bake(const std::string &source, const std::string &destination, const bool &meshlets = true);
+
+		const std::vector<Meshlet> &GetMeshlets() const { return m_meshlets; }
+
+		const std::vector<uint32_t> &GetMeshletVertices() const { return m_meshletVertices; }
+
+		const std::vector<uint8_t> &GetMeshletTriangles() const { return m_meshletTriangles; }
+	};
+}
@@ -1,5 +1,6 @@
 #include "Model.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -18,50 +19,6 @@ namespace acid
 	{
 	}
 
-	Model::Model(std::vector<IVertex *> &vertices, std::vector<uint32_t> &indices, const std::string &name) :
-		IResource(),
-		m_filename(name),
-		m_vertexBuffer(nullptr),
-		m_indexBuffer(nullptr),
-		m_pointCloud(std::vector<float>()),
-		m_minExtents(Vector3()),
-		m_maxExtents(Vector3())
-	{
-		void *verticesData = vertices[0]->GetData(vertices);
-		m_vertexBuffer = std::make_shared<VertexBuffer>(vertices[0]->GetSize(), vertices.size(), verticesData);
-		free(verticesData);
-
-		m_indexBuffer = std::make_shared<IndexBuffer>(VK_INDEX_TYPE_UINT32, sizeof(indices[0]), indices.size(), indices.data());
-
-		CalculateBounds(vertices);
-
-		for (auto &vertex : vertices)
-		{
-			delete vertex;
-		}
-	}
-
-	Model::Model(std::vector<IVertex *> &vertices, const std::string &name) :
-		IResource(),
-		m_filename(name),
-		m_vertexBuffer(nullptr),
-		m_indexBuffer(nullptr),
-		m_pointCloud(std::vector<float>()),
-		m_minExtents(Vector3()),
-		m_maxExtents(Vector3())
-	{
-		void *verticesData = vertices[0]->GetData(vertices);
-		m_vertexBuffer = std::make_shared<VertexBuffer>(vertices[0]->GetSize(), vertices.size(), verticesData);
-		free(verticesData);
-
-		CalculateBounds(vertices);
-
-		for (auto &vertex : vertices)
-		{
-			delete vertex;
-		}
-	}
-
 	Model::~Model()
 	{
 	}
@@ -89,6 +46,38 @@ namespace acid
 		}
 	}
 
+	void Model::CmdRenderIndirect(const CommandBuffer &commandBuffer, const VkBuffer &buffer, const VkDeviceSize &offset)
+	{
+		if (m_vertexBuffer == nullptr || m_indexBuffer == nullptr)
+		{
+			assert(false && "Cannot render model indirectly, it must have vertex and index buffers!");
+			return;
+		}
+
+		VkBuffer vertexBuffers[] = {m_vertexBuffer->GetBuffer()};
+		VkDeviceSize offsets[] = {0};
+		vkCmdBindVertexBuffers(commandBuffer.GetCommandBuffer(), 0, 1, vertexBuffers, offsets);
+		vkCmdBindIndexBuffer(commandBuffer.GetCommandBuffer(), m_indexBuffer->GetBuffer(), 0, m_indexBuffer->GetIndexType());
+		vkCmdDrawIndexedIndirect(commandBuffer.GetCommandBuffer(), buffer, offset, 1, sizeof(VkDrawIndexedIndirectCommand));
+	}
+
+	std::size_t Model::GetMemorySize() const
+	{
+		std::size_t memorySize = m_pointCloud.size() * sizeof(float);
+
+		if (m_vertexBuffer != nullptr)
+		{
+			memorySize += static_cast<std::size_t>(m_vertexBuffer->GetSize());
+		}
+
+		if (m_indexBuffer != nullptr)
+		{
+			memorySize += static_cast<std::size_t>(m_indexBuffer->GetSize());
+		}
+
+		return memorySize;
+	}
+
 	float Model::GetRadius() const
 	{
 		float min0 = std::abs(m_minExtents.MaxComponent());
@@ -98,79 +87,44 @@ namespace acid
 		return std::max(min0, std::max(min1, std::max(max0, max1)));
 	}
 
-	void Model::Set(std::vector<IVertex *> &vertices, std::vector<uint32_t> &indices, const std::string &name)
+	void Model::Set(const void *vertices, const uint32_t &vertexStride, const uint32_t &vertexCount, const uint32_t *indices, const uint32_t &indexCount,
+		const float *pointCloud, const Vector3 &minExtents, const Vector3 &maxExtents, const std::string &name)
 	{
 		m_filename = name;
+		SetBuffers(vertices, vertexStride, vertexCount, indices, indices != nullptr ? indexCount : 0);
 
-		if (!vertices.empty())
-		{
-			void *verticesData = vertices[0]->GetData(vertices);
-			m_vertexBuffer = std::make_shared<VertexBuffer>(vertices[0]->GetSize(), vertices.size(), verticesData);
-			free(verticesData);
-		}
+		m_pointCloud.assign(pointCloud, pointCloud + (vertexCount * 3));
+		m_minExtents = minExtents;
+		m_maxExtents = maxExtents;
+	}
+
+	void Model::SetBuffers(const void *vertices, const uint32_t &vertexStride, const uint32_t &vertexCount, const uint32_t *indices, const uint32_t &indexCount)
+	{
+		m_vertexBuffer = nullptr;
+		m_indexBuffer = nullptr;
 
-		if (!indices.empty())
+		if (vertexCount != 0)
 		{
-			m_indexBuffer = std::make_shared<IndexBuffer>(VK_INDEX_TYPE_UINT32, sizeof(indices[0]), indices.size(), indices.data());
+			m_vertexBuffer = std::make_shared<VertexBuffer>(vertexStride, vertexCount, vertices);
 		}
 
-		CalculateBounds(vertices);
-
-		for (auto &vertex : vertices)
+		if (indexCount != 0)
 		{
-			delete vertex;
+			m_indexBuffer = std::make_shared<IndexBuffer>(VK_INDEX_TYPE_UINT32, sizeof(uint32_t), indexCount, indices);
 		}
 	}
 
-	void Model::CalculateBounds(const std::vector<IVertex *> &vertices)
+	void Model::AddPoint(const Vector3 &position)
 	{
-		m_pointCloud.clear();
-		m_pointCloud.resize(vertices.size() * 3);
-
-		m_minExtents.m_x = +std::numeric_limits<float>::infinity();
-		m_minExtents.m_y = +std::numeric_limits<float>::infinity();
-		m_minExtents.m_z = +std::numeric_limits<float>::infinity();
-		m_maxExtents.m_x = -std::numeric_limits<float>::infinity();
-		m_maxExtents.m_y = -std::numeric_limits<float>::infinity();
-		m_maxExtents.m_z = -std::numeric_limits<float>::infinity();
-
-		int32_t i = 0;
-
-		for (auto &vertex : vertices)
-		{
-			Vector3 position = vertex->GetPosition();
-
-			m_pointCloud[i] = position.m_x;
-			m_pointCloud[i + 1] = position.m_y;
-			m_pointCloud[i + 2] = position.m_z;
-			i += 3;
-
-			if (position.m_x < m_minExtents.m_x)
-			{
-				m_minExtents.m_x = position.m_x;
-			}
-			else if (position.m_x > m_maxExtents.m_x)
-			{
-				m_maxExtents.m_x = position.m_x;
-			}
-
-			if (position.m_y < m_minExtents.m_y)
-			{
-				m_minExtents.m_y = position.m_y;
-			}
-			else if (position.m_y > m_maxExtents.m_y)
-			{
-				m_maxExtents.m_y = position.m_y;
-			}
-
-			if (position.m_z < m_minExtents.m_z)
-			{
-				m_minExtents.m_z = position.m_z;
-			}
-			else if (position.m_z > m_maxExtents.m_z)
-			{
-				m_maxExtents.m_z = position.m_z;
-			}
-		}
+		m_pointCloud.emplace_back(position.m_x);
+		m_pointCloud.emplace_back(position.m_y);
+		m_pointCloud.emplace_back(position.m_z);
+
+		m_minExtents.m_x = std::min(m_minExtents.m_x, position.m_x);
+		m_minExtents.m_y = std::min(m_minExtents.m_y, position.m_y);
+		m_minExtents.m_z = std::min(m_minExtents.m_z, position.m_z);
+		m_maxExtents.m_x = std::max(m_maxExtents.m_x, position.m_x);
+		m_maxExtents.m_y = std::max(m_maxExtents.m_y, position.m_y);
+		m_maxExtents.m_z = std::max(m_maxExtents.m_z, position.m_z);
 	}
 }
@@ -1,11 +1,12 @@
 #pragma once
 
+#include <limits>
 #include <string>
 #include <vector>
 #include "Renderer/Buffers/IndexBuffer.hpp"
 #include "Renderer/Buffers/VertexBuffer.hpp"
 #include "Resources/IResource.hpp"
-#include "IVertex.hpp"
+#include "VertexModel.hpp"
 
 namespace acid
 {
@@ -34,24 +35,34 @@ namespace acid
 		/// <summary>
 		/// Creates a new model.
 		/// </summary>
-		/// <param name="vertices"> The model vertices. </param>
-		/// <param name="indices"> The model indices. </param>
+		/// <param name="vertices"> The model vertices, each vertex type must have a <c>m_position</c>. </param>
+		/// <param name="indices"> The model indices, empty to draw the vertices in order. </param>
 		/// <param name="name"> The model name. </param>
-		Model(std::vector<IVertex *> &vertices, std::vector<uint32_t> &indices, const std::string &name = "");
-
-		/// <summary>
-		/// Creates a new model without indices.
-		/// </summary>
-		/// <param name="vertices"> The model vertices. </param>
-		/// <param name="name"> The model name. </param>
-		Model(std::vector<IVertex *> &vertices, const std::string &name = "");
+		/// <param name="T"> The vertex type. </param>
+		template<typename T>
+		explicit Model(const std::vector<T> &vertices, const std::vector<uint32_t> &indices = {}, const std::string &name = "") :
+			Model()
+		{
+			Set(vertices, indices, name);
+		}
 
 		~Model();
 
 		void CmdRender(const CommandBuffer &commandBuffer, const uint32_t &instances = 1);
 
+		/// <summary>
+		/// Draws the model with the parameters of an indexed draw read from a buffer by the GPU, so the instance count can
+		/// be written by a compute shader.
+		/// </summary>
+		/// <param name="commandBuffer"> The command buffer to record into. </param>
+		/// <param name="buffer"> The buffer holding a <seealso cref="VkDrawIndexedIndirectCommand"/>. </param>
+		/// <param name="offset"> The offset of the command in the buffer. </param>
+		void CmdRenderIndirect(const CommandBuffer &commandBuffer, const VkBuffer &buffer, const VkDeviceSize &offset = 0);
+
 		std::string GetFilename() override { return m_filename; }
 
+		std::size_t GetMemorySize() const override;
+
 		Vector3 GetMinExtents() const { return m_minExtents; }
 
 		Vector3 GetMaxExtents() const { return m_maxExtents; }
@@ -71,9 +82,48 @@ namespace acid
 		std::shared_ptr<IndexBuffer> GetIndexBuffer() const { return m_indexBuffer; }
 
 	protected:
-		void Set(std::vector<IVertex *> &vertices, std::vector<uint32_t> &indices, const std::string &name = "");
+		/// <summary>
+		/// Sets the model from a contiguous vertex stream, the vertices are copied into the staging buffer in one block.
+		/// </summary>
+		/// <param name="vertices"> The model vertices, each vertex type must have a <c>m_position</c>. </param>
+		/// <param name="indices"> The model indices, empty to draw the vertices in order. </param>
+		/// <param name="name"> The model name. </param>
+		/// <param name="T"> The vertex type. </param>
+		template<typename T>
+		void Set(const std::vector<T> &vertices, const std::vector<uint32_t> &indices, const std::string &name = "")
+		{
+			m_filename = name;
+			SetBuffers(vertices.data(), sizeof(T), static_cast<uint32_t>(vertices.size()), indices.data(), static_cast<uint32_t>(indices.size()));
+
+			m_pointCloud.clear();
+			m_pointCloud.reserve(vertices.size() * 3);
+			m_minExtents = Vector3(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+			m_maxExtents = Vector3(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+			for (auto &vertex : vertices)
+			{
+				AddPoint(vertex.m_position);
+			}
+		}
+
+		/// <summary>
+		/// Sets the model from raw vertex and index data with precomputed bounds, the data is copied straight into staging buffers.
+		/// </summary>
+		/// <param name="vertices"> The packed vertex data. </param>
+		/// <param name="vertexStride"> The size of each vertex. </param>
+		/// <param name="vertexCount"> The number of vertices. </param>
+		/// <param name="indices"> The index data, or nullptr. </param>
+		/// <param name="indexCount"> The number of indices. </param>
+		/// <param name="pointCloud"> The vertex positions, three floats per vertex. </param>
+		/// <param name="minExtents"> The minimum extents. </param>
+		/// <param name="maxExtents"> The maximum extents. </param>
+		/// <param name="name"> The model name. </param>
+		void Set(const void *vertices, const uint32_t &vertexStride, const uint32_t &vertexCount, const uint32_t *indices, const uint32_t &indexCount,
+			const float *pointCloud, const Vector3 &minExtents, const Vector3 &maxExtents, const std::string &name = "");
 
 	private:
-		void CalculateBounds(const std::vector<IVertex *> &vertices);
+		void SetBuffers(const void *vertices, const uint32_t &vertexStride, const uint32_t &vertexCount, const uint32_t *indices, const uint32_t &indexCount);
+
+		void AddPoint(const Vector3 &position);
 	};
 }
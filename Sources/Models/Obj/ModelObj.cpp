@@ -1,10 +1,73 @@
 #include "ModelObj.hpp"
 
-#include "Helpers/FileSystem.hpp"
+#include <charconv>
+#include <cstring>
+#include "Helpers/MappedFile.hpp"
 #include "Resources/Resources.hpp"
 
 namespace acid
 {
+	static const char *SkipSpaces(const char *it, const char *end)
+	{
+		while (it < end && (*it == ' ' || *it == '\t' || *it == '\r'))
+		{
+			++it;
+		}
+
+		return it;
+	}
+
+	static const char *SkipToken(const char *it, const char *end)
+	{
+		while (it < end && *it != ' ' && *it != '\t' && *it != '\r')
+		{
+			++it;
+		}
+
+		return it;
+	}
+
+	static bool TokenEquals(const char *token, const std::size_t &length, const char *value)
+	{
+		return std::strlen(value) == length && std::strncmp(token, value, length) == 0;
+	}
+
+	static const char *ParseFloat(const char *it, const char *end, float &value)
+	{
+		it = SkipSpaces(it, end);
+
+		if (it < end && *it == '+')
+		{
+			++it;
+		}
+
+		value = 0.0f;
+		auto result = std::from_chars(it, end, value);
+		return result.ec == std::errc() ? result.ptr : SkipToken(it, end);
+	}
+
+	static const char *ParseIndex(const char *it, const char *end, int32_t &value)
+	{
+		value = 0;
+		auto result = std::from_chars(it, end, value);
+		return result.ec == std::errc() ? result.ptr : it;
+	}
+
+	/// <summary>
+	/// Converts a one based, possibly negative (relative), OBJ index into a zero based index, -1 if missing or out of range.
+	/// </summary>
+	static int32_t ResolveIndex(const int32_t &index, const std::size_t &count)
+	{
+		int32_t resolved = index > 0 ? index - 1 : static_cast<int32_t>(count) + index;
+
+		if (index == 0 || resolved < 0 || resolved >= static_cast<int32_t>(count))
+		{
+			return -1;
+		}
+
+		return resolved;
+	}
+
 	std::shared_ptr<ModelObj> ModelObj::Resource(const std::string &filename)
 	{
 		std::string realFilename = Files::SearchFile(filename);
@@ -27,190 +90,202 @@ namespace acid
 		float debugStart = Engine::Get()->GetTimeMs();
 #endif
 
-		auto fileLoaded = FileSystem::ReadTextFile(filename);
+		std::vector<VertexModel> vertices = {};
+		std::vector<uint32_t> indices = {};
 
-		if (!fileLoaded)
+		if (!Load(filename, vertices, indices))
 		{
 			return;
 		}
 
-		auto lines = String::Split(*fileLoaded, "\n");
-
-		auto indicesList = std::vector<uint32_t>();
-		auto verticesList = std::vector<VertexModelData *>();
-		auto uvsList = std::vector<Vector2>();
-		auto normalsList = std::vector<Vector3>();
+#if ACID_VERBOSE
+		float debugEnd = Engine::Get()->GetTimeMs();
+		Log::Out("Obj '%s' loaded in %fms\n", filename.c_str(), debugEnd - debugStart);
+#endif
 
-		for (auto &line : lines)
-		{
-			auto split = String::Split(line, " ", true);
+		Model::Set(vertices, indices, filename);
+	}
 
-			if (!split.empty())
-			{
-				std::string prefix = split[0];
+	ModelObj::~ModelObj()
+	{
+	}
 
-				if (prefix == "#")
-				{
-					continue;
-				}
-				else if (prefix == "v")
-				{
-					Vector3 vertex = Vector3(String::From<float>(split[1]), String::From<float>(split[2]),
-					                         String::From<float>(split[3]));
-					VertexModelData *newVertex = new VertexModelData(static_cast<int>(verticesList.size()), vertex);
-					verticesList.emplace_back(newVertex);
-				}
-				else if (prefix == "vt")
-				{
-					Vector2 uv = Vector2(String::From<float>(split[1]), 1.0f - String::From<float>(split[2]));
-					uvsList.emplace_back(uv);
-				}
-				else if (prefix == "vn")
-				{
-					Vector3 normal = Vector3(String::From<float>(split[1]), String::From<float>(split[2]),
-					                         String::From<float>(split[3]));
-					normalsList.emplace_back(normal);
-				}
-				else if (prefix == "f")
-				{
-					// The split length of 3 faced + 1 for the f prefix.
-					if (split.size() != 4 || String::Contains(line, "//"))
-					{
-						Log::Error("Error reading the OBJ '%s', it does not appear to be UV mapped! The model will not be loaded.\n", filename.c_str());
-						throw std::runtime_error("Model loading error.");
-					}
+	bool ModelObj::Load(const std::string &filename, std::vector<VertexModel> &vertices, std::vector<uint32_t> &indices)
+	{
+		MappedFile file = MappedFile(filename);
 
-					auto vertex1 = String::Split(split[1], "/");
-					auto vertex2 = String::Split(split[2], "/");
-					auto vertex3 = String::Split(split[3], "/");
-
-					VertexModelData *v0 = ProcessDataVertex(Vector3(String::From<float>(vertex1[0]),
-					                                                String::From<float>(vertex1[1]),
-					                                                String::From<float>(vertex1[2])), verticesList, indicesList);
-					VertexModelData *v1 = ProcessDataVertex(Vector3(String::From<float>(vertex2[0]),
-					                                                String::From<float>(vertex2[1]),
-					                                                String::From<float>(vertex2[2])), verticesList, indicesList);
-					VertexModelData *v2 = ProcessDataVertex(Vector3(String::From<float>(vertex3[0]),
-					                                                String::From<float>(vertex3[1]),
-					                                                String::From<float>(vertex3[2])), verticesList, indicesList);
-					CalculateTangents(v0, v1, v2, uvsList);
-				}
-				else if (prefix == "o")
-				{
-				}
-				else if (prefix == "s")
-				{
-				}
-				else
-				{
-					Log::Error("OBJ '%s' unknown line: '%s'\n", filename.c_str(), line.c_str());
-				}
-			}
+		if (!file.IsOpen())
+		{
+			return false;
 		}
 
-		// Averages out vertex tangents, and disabled non set vertices,
-		for (auto &current : verticesList)
-		{
-			current->AverageTangents();
+		vertices.clear();
+		indices.clear();
 
-			if (!current->IsSet())
-			{
-				current->SetUvIndex(0);
-				current->SetNormalIndex(0);
-			}
-		}
+		std::vector<Vector3> positions = {};
+		std::vector<Vector2> uvs = {};
+		std::vector<Vector3> normals = {};
 
-		std::vector<IVertex *> vertices = std::vector<IVertex *>();
-		std::vector<uint32_t> indices = std::vector<uint32_t>();
+		std::vector<Vector3> tangents = {};
+		std::vector<bool> generatedNormals = {};
+		std::unordered_map<VertexKey, uint32_t, VertexKeyHash> vertexLookup = {};
+		std::vector<uint32_t> face = {};
 
-		indices.swap(indicesList);
+		const char *it = file.GetData();
+		const char *end = it + file.GetSize();
 
-		// Turns the loaded data into a format that can be used by OpenGL.
-		for (auto &current : verticesList)
+		while (it < end)
 		{
-			Vector3 position = current->GetPosition();
-			Vector2 textures = uvsList[current->GetUvIndex()];
-			Vector3 normal = normalsList[current->GetNormalIndex()];
-			Vector3 tangent = current->GetAverageTangent();
+			it = SkipSpaces(it, end);
+			auto lineEnd = static_cast<const char *>(memchr(it, '\n', end - it));
 
-			vertices.emplace_back(new VertexModel(position, textures, normal, tangent));
+			if (lineEnd == nullptr)
+			{
+				lineEnd = end;
+			}
 
-			delete current;
-		}
+			auto tokenEnd = SkipToken(it, lineEnd);
+			std::size_t tokenLength = tokenEnd - it;
 
-#if ACID_VERBOSE
-		float debugEnd = Engine::Get()->GetTimeMs();
-		Log::Out("Obj '%s' loaded in %fms\n", filename.c_str(), debugEnd - debugStart);
-#endif
+			if (tokenLength == 1 && it[0] == 'v')
+			{
+				Vector3 position = Vector3();
+				const char *p = ParseFloat(tokenEnd, lineEnd, position.m_x);
+				p = ParseFloat(p, lineEnd, position.m_y);
+				ParseFloat(p, lineEnd, position.m_z);
+				positions.emplace_back(position);
+			}
+			else if (tokenLength == 2 && it[0] == 'v' && it[1] == 't')
+			{
+				Vector2 uv = Vector2();
+				const char *p = ParseFloat(tokenEnd, lineEnd, uv.m_x);
+				ParseFloat(p, lineEnd, uv.m_y);
+				uv.m_y = 1.0f - uv.m_y;
+				uvs.emplace_back(uv);
+			}
+			else if (tokenLength == 2 && it[0] == 'v' && it[1] == 'n')
+			{
+				Vector3 normal = Vector3();
+				const char *p = ParseFloat(tokenEnd, lineEnd, normal.m_x);
+				p = ParseFloat(p, lineEnd, normal.m_y);
+				ParseFloat(p, lineEnd, normal.m_z);
+				normals.emplace_back(normal);
+			}
+			else if (tokenLength == 1 && it[0] == 'f')
+			{
+				face.clear();
+				bool valid = true;
 
-		Model::Set(vertices, indices, filename);
-	}
+				for (const char *p = SkipSpaces(tokenEnd, lineEnd); p < lineEnd; p = SkipSpaces(p, lineEnd))
+				{
+					// Corners are 'v', 'v/vt', 'v//vn' or 'v/vt/vn'.
+					int32_t position = 0;
+					int32_t uv = 0;
+					int32_t normal = 0;
+					p = ParseIndex(p, lineEnd, position);
 
-	ModelObj::~ModelObj()
-	{
-	}
+					if (p < lineEnd && *p == '/')
+					{
+						p = ParseIndex(p + 1, lineEnd, uv);
 
-	VertexModelData *ModelObj::ProcessDataVertex(const Vector3 &vertex, std::vector<VertexModelData *> &vertices, std::vector<uint32_t> &indices)
-	{
-		int32_t index = static_cast<int>(vertex.m_x) - 1;
-		int32_t textureIndex = static_cast<int>(vertex.m_y) - 1;
-		int32_t normalIndex = static_cast<int>(vertex.m_z) - 1;
-		VertexModelData *currentVertex = vertices[index];
+						if (p < lineEnd && *p == '/')
+						{
+							p = ParseIndex(p + 1, lineEnd, normal);
+						}
+					}
 
-		if (!currentVertex->IsSet())
-		{
-			currentVertex->SetUvIndex(textureIndex);
-			currentVertex->SetNormalIndex(normalIndex);
-			indices.emplace_back(index);
-			return currentVertex;
-		}
+					p = SkipToken(p, lineEnd);
 
-		return DealWithAlreadyProcessedDataVertex(currentVertex, textureIndex, normalIndex, vertices, indices);
-	}
+					VertexKey key = {ResolveIndex(position, positions.size()), ResolveIndex(uv, uvs.size()), ResolveIndex(normal, normals.size())};
 
-	VertexModelData *ModelObj::DealWithAlreadyProcessedDataVertex(VertexModelData *previousVertex, const int32_t &newTextureIndex, const int32_t &newNormalIndex, std::vector<VertexModelData *> &vertices, std::vector<uint32_t> &indices)
-	{
-		if (previousVertex->HasSameTextureAndNormal(newTextureIndex, newNormalIndex))
-		{
-			indices.emplace_back(previousVertex->GetIndex());
-			return previousVertex;
-		}
+					if (key.m_position == -1)
+					{
+						valid = false;
+						continue;
+					}
 
-		VertexModelData *anotherVertex = previousVertex->GetDuplicateVertex();
+					auto found = vertexLookup.find(key);
 
-		if (anotherVertex != nullptr)
-		{
-			return DealWithAlreadyProcessedDataVertex(anotherVertex, newTextureIndex, newNormalIndex, vertices, indices);
-		}
+					if (found != vertexLookup.end())
+					{
+						face.emplace_back((*found).second);
+						continue;
+					}
 
-		VertexModelData *duplicateVertex = new VertexModelData(static_cast<uint32_t>(vertices.size()), previousVertex->GetPosition());
-		duplicateVertex->SetUvIndex(newTextureIndex);
-		duplicateVertex->SetNormalIndex(newNormalIndex);
-		previousVertex->SetDuplicateVertex(duplicateVertex);
-		vertices.emplace_back(duplicateVertex);
-		indices.emplace_back(duplicateVertex->GetIndex());
-		return duplicateVertex;
-	}
+					auto index = static_cast<uint32_t>(vertices.size());
+					vertices.emplace_back(positions[key.m_position], key.m_uv != -1 ? uvs[key.m_uv] : Vector2::ZERO,
+						key.m_normal != -1 ? normals[key.m_normal] : Vector3::ZERO);
+					tangents.emplace_back(Vector3::ZERO);
+					generatedNormals.emplace_back(key.m_normal == -1);
+					vertexLookup.emplace(key, index);
+					face.emplace_back(index);
+				}
 
-	void ModelObj::CalculateTangents(VertexModelData *v0, VertexModelData *v1, VertexModelData *v2, std::vector<Vector2> &uvs)
-	{
-		Vector2 uv0 = uvs[v0->GetUvIndex()];
-		Vector2 uv1 = uvs[v1->GetUvIndex()];
-		Vector2 uv2 = uvs[v2->GetUvIndex()];
+				if (!valid || face.size() < 3)
+				{
+					Log::Error("OBJ '%s' invalid face: '%s'\n", filename.c_str(), std::string(it, lineEnd).c_str());
+				}
+				else
+				{
+					// Triangulates the polygon as a fan around its first corner.
+					for (std::size_t i = 1; i + 1 < face.size(); i++)
+					{
+						uint32_t i0 = face[0];
+						uint32_t i1 = face[i];
+						uint32_t i2 = face[i + 1];
+						indices.emplace_back(i0);
+						indices.emplace_back(i1);
+						indices.emplace_back(i2);
+
+						Vector3 deltaPos1 = vertices[i1].m_position - vertices[i0].m_position;
+						Vector3 deltaPos2 = vertices[i2].m_position - vertices[i0].m_position;
+						Vector2 deltaUv1 = vertices[i1].m_uv - vertices[i0].m_uv;
+						Vector2 deltaUv2 = vertices[i2].m_uv - vertices[i0].m_uv;
+						float determinant = deltaUv1.m_x * deltaUv2.m_y - deltaUv1.m_y * deltaUv2.m_x;
+
+						if (determinant != 0.0f)
+						{
+							Vector3 tangent = (1.0f / determinant) * ((deltaPos1 * deltaUv2.m_y) - (deltaPos2 * deltaUv1.m_y));
+							tangents[i0] += tangent;
+							tangents[i1] += tangent;
+							tangents[i2] += tangent;
+						}
+
+						// Corners without a normal take the sum of their face normals.
+						Vector3 faceNormal = deltaPos1.Cross(deltaPos2);
+
+						for (auto &corner : {i0, i1, i2})
+						{
+							if (generatedNormals[corner])
+							{
+								vertices[corner].m_normal += faceNormal;
+							}
+						}
+					}
+				}
+			}
+			else if (tokenLength != 0 && it[0] != '#' && !TokenEquals(it, tokenLength, "o") && !TokenEquals(it, tokenLength, "g") &&
+				!TokenEquals(it, tokenLength, "s") && !TokenEquals(it, tokenLength, "usemtl") && !TokenEquals(it, tokenLength, "mtllib"))
+			{
+				Log::Error("OBJ '%s' unknown line: '%s'\n", filename.c_str(), std::string(it, lineEnd).c_str());
+			}
 
-		Vector2 deltaUv1 = uv1 - uv0;
-		Vector2 deltaUv2 = uv2 - uv0;
-		float r = 1.0f / (deltaUv1.m_x * deltaUv2.m_y - deltaUv1.m_y * deltaUv2.m_x);
+			it = lineEnd + 1;
+		}
 
-		Vector3 deltaPos1 = v1->GetPosition() - v0->GetPosition();
-		Vector3 deltaPos2 = v2->GetPosition() - v0->GetPosition();
-		deltaPos1 *= deltaUv2.m_y;
-		deltaPos2 *= deltaUv1.m_y;
+		for (std::size_t i = 0; i < vertices.size(); i++)
+		{
+			if (tangents[i].LengthSquared() != 0.0f)
+			{
+				vertices[i].m_tangent = tangents[i].Normalize();
+			}
 
-		Vector3 tangent = Vector3(r * (deltaPos1 - deltaPos2));
+			if (generatedNormals[i] && vertices[i].m_normal.LengthSquared() != 0.0f)
+			{
+				vertices[i].m_normal = vertices[i].m_normal.Normalize();
+			}
+		}
 
-		v0->AddTangent(tangent);
-		v1->AddTangent(tangent);
-		v2->AddTangent(tangent);
+		return true;
 	}
 }
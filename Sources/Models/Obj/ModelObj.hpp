@@ -1,10 +1,9 @@
 #pragma once
 
-#include <functional>
+#include <unordered_map>
 #include "Helpers/String.hpp"
 #include "Models/Model.hpp"
 #include "Models/VertexModel.hpp"
-#include "Models/VertexModelData.hpp"
 
 namespace acid
 {
@@ -14,6 +13,30 @@ namespace acid
 	class ACID_EXPORT ModelObj :
 		public Model
 	{
+	private:
+		/// <summary>
+		/// The position, uv and normal indices of a face corner, -1 when a index is missing.
+		/// </summary>
+		struct VertexKey
+		{
+			int32_t m_position;
+			int32_t m_uv;
+			int32_t m_normal;
+
+			bool operator==(const VertexKey &other) const
+			{
+				return m_position == other.m_position && m_uv == other.m_uv && m_normal == other.m_normal;
+			}
+		};
+
+		struct VertexKeyHash
+		{
+			std::size_t operator()(const VertexKey &key) const
+			{
+				return (static_cast<std::size_t>(key.m_position) * 73856093) ^ (static_cast<std::size_t>(key.m_uv) * 19349663) ^
+					(static_cast<std::size_t>(key.m_normal) * 83492791);
+			}
+		};
 	public:
 		/// <summary>
 		/// Will find an existing OBJ model with the same filename, or create a new OBJ model.
@@ -22,17 +45,20 @@ namespace acid
 		static std::shared_ptr<ModelObj> Resource(const std::string &filename);
 
 		/// <summary>
-		/// Creates a new OBJ model.
+		/// Creates a new OBJ model. Faces may be triangles, quads or n-gons, and may omit uvs or normals.
 		/// </summary>
 		/// <param name="filename"> The file to load the model from. </param>
 		ModelObj(const std::string &filename);
 
 		~ModelObj();
-	private:
-		VertexModelData *ProcessDataVertex(const Vector3 &vertex, std::vector<VertexModelData *> &vertices, std::vector<uint32_t> &indices);
-
-		VertexModelData *DealWithAlreadyProcessedDataVertex(VertexModelData *previousVertex, const int32_t &newTextureIndex, const int32_t &newNormalIndex, std::vector<VertexModelData *> &vertices, std::vector<uint32_t> &indices);
 
-		void CalculateTangents(VertexModelData *v0, VertexModelData *v1, VertexModelData *v2, std::vector<Vector2> &uvs);
+		/// <summary>
+		/// Parses a OBJ file into packed vertices and indices, without uploading them.
+		/// </summary>
+		/// <param name="filename"> The file to load the model from. </param>
+		/// <param name="vertices"> The vertices to fill. </param>
+		/// <param name="indices"> The indices to fill. </param>
+		/// <returns> If the file could be opened. </returns>
+		static bool Load(const std::string &filename, std::vector<VertexModel> &vertices, std::vector<uint32_t> &indices);
 	};
 }
@@ -17,8 +17,10 @@ namespace acid
 
 	void MeshPattern::GenerateMesh()
 	{
-		auto vertices = std::vector<IVertex *>();
+		auto vertices = std::vector<VertexModel>();
 		auto indices = std::vector<uint32_t>();
+		vertices.reserve(m_vertexCount * m_vertexCount);
+		indices.reserve((m_vertexCount - 1) * (m_vertexCount - 1) * 6);
 
 		// Creates and stores vertices.
 		for (uint32_t col = 0; col < m_vertexCount; col++)
@@ -64,7 +66,7 @@ namespace acid
 		Model::Set(vertices, indices);
 	}
 
-	VertexModel *MeshPattern::GetVertex(const uint32_t &col, const uint32_t &row)
+	VertexModel MeshPattern::GetVertex(const uint32_t &col, const uint32_t &row)
 	{
 		float x = ((row * m_squareSize) - m_sideLength) / 2.0f;
 		float z = ((col * m_squareSize) - m_sideLength) / 2.0f;
@@ -76,6 +78,6 @@ namespace acid
 		);
 		Vector3 normal = Vector3::UP;
 		Colour colour = Colour::WHITE;
-		return new VertexModel(position, uv, normal, colour);
+		return VertexModel(position, uv, normal, colour);
 	}
 }
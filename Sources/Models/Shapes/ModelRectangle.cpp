@@ -30,11 +30,11 @@ namespace acid
 	ModelRectangle::ModelRectangle(const float &min, const float &max) :
 		Model()
 	{
-		auto vertices = std::vector<IVertex *>{
-			new VertexModel(Vector3(min, min, 0.0f), Vector2(0.0f, 0.0f)),
-			new VertexModel(Vector3(max, min, 0.0f), Vector2(1.0f, 0.0f)),
-			new VertexModel(Vector3(max, max, 0.0f), Vector2(1.0f, 1.0f)),
-			new VertexModel(Vector3(min, max, 0.0f), Vector2(0.0f, 1.0f)),
+		auto vertices = std::vector<VertexModel>{
+			VertexModel(Vector3(min, min, 0.0f), Vector2(0.0f, 0.0f)),
+			VertexModel(Vector3(max, min, 0.0f), Vector2(1.0f, 0.0f)),
+			VertexModel(Vector3(max, max, 0.0f), Vector2(1.0f, 1.0f)),
+			VertexModel(Vector3(min, max, 0.0f), Vector2(0.0f, 1.0f)),
 		};
 		auto indices = std::vector<uint32_t>{
 			0, 3, 2,
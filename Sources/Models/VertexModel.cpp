@@ -2,6 +2,8 @@
 
 namespace acid
 {
+	static_assert(sizeof(VertexModel) == 11 * sizeof(float), "VertexModel must be tightly packed to match its vertex input");
+
 	VertexModel::VertexModel(const Vector3 &position, const Vector2 &uv, const Vector3 &normal, const Vector3 &tangent) :
 		m_position(position),
 		m_uv(uv),
@@ -22,22 +24,6 @@ namespace acid
 	{
 	}
 
-	void *VertexModel::GetData(std::vector<IVertex *> &vertices)
-	{
-		size_t dataSize = GetSize() * vertices.size();
-		void *data = new void *[dataSize];
-
-		std::vector<VertexModel> thisVector = std::vector<VertexModel>();
-
-		for (auto &vertex : vertices)
-		{
-			thisVector.emplace_back(*((VertexModel *) vertex));
-		}
-
-		memcpy(data, thisVector.data(), dataSize);
-		return data;
-	}
-
 	VertexInput VertexModel::GetVertexInput()
 	{
 		std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
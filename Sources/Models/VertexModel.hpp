@@ -5,12 +5,13 @@
 #include "Maths/Vector2.hpp"
 #include "Maths/Vector3.hpp"
 #include "Renderer/Pipelines/IPipeline.hpp"
-#include "IVertex.hpp"
 
 namespace acid
 {
-	class ACID_EXPORT VertexModel :
-		public IVertex
+	/// <summary>
+	/// A vertex with a position, uv, normal and tangent. It has no virtual functions so a vector of vertices is the exact layout uploaded to the GPU.
+	/// </summary>
+	class ACID_EXPORT VertexModel
 	{
 	public:
 		Vector3 m_position;
@@ -24,9 +25,9 @@ namespace acid
 
 		~VertexModel();
 
-		Vector3 GetPosition() const override { return m_position; };
+		Vector3 GetPosition() const { return m_position; };
 
-		void SetPosition(const Vector3 &position) override { m_position = position; };
+		void SetPosition(const Vector3 &position) { m_position = position; };
 
 		Vector2 GetUv() const { return m_uv; };
 
@@ -40,10 +41,6 @@ namespace acid
 
 		void SetTangent(const Vector3 &tangent) { m_tangent = tangent; };
 
-		size_t GetSize() const override { return sizeof(VertexModel); }
-
-		void *GetData(std::vector<IVertex *> &vertices) override;
-
 		static VertexInput GetVertexInput();
 	};
 }
@@ -2,9 +2,12 @@
 
 #include <cassert>
 #include <random>
+#include "Engine/Engine.hpp"
 
 namespace acid
 {
+	const uint32_t Noise::PARALLEL_GRAIN_SIZE = 16;
+
 	// Hashing
 	static const int32_t X_PRIME = 1619;
 	static const int32_t Y_PRIME = 31337;
@@ -904,6 +907,102 @@ namespace acid
 		return ValueCoord4d(m_seed, x, y, z, w);
 	}
 
+	// Grids
+	void Noise::FillGrid2D(float *out, const Vector2 &origin, const Vector2 &step, const uint32_t &sizeX, const uint32_t &sizeY) const
+	{
+		auto fillRows = [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t row = begin; row < end; row++)
+			{
+				FillRow2D(out + (row * sizeX), origin.m_x, step.m_x, sizeX, origin.m_y + static_cast<float>(row) * step.m_y);
+			}
+		};
+
+		if (Engine::Get() == nullptr)
+		{
+			fillRows(0, sizeY);
+			return;
+		}
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		threadPool.Wait(threadPool.ParallelFor(0, sizeY, fillRows, PARALLEL_GRAIN_SIZE));
+	}
+
+	void Noise::FillGrid3D(float *out, const Vector3 &origin, const Vector3 &step, const uint32_t &sizeX, const uint32_t &sizeY, const uint32_t &sizeZ) const
+	{
+		auto fillRows = [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t row = begin; row < end; row++)
+			{
+				float y = origin.m_y + static_cast<float>(row % sizeY) * step.m_y;
+				float z = origin.m_z + static_cast<float>(row / sizeY) * step.m_z;
+				FillRow3D(out + (row * sizeX), origin.m_x, step.m_x, sizeX, y, z);
+			}
+		};
+
+		if (Engine::Get() == nullptr)
+		{
+			fillRows(0, sizeY * sizeZ);
+			return;
+		}
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		threadPool.Wait(threadPool.ParallelFor(0, sizeY * sizeZ, fillRows, PARALLEL_GRAIN_SIZE));
+	}
+
+	void Noise::FillRow2D(float *out, const float &originX, const float &stepX, const uint32_t &sizeX, const float &y) const
+	{
+		uint32_t i = 0;
+
+#if ACID_SIMD_SSE
+		if (IsSimdType())
+		{
+			__m128 frequency = _mm_set1_ps(m_frequency);
+			__m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+			__m128 ys = _mm_mul_ps(_mm_set1_ps(y), frequency);
+
+			for (; i + 4 <= sizeX; i += 4)
+			{
+				__m128 index = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lanes);
+				__m128 xs = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(originX), _mm_mul_ps(index, _mm_set1_ps(stepX))), frequency);
+				_mm_storeu_ps(out + i, SimdFractal(xs, ys));
+			}
+		}
+#endif
+
+		for (; i < sizeX; i++)
+		{
+			out[i] = GetNoise(originX + static_cast<float>(i) * stepX, y);
+		}
+	}
+
+	void Noise::FillRow3D(float *out, const float &originX, const float &stepX, const uint32_t &sizeX, const float &y, const float &z) const
+	{
+		uint32_t i = 0;
+
+#if ACID_SIMD_SSE
+		if (IsSimdType())
+		{
+			__m128 frequency = _mm_set1_ps(m_frequency);
+			__m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+			__m128 ys = _mm_mul_ps(_mm_set1_ps(y), frequency);
+			__m128 zs = _mm_mul_ps(_mm_set1_ps(z), frequency);
+
+			for (; i + 4 <= sizeX; i += 4)
+			{
+				__m128 index = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lanes);
+				__m128 xs = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(originX), _mm_mul_ps(index, _mm_set1_ps(stepX))), frequency);
+				_mm_storeu_ps(out + i, SimdFractal(xs, ys, zs));
+			}
+		}
+#endif
+
+		for (; i < sizeX; i++)
+		{
+			out[i] = GetNoise(originX + static_cast<float>(i) * stepX, y, z);
+		}
+	}
+
 	void Noise::CalculateFractalBounding()
 	{
 		float amp = m_gain;
@@ -2646,4 +2745,237 @@ namespace acid
 
 		return 27.0f * (n0 + n1 + n2 + n3 + n4);
 	}
+
+#if ACID_SIMD_SSE
+	// SIMD
+	bool Noise::IsSimdType() const
+	{
+		switch (m_noiseType)
+		{
+		case TYPE_VALUE:
+		case TYPE_PERLIN:
+			return true;
+		case TYPE_VALUEFRACTAL:
+		case TYPE_PERLINFRACTAL:
+			return m_fractalType == FRACTAL_FBM || m_fractalType == FRACTAL_BILLOW || m_fractalType == FRACTAL_RIGIDMULTI;
+		default:
+			return false;
+		}
+	}
+
+	__m128i Noise::SimdFloor(const __m128 &f)
+	{
+		// Matches FastFloor, truncates then subtracts one from every lane that is not >= 0.
+		__m128i truncated = _mm_cvttps_epi32(f);
+		__m128i negative = _mm_castps_si128(_mm_cmpnge_ps(f, _mm_setzero_ps()));
+		return _mm_add_epi32(truncated, negative);
+	}
+
+	__m128 Noise::SimdLerp(const __m128 &a, const __m128 &b, const __m128 &t)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+	}
+
+	__m128 Noise::SimdInterp(const __m128 &t) const
+	{
+		switch (m_interp)
+		{
+		case INTERP_HERMITE:
+			return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_set1_ps(2.0f), t)));
+		case INTERP_QUINTIC:
+		{
+			__m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+			return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+		}
+		default:
+			return t;
+		}
+	}
+
+	__m128 Noise::SimdOctave(const __m128 &value) const
+	{
+		__m128 absolute = _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+
+		switch (m_fractalType)
+		{
+		case FRACTAL_BILLOW:
+			return _mm_sub_ps(_mm_mul_ps(absolute, _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f));
+		case FRACTAL_RIGIDMULTI:
+			return _mm_sub_ps(_mm_set1_ps(1.0f), absolute);
+		default:
+			return value;
+		}
+	}
+
+	__m128 Noise::SimdFractal(__m128 x, __m128 y) const
+	{
+		if (m_noiseType == TYPE_VALUE || m_noiseType == TYPE_PERLIN)
+		{
+			return SimdSingle(0, x, y);
+		}
+
+		__m128 lacunarity = _mm_set1_ps(m_lacunarity);
+		__m128 sum = SimdOctave(SimdSingle(m_perm[0], x, y));
+		float amp = 1.0f;
+		int32_t i = 0;
+
+		while (++i < m_octaves)
+		{
+			x = _mm_mul_ps(x, lacunarity);
+			y = _mm_mul_ps(y, lacunarity);
+
+			amp *= m_gain;
+			__m128 octave = _mm_mul_ps(SimdOctave(SimdSingle(m_perm[i], x, y)), _mm_set1_ps(amp));
+			sum = m_fractalType == FRACTAL_RIGIDMULTI ? _mm_sub_ps(sum, octave) : _mm_add_ps(sum, octave);
+		}
+
+		return m_fractalType == FRACTAL_RIGIDMULTI ? sum : _mm_mul_ps(sum, _mm_set1_ps(m_fractalBounding));
+	}
+
+	__m128 Noise::SimdSingle(const uint8_t &offset, const __m128 &x, const __m128 &y) const
+	{
+		__m128i x0 = SimdFloor(x);
+		__m128i y0 = SimdFloor(y);
+		__m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+		__m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+		__m128 xs = SimdInterp(xd0);
+		__m128 ys = SimdInterp(yd0);
+
+		alignas(16) int32_t xi[4];
+		alignas(16) int32_t yi[4];
+		alignas(16) float corners[4][4];
+		_mm_store_si128(reinterpret_cast<__m128i *>(xi), x0);
+		_mm_store_si128(reinterpret_cast<__m128i *>(yi), y0);
+
+		// The permutation table lookups have no SSE gather, they are done per lane.
+		if (m_noiseType == TYPE_VALUE || m_noiseType == TYPE_VALUEFRACTAL)
+		{
+			for (int32_t lane = 0; lane < 4; lane++)
+			{
+				corners[0][lane] = ValueCoord2dFast(offset, xi[lane], yi[lane]);
+				corners[1][lane] = ValueCoord2dFast(offset, xi[lane] + 1, yi[lane]);
+				corners[2][lane] = ValueCoord2dFast(offset, xi[lane], yi[lane] + 1);
+				corners[3][lane] = ValueCoord2dFast(offset, xi[lane] + 1, yi[lane] + 1);
+			}
+		}
+		else
+		{
+			alignas(16) float xd[4];
+			alignas(16) float yd[4];
+			_mm_store_ps(xd, xd0);
+			_mm_store_ps(yd, yd0);
+
+			for (int32_t lane = 0; lane < 4; lane++)
+			{
+				float xd1 = xd[lane] - 1.0f;
+				float yd1 = yd[lane] - 1.0f;
+				corners[0][lane] = GradCoord2d(offset, xi[lane], yi[lane], xd[lane], yd[lane]);
+				corners[1][lane] = GradCoord2d(offset, xi[lane] + 1, yi[lane], xd1, yd[lane]);
+				corners[2][lane] = GradCoord2d(offset, xi[lane], yi[lane] + 1, xd[lane], yd1);
+				corners[3][lane] = GradCoord2d(offset, xi[lane] + 1, yi[lane] + 1, xd1, yd1);
+			}
+		}
+
+		__m128 xf0 = SimdLerp(_mm_load_ps(corners[0]), _mm_load_ps(corners[1]), xs);
+		__m128 xf1 = SimdLerp(_mm_load_ps(corners[2]), _mm_load_ps(corners[3]), xs);
+
+		return SimdLerp(xf0, xf1, ys);
+	}
+
+	__m128 Noise::SimdFractal(__m128 x, __m128 y, __m128 z) const
+	{
+		if (m_noiseType == TYPE_VALUE || m_noiseType == TYPE_PERLIN)
+		{
+			return SimdSingle(0, x, y, z);
+		}
+
+		__m128 lacunarity = _mm_set1_ps(m_lacunarity);
+		__m128 sum = SimdOctave(SimdSingle(m_perm[0], x, y, z));
+		float amp = 1.0f;
+		int32_t i = 0;
+
+		while (++i < m_octaves)
+		{
+			x = _mm_mul_ps(x, lacunarity);
+			y = _mm_mul_ps(y, lacunarity);
+			z = _mm_mul_ps(z, lacunarity);
+
+			amp *= m_gain;
+			__m128 octave = _mm_mul_ps(SimdOctave(SimdSingle(m_perm[i], x, y, z)), _mm_set1_ps(amp));
+			sum = m_fractalType == FRACTAL_RIGIDMULTI ? _mm_sub_ps(sum, octave) : _mm_add_ps(sum, octave);
+		}
+
+		return m_fractalType == FRACTAL_RIGIDMULTI ? sum : _mm_mul_ps(sum, _mm_set1_ps(m_fractalBounding));
+	}
+
+	__m128 Noise::SimdSingle(const uint8_t &offset, const __m128 &x, const __m128 &y, const __m128 &z) const
+	{
+		__m128i x0 = SimdFloor(x);
+		__m128i y0 = SimdFloor(y);
+		__m128i z0 = SimdFloor(z);
+		__m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+		__m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+		__m128 zd0 = _mm_sub_ps(z, _mm_cvtepi32_ps(z0));
+		__m128 xs = SimdInterp(xd0);
+		__m128 ys = SimdInterp(yd0);
+		__m128 zs = SimdInterp(zd0);
+
+		alignas(16) int32_t xi[4];
+		alignas(16) int32_t yi[4];
+		alignas(16) int32_t zi[4];
+		alignas(16) float corners[8][4];
+		_mm_store_si128(reinterpret_cast<__m128i *>(xi), x0);
+		_mm_store_si128(reinterpret_cast<__m128i *>(yi), y0);
+		_mm_store_si128(reinterpret_cast<__m128i *>(zi), z0);
+
+		if (m_noiseType == TYPE_VALUE || m_noiseType == TYPE_VALUEFRACTAL)
+		{
+			for (int32_t lane = 0; lane < 4; lane++)
+			{
+				corners[0][lane] = ValueCoord3dFast(offset, xi[lane], yi[lane], zi[lane]);
+				corners[1][lane] = ValueCoord3dFast(offset, xi[lane] + 1, yi[lane], zi[lane]);
+				corners[2][lane] = ValueCoord3dFast(offset, xi[lane], yi[lane] + 1, zi[lane]);
+				corners[3][lane] = ValueCoord3dFast(offset, xi[lane] + 1, yi[lane] + 1, zi[lane]);
+				corners[4][lane] = ValueCoord3dFast(offset, xi[lane], yi[lane], zi[lane] + 1);
+				corners[5][lane] = ValueCoord3dFast(offset, xi[lane] + 1, yi[lane], zi[lane] + 1);
+				corners[6][lane] = ValueCoord3dFast(offset, xi[lane], yi[lane] + 1, zi[lane] + 1);
+				corners[7][lane] = ValueCoord3dFast(offset, xi[lane] + 1, yi[lane] + 1, zi[lane] + 1);
+			}
+		}
+		else
+		{
+			alignas(16) float xd[4];
+			alignas(16) float yd[4];
+			alignas(16) float zd[4];
+			_mm_store_ps(xd, xd0);
+			_mm_store_ps(yd, yd0);
+			_mm_store_ps(zd, zd0);
+
+			for (int32_t lane = 0; lane < 4; lane++)
+			{
+				float xd1 = xd[lane] - 1.0f;
+				float yd1 = yd[lane] - 1.0f;
+				float zd1 = zd[lane] - 1.0f;
+				corners[0][lane] = GradCoord3d(offset, xi[lane], yi[lane], zi[lane], xd[lane], yd[lane], zd[lane]);
+				corners[1][lane] = GradCoord3d(offset, xi[lane] + 1, yi[lane], zi[lane], xd1, yd[lane], zd[lane]);
+				corners[2][lane] = GradCoord3d(offset, xi[lane], yi[lane] + 1, zi[lane], xd[lane], yd1, zd[lane]);
+				corners[3][lane] = GradCoord3d(offset, xi[lane] + 1, yi[lane] + 1, zi[lane], xd1, yd1, zd[lane]);
+				corners[4][lane] = GradCoord3d(offset, xi[lane], yi[lane], zi[lane] + 1, xd[lane], yd[lane], zd1);
+				corners[5][lane] = GradCoord3d(offset, xi[lane] + 1, yi[lane], zi[lane] + 1, xd1, yd[lane], zd1);
+				corners[6][lane] = GradCoord3d(offset, xi[lane], yi[lane] + 1, zi[lane] + 1, xd[lane], yd1, zd1);
+				corners[7][lane] = GradCoord3d(offset, xi[lane] + 1, yi[lane] + 1, zi[lane] + 1, xd1, yd1, zd1);
+			}
+		}
+
+		__m128 xf00 = SimdLerp(_mm_load_ps(corners[0]), _mm_load_ps(corners[1]), xs);
+		__m128 xf10 = SimdLerp(_mm_load_ps(corners[2]), _mm_load_ps(corners[3]), xs);
+		__m128 xf01 = SimdLerp(_mm_load_ps(corners[4]), _mm_load_ps(corners[5]), xs);
+		__m128 xf11 = SimdLerp(_mm_load_ps(corners[6]), _mm_load_ps(corners[7]), xs);
+
+		__m128 yf0 = SimdLerp(xf00, xf10, ys);
+		__m128 yf1 = SimdLerp(xf01, xf11, ys);
+
+		return SimdLerp(yf0, yf1, zs);
+	}
+#endif
 }
@@ -27,6 +27,9 @@
 #include <cstdint>
 #include <memory>
 #include "Engine/Exports.hpp"
+#include "Maths/Simd.hpp"
+#include "Maths/Vector2.hpp"
+#include "Maths/Vector3.hpp"
 
 namespace acid
 {
@@ -80,6 +83,8 @@ namespace acid
 	class ACID_EXPORT Noise
 	{
 	private:
+		static const uint32_t PARALLEL_GRAIN_SIZE;
+
 		int32_t m_seed;
 		std::unique_ptr<uint8_t[]> m_perm;
 		std::unique_ptr<uint8_t[]> m_perm12;
@@ -279,9 +284,42 @@ namespace acid
 
 		float GetWhiteNoiseInt(int32_t x, int32_t y, int32_t z, int32_t w) const;
 
+		// Grids
+		// Fills out[y * sizeX + x] with GetNoise(origin + (x, y) * step), rows are split over the engine thread pool
+		// Value and Perlin types, fractal or not, are evaluated four samples at a time when SSE is available
+		void FillGrid2D(float *out, const Vector2 &origin, const Vector2 &step, const uint32_t &sizeX, const uint32_t &sizeY) const;
+
+		// Fills out[(z * sizeY + y) * sizeX + x] with GetNoise(origin + (x, y, z) * step)
+		void FillGrid3D(float *out, const Vector3 &origin, const Vector3 &step, const uint32_t &sizeX, const uint32_t &sizeY, const uint32_t &sizeZ) const;
+
 	private:
 		void CalculateFractalBounding();
 
+		void FillRow2D(float *out, const float &originX, const float &stepX, const uint32_t &sizeX, const float &y) const;
+
+		void FillRow3D(float *out, const float &originX, const float &stepX, const uint32_t &sizeX, const float &y, const float &z) const;
+
+#if ACID_SIMD_SSE
+		// SIMD, four samples per call with the same operation order as the scalar versions
+		bool IsSimdType() const;
+
+		static __m128i SimdFloor(const __m128 &f);
+
+		static __m128 SimdLerp(const __m128 &a, const __m128 &b, const __m128 &t);
+
+		__m128 SimdInterp(const __m128 &t) const;
+
+		__m128 SimdOctave(const __m128 &value) const;
+
+		__m128 SimdFractal(__m128 x, __m128 y) const;
+
+		__m128 SimdSingle(const uint8_t &offset, const __m128 &x, const __m128 &y) const;
+
+		__m128 SimdFractal(__m128 x, __m128 y, __m128 z) const;
+
+		__m128 SimdSingle(const uint8_t &offset, const __m128 &x, const __m128 &y, const __m128 &z) const;
+#endif
+
 		// Helpers
 		static int32_t FastFloor(const float &f);
 
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include "IComponent.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A contiguous list of the components of one type, kept by a structure as components are attached and detached.
+	/// </summary>
+	class ACID_EXPORT IComponentPool
+	{
+	public:
+		virtual ~IComponentPool()
+		{
+		}
+
+		/// <summary>
+		/// Adds a component to the pool if it is of the pools type.
+		/// </summary>
+		/// <param name="component"> The component to add. </param>
+		virtual void Add(IComponent *component) = 0;
+
+		/// <summary>
+		/// Removes a component from the pool if it is in the pool.
+		/// </summary>
+		/// <param name="component"> The component to remove. </param>
+		virtual void Remove(IComponent *component) = 0;
+
+		/// <summary>
+		/// Removes all components from the pool.
+		/// </summary>
+		virtual void Clear() = 0;
+	};
+
+	/// <summary>
+	/// A pool of components that are, or derive from, a type. Removing a component moves the last component into its
+	/// place, so components are in no particular order. Each component keeps the number it was added with, so the first
+	/// added component can still be found.
+	/// </summary>
+	/// <param name="T"> The component type. </param>
+	template<typename T>
+	class ComponentPool :
+		public IComponentPool
+	{
+	private:
+		std::vector<T *> m_components;
+		std::vector<uint64_t> m_orders;
+		std::unordered_map<IComponent *, uint32_t> m_indices;
+		uint64_t m_nextOrder;
+	public:
+		ComponentPool() :
+			IComponentPool(),
+			m_components(std::vector<T *>()),
+			m_orders(std::vector<uint64_t>()),
+			m_indices(std::unordered_map<IComponent *, uint32_t>()),
+			m_nextOrder(0)
+		{
+		}
+
+		void Add(IComponent *component) override
+		{
+			auto casted = dynamic_cast<T *>(component);
+
+			if (casted == nullptr || m_indices.find(component) != m_indices.end())
+			{
+				return;
+			}
+
+			m_indices.emplace(component, static_cast<uint32_t>(m_components.size()));
+			m_components.emplace_back(casted);
+			m_orders.emplace_back(m_nextOrder++);
+		}
+
+		void Remove(IComponent *component) override
+		{
+			auto it = m_indices.find(component);
+
+			if (it == m_indices.end())
+			{
+				return;
+			}
+
+			uint32_t index = it->second;
+			m_indices.erase(it);
+
+			if (index != m_components.size() - 1)
+			{
+				m_components[index] = m_components.back();
+				m_orders[index] = m_orders.back();
+				m_indices[m_components[index]] = index;
+			}
+
+			m_components.pop_back();
+			m_orders.pop_back();
+		}
+
+		void Clear() override
+		{
+			m_components.clear();
+			m_orders.clear();
+			m_indices.clear();
+		}
+
+		/// <summary>
+		/// Gets the component that was added to this pool first and is still in it.
+		/// </summary>
+		/// <param name="allowDisabled"> If disabled components will be included. </param>
+		/// <returns> The first added component, or null if there is none. </returns>
+		T *GetFirst(const bool &allowDisabled) const
+		{
+			T *result = nullptr;
+			uint64_t resultOrder = 0;
+
+			for (uint32_t i = 0; i < m_components.size(); i++)
+			{
+				if (!allowDisabled && !m_components[i]->IsEnabled())
+				{
+					continue;
+				}
+
+				if (result == nullptr || m_orders[i] < resultOrder)
+				{
+					result = m_components[i];
+					resultOrder = m_orders[i];
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Gets the components in this pool.
+		/// </summary>
+		/// <returns> The components. </returns>
+		const std::vector<T *> &GetComponents() const { return m_components; }
+	};
+}
@@ -0,0 +1,31 @@
+#include "ComponentTypes.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace acid
+{
+	static std::mutex typeMutex;
+
+	/// <summary>
+	/// Gets the index of every type looked up so far, created on first use as types may be looked up while statics are initialized.
+	/// </summary>
+	static std::unordered_map<std::type_index, uint32_t> &GetTypeIds()
+	{
+		static std::unordered_map<std::type_index, uint32_t> typeIds = std::unordered_map<std::type_index, uint32_t>();
+		return typeIds;
+	}
+
+	uint32_t ComponentTypes::GetId(const std::type_index &type)
+	{
+		std::lock_guard<std::mutex> lock(typeMutex);
+		auto &typeIds = GetTypeIds();
+		return typeIds.emplace(type, static_cast<uint32_t>(typeIds.size())).first->second;
+	}
+
+	uint32_t ComponentTypes::GetCount()
+	{
+		std::lock_guard<std::mutex> lock(typeMutex);
+		return static_cast<uint32_t>(GetTypeIds().size());
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <typeindex>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Hands out a small index for each component type, so per type data can be kept in arrays instead of being found
+	/// with casts. Indices are given in the order types are first used, and only stay the same for one run. The indices
+	/// are kept in one registry in the engine library, so modules that look up the same type get the same index.
+	/// </summary>
+	class ACID_EXPORT ComponentTypes
+	{
+	public:
+		/// <summary>
+		/// Gets the index of a component type.
+		/// </summary>
+		/// <param name="T"> The component type. </param>
+		/// <returns> The index of the type. </returns>
+		template<typename T>
+		static uint32_t GetId()
+		{
+			// Each module caches its own copy, all of them are read from the shared registry.
+			static const uint32_t id = GetId(typeid(T));
+			return id;
+		}
+
+		/// <summary>
+		/// Gets the index of a component type from the registry, giving the type the next index if it has none yet.
+		/// </summary>
+		/// <param name="type"> The component type. </param>
+		/// <returns> The index of the type. </returns>
+		static uint32_t GetId(const std::type_index &type);
+
+		/// <summary>
+		/// Gets how many component types have been given an index.
+		/// </summary>
+		/// <returns> The number of indexed types. </returns>
+		static uint32_t GetCount();
+	};
+}
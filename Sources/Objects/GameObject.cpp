@@ -1,11 +1,16 @@
 #include "GameObject.hpp"
 
+#include <algorithm>
 #include "Helpers/FileSystem.hpp"
 #include "Prefabs/PrefabObject.hpp"
 #include "Scenes/Scenes.hpp"
 
 namespace acid
 {
+	const uint32_t GameObject::MAX_LOOKUPS = 64;
+	const int32_t GameObject::LOOKUP_NONE = -1;
+	const int32_t GameObject::LOOKUP_UNKNOWN = -2;
+
 	std::shared_ptr<GameObject> GameObject::Resource(const Transform &transform, ISpatialStructure *structure)
 	{
 		if (structure == nullptr)
@@ -44,18 +49,27 @@ namespace acid
 		m_name(""),
 		m_transform(transform),
 		m_components(std::vector<std::shared_ptr<IComponent>>()),
+		m_lookups(std::vector<std::atomic<int32_t>>(MAX_LOOKUPS)),
+		m_structure(nullptr),
 		m_parent(),
+		m_children(std::vector<GameObject *>()),
 		m_removed(false)
 	{
+		ResetLookups();
 	}
 
 	GameObject::GameObject(const std::string &filepath, const Transform &transform) :
 		m_name(""),
 		m_transform(transform),
 		m_components(std::vector<std::shared_ptr<IComponent>>()),
+		m_lookups(std::vector<std::atomic<int32_t>>(MAX_LOOKUPS)),
+		m_structure(nullptr),
 		m_parent(),
+		m_children(std::vector<GameObject *>()),
 		m_removed(false)
 	{
+		ResetLookups();
+
 		auto prefabObject = PrefabObject::Resource(filepath);
 
 		for (auto &value : prefabObject->GetParent()->GetChildren())
@@ -81,6 +95,14 @@ namespace acid
 
 	GameObject::~GameObject()
 	{
+		// Children keep a pointer to this objects transform, they must not read it once it is gone.
+		for (auto &child : m_children)
+		{
+			child->m_parent.reset();
+			child->m_transform.SetParent(nullptr);
+		}
+
+		SetParent(nullptr);
 	}
 
 	void GameObject::Update()
@@ -105,6 +127,51 @@ namespace acid
 		}
 	}
 
+	void GameObject::SetParent(const std::shared_ptr<GameObject> &parent)
+	{
+		auto oldParent = m_parent.lock();
+
+		if (oldParent != nullptr)
+		{
+			oldParent->m_children.erase(std::remove(oldParent->m_children.begin(), oldParent->m_children.end(), this), oldParent->m_children.end());
+		}
+
+		if (parent != nullptr)
+		{
+			parent->m_children.emplace_back(this);
+		}
+
+		m_parent = parent;
+		m_transform.SetParent(parent != nullptr ? &parent->m_transform : nullptr);
+	}
+
+	void GameObject::SetRemoved(const bool &removed)
+	{
+		if (m_removed == removed)
+		{
+			return;
+		}
+
+		m_removed = removed;
+
+		if (m_structure == nullptr)
+		{
+			return;
+		}
+
+		for (auto &component : m_components)
+		{
+			if (removed)
+			{
+				m_structure->OnComponentRemove(component.get());
+			}
+			else
+			{
+				m_structure->OnComponentAdd(component.get());
+			}
+		}
+	}
+
 	std::shared_ptr<IComponent> GameObject::AddComponent(const std::shared_ptr<IComponent> &component)
 	{
 		if (component == nullptr)
@@ -114,6 +181,13 @@ namespace acid
 
 		component->SetGameObject(this);
 		m_components.emplace_back(component);
+		ResetLookups();
+
+		if (m_structure != nullptr)
+		{
+			m_structure->OnComponentAdd(component.get());
+		}
+
 		return component;
 	}
 
@@ -123,9 +197,15 @@ namespace acid
 		{
 			if (*it != nullptr && *it == component)
 			{
+				if (m_structure != nullptr)
+				{
+					m_structure->OnComponentRemove(it->get());
+				}
+
 				(*it)->SetGameObject(nullptr);
 
 				m_components.erase(it);
+				ResetLookups();
 				return true;
 			}
 		}
@@ -146,13 +226,27 @@ namespace acid
 					continue;
 				}
 
+				if (m_structure != nullptr)
+				{
+					m_structure->OnComponentRemove(it->get());
+				}
+
 				(*it)->SetGameObject(nullptr);
 
 				m_components.erase(it);
+				ResetLookups();
 				return true;
 			}
 		}
 
 		return false;
 	}
+
+	void GameObject::ResetLookups()
+	{
+		for (auto &lookup : m_lookups)
+		{
+			lookup.store(LOOKUP_UNKNOWN, std::memory_order_relaxed);
+		}
+	}
 }
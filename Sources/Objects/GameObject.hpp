@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include "Engine/Exports.hpp"
 #include "Maths/Transform.hpp"
 #include "Scenes/ISpatialStructure.hpp"
+#include "ComponentTypes.hpp"
 #include "IComponent.hpp"
 
 namespace acid
@@ -14,12 +16,21 @@ namespace acid
 	/// </summary>
 	class ACID_EXPORT GameObject
 	{
+	public:
+		static const uint32_t MAX_LOOKUPS;
+		static const int32_t LOOKUP_NONE;
+		static const int32_t LOOKUP_UNKNOWN;
 	private:
 		std::string m_name;
 		Transform m_transform;
 		std::vector<std::shared_ptr<IComponent>> m_components;
+		std::vector<std::atomic<int32_t>> m_lookups;
+		ISpatialStructure *m_structure;
 		std::weak_ptr<GameObject> m_parent;
+		std::vector<GameObject *> m_children;
 		bool m_removed;
+
+		friend class SceneStructure;
 	public:
 		/// <summary>
 		/// Will create a new Game Object and store it into a structure.
@@ -51,32 +62,21 @@ namespace acid
 		std::vector<std::shared_ptr<IComponent>> GetComponents() const { return m_components; }
 
 		/// <summary>
-		/// Gets a component by type.
+		/// Gets a component by type, an enabled component is preferred over a disabled one.
 		/// </summary>
 		/// <param name="T"> The component type to find. </param>
 		/// <returns> The found component. </returns>
 		template<typename T>
 		std::shared_ptr<T> GetComponent(const bool &allowDisabled = false)
 		{
-			std::shared_ptr<T> alternative = nullptr;
+			int32_t index = FindComponent<T>(allowDisabled);
 
-			for (auto &component : m_components)
+			if (index == LOOKUP_NONE)
 			{
-				auto casted = std::dynamic_pointer_cast<T>(component);
-
-				if (casted != nullptr)
-				{
-					if (!allowDisabled && !casted->IsEnabled())
-					{
-						alternative = casted;
-						continue;
-					}
-
-					return casted;
-				}
+				return nullptr;
 			}
 
-			return alternative;
+			return std::static_pointer_cast<T>(m_components[index]);
 		}
 
 		/// <summary>
@@ -122,18 +122,14 @@ namespace acid
 		template<typename T>
 		bool RemoveComponent()
 		{
-			for (auto &component : m_components)
-			{
-				auto casted = std::dynamic_pointer_cast<T>(component);
+			int32_t index = FindComponent<T>(true);
 
-				if (casted != nullptr)
-				{
-					RemoveComponent(component);
-					return true;
-				}
+			if (index == LOOKUP_NONE)
+			{
+				return false;
 			}
 
-			return false;
+			return RemoveComponent(m_components[index]);
 		}
 
 		std::string GetName() const { return m_name; }
@@ -144,10 +140,103 @@ namespace acid
 
 		std::weak_ptr<GameObject> GetParent() const { return m_parent; }
 
-		void SetParent(const std::shared_ptr<GameObject> &parent) { m_parent = parent; }
+		/// <summary>
+		/// Sets the object this objects transform is relative to. When the parent is destroyed this object is placed back in world space.
+		/// </summary>
+		/// <param name="parent"> The parent object, or null to place this object in world space. </param>
+		void SetParent(const std::shared_ptr<GameObject> &parent);
 
 		bool IsRemoved() const { return m_removed; }
 
-		void SetRemoved(const bool &removed) { m_removed = removed; }
+		/// <summary>
+		/// Sets if this object is removed, the components of a removed object are taken out of the structures pools.
+		/// </summary>
+		/// <param name="removed"> If the object is removed. </param>
+		void SetRemoved(const bool &removed);
+
+		ISpatialStructure *GetStructure() const { return m_structure; }
+
+		/// <summary>
+		/// Sets the structure this object is stored in, it is told when components are attached or detached.
+		/// </summary>
+		/// <param name="structure"> The structure storing this object. </param>
+		void SetStructure(ISpatialStructure *structure) { m_structure = structure; }
+	private:
+		/// <summary>
+		/// Finds the index of a component by type. The first component of each type is remembered in a table indexed by
+		/// the type, so casts are only made again after components are attached or detached. The table is atomic as objects
+		/// are read from worker threads while rendering.
+		/// </summary>
+		/// <param name="T"> The component type to find. </param>
+		/// <param name="allowDisabled"> If a disabled component may be found before an enabled one. </param>
+		/// <returns> The index of the component, or none. </returns>
+		template<typename T>
+		int32_t FindComponent(const bool &allowDisabled)
+		{
+			uint32_t typeId = ComponentTypes::GetId<T>();
+
+			if (typeId < MAX_LOOKUPS)
+			{
+				int32_t index = m_lookups[typeId].load(std::memory_order_relaxed);
+
+				if (index == LOOKUP_UNKNOWN)
+				{
+					index = SearchComponent<T>(true);
+					m_lookups[typeId].store(index, std::memory_order_relaxed);
+				}
+
+				if (index == LOOKUP_NONE || allowDisabled || m_components[index]->IsEnabled())
+				{
+					return index;
+				}
+			}
+
+			return SearchComponent<T>(allowDisabled);
+		}
+
+		template<typename T>
+		int32_t SearchComponent(const bool &allowDisabled) const
+		{
+			int32_t alternative = LOOKUP_NONE;
+
+			for (uint32_t i = 0; i < m_components.size(); i++)
+			{
+				if (dynamic_cast<T *>(m_components[i].get()) == nullptr)
+				{
+					continue;
+				}
+
+				if (!allowDisabled && !m_components[i]->IsEnabled())
+				{
+					alternative = static_cast<int32_t>(i);
+					continue;
+				}
+
+				return static_cast<int32_t>(i);
+			}
+
+			return alternative;
+		}
+
+		/// <summary>
+		/// Gets a component by type without taking a reference to it.
+		/// </summary>
+		/// <param name="T"> The component type to find. </param>
+		/// <param name="allowDisabled"> If a disabled component may be found before an enabled one. </param>
+		/// <returns> The found component. </returns>
+		template<typename T>
+		T *GetComponentPointer(const bool &allowDisabled)
+		{
+			int32_t index = FindComponent<T>(allowDisabled);
+
+			if (index == LOOKUP_NONE)
+			{
+				return nullptr;
+			}
+
+			return static_cast<T *>(m_components[index].get());
+		}
+
+		void ResetLookups();
 	};
 }
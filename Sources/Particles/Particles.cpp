@@ -1,10 +1,12 @@
 #include "Particles.hpp"
 
+#include <algorithm>
 #include "Scenes/Scenes.hpp"
 
 namespace acid
 {
 	const float Particles::MAX_ELAPSED_TIME = 5.0f;
+	const uint32_t Particles::PARALLEL_GRAIN_SIZE = 256;
 
 	Particles::Particles() :
 		m_particles(std::map<std::shared_ptr<ParticleType>, std::vector<Particle>>())
@@ -22,23 +24,41 @@ namespace acid
 			return;
 		}
 
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		std::vector<JobHandle> jobs = {};
+
 		for (auto it = m_particles.begin(); it != m_particles.end(); ++it)
 		{
-			for (auto it1 = (*it).second.begin(); it1 != (*it).second.end();)
+			auto &particles = (*it).second;
+			jobs.emplace_back(threadPool.ParallelFor(0, static_cast<uint32_t>(particles.size()), [&particles](uint32_t begin, uint32_t end)
 			{
-				(*it1).Update();
-
-				if (!(*it1).IsAlive())
+				for (uint32_t i = begin; i < end; i++)
 				{
-					it1 = (*it).second.erase(it1);
-					continue;
+					particles[i].Update();
 				}
+			}, PARALLEL_GRAIN_SIZE));
+		}
+
+		for (auto &job : jobs)
+		{
+			threadPool.Wait(job);
+		}
 
-				++it1;
-			}
+		for (auto it = m_particles.begin(); it != m_particles.end(); ++it)
+		{
+			auto &particles = (*it).second;
+			particles.erase(std::remove_if(particles.begin(), particles.end(), [](const Particle &particle)
+			{
+				return !particle.IsAlive();
+			}), particles.end());
 		}
 	}
 
+	std::optional<ModuleAccess> Particles::GetAccess() const
+	{
+		return ModuleAccess().Write<Particles>().Read<Scenes>();
+	}
+
 	void Particles::AddParticle(const Particle &particle)
 	{
 		auto it = m_particles.find(particle.GetParticleType());
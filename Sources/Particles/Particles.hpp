@@ -15,6 +15,7 @@ namespace acid
 	{
 	private:
 		static const float MAX_ELAPSED_TIME;
+		static const uint32_t PARALLEL_GRAIN_SIZE;
 
 		std::map<std::shared_ptr<ParticleType>, std::vector<Particle>> m_particles;
 	public:
@@ -30,6 +31,8 @@ namespace acid
 
 		void Update() override;
 
+		std::optional<ModuleAccess> GetAccess() const override;
+
 		void AddParticle(const Particle &particle);
 
 		/// <summary>
@@ -41,6 +44,6 @@ namespace acid
 		/// Gets a list of all particles.
 		/// </summary>
 		/// <returns> All particles. </returns>
-		std::map<std::shared_ptr<ParticleType>, std::vector<Particle>> GetParticles() const { return m_particles; }
+		const std::map<std::shared_ptr<ParticleType>, std::vector<Particle>> &GetParticles() const { return m_particles; }
 	};
 }
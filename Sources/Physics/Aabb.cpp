@@ -0,0 +1,125 @@
+#include "Aabb.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace acid
+{
+	Aabb::Aabb() :
+		m_min(Vector3(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity())),
+		m_max(Vector3(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()))
+	{
+	}
+
+	Aabb::Aabb(const Vector3 &min, const Vector3 &max) :
+		m_min(min),
+		m_max(max)
+	{
+	}
+
+	Aabb::~Aabb()
+	{
+	}
+
+	bool Aabb::IsEmpty() const
+	{
+		return m_min.m_x > m_max.m_x || m_min.m_y > m_max.m_y || m_min.m_z > m_max.m_z;
+	}
+
+	Aabb Aabb::Merge(const Aabb &other) const
+	{
+		return Aabb(Vector3::MinVector(m_min, other.m_min), Vector3::MaxVector(m_max, other.m_max));
+	}
+
+	Aabb Aabb::Expand(const float &margin) const
+	{
+		return Aabb(m_min - Vector3(margin, margin, margin), m_max + Vector3(margin, margin, margin));
+	}
+
+	Aabb Aabb::Transformed(const Matrix4 &matrix) const
+	{
+		if (IsEmpty())
+		{
+			return *this;
+		}
+
+		// Transforms the centre, and the extents by the absolute of the matrix so the box stays axis aligned.
+		Vector3 centre = (m_min + m_max) * 0.5f;
+		Vector3 extents = (m_max - m_min) * 0.5f;
+		Vector3 newCentre = Vector3(matrix[3][0], matrix[3][1], matrix[3][2]);
+		Vector3 newExtents = Vector3();
+
+		for (uint32_t row = 0; row < 3; row++)
+		{
+			for (uint32_t column = 0; column < 3; column++)
+			{
+				newCentre[column] += matrix[row][column] * centre[row];
+				newExtents[column] += std::fabs(matrix[row][column]) * extents[row];
+			}
+		}
+
+		return Aabb(newCentre - newExtents, newCentre + newExtents);
+	}
+
+	float Aabb::SurfaceArea() const
+	{
+		Vector3 size = m_max - m_min;
+		return 2.0f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+	}
+
+	bool Aabb::Contains(const Aabb &other) const
+	{
+		return m_min.m_x <= other.m_min.m_x && m_min.m_y <= other.m_min.m_y && m_min.m_z <= other.m_min.m_z &&
+			other.m_max.m_x <= m_max.m_x && other.m_max.m_y <= m_max.m_y && other.m_max.m_z <= m_max.m_z;
+	}
+
+	bool Aabb::Intersects(const Aabb &other) const
+	{
+		return m_min.m_x <= other.m_max.m_x && other.m_min.m_x <= m_max.m_x &&
+			m_min.m_y <= other.m_max.m_y && other.m_min.m_y <= m_max.m_y &&
+			m_min.m_z <= other.m_max.m_z && other.m_min.m_z <= m_max.m_z;
+	}
+
+	bool Aabb::IntersectsSphere(const Vector3 &centre, const float &radius) const
+	{
+		// The squared distance from the centre to the closest point of the box.
+		float distance2 = 0.0f;
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			float closest = std::clamp(centre[i], m_min[i], m_max[i]);
+			distance2 += (centre[i] - closest) * (centre[i] - closest);
+		}
+
+		return distance2 <= radius * radius;
+	}
+
+	bool Aabb::IntersectsRay(const Vector3 &origin, const Vector3 &inverseDirection, const float &maxDistance) const
+	{
+		// Slab test, the ray is inside the box where it is inside all three slabs.
+		float near = 0.0f;
+		float far = maxDistance;
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			float t0 = (m_min[i] - origin[i]) * inverseDirection[i];
+			float t1 = (m_max[i] - origin[i]) * inverseDirection[i];
+
+			if (t0 > t1)
+			{
+				std::swap(t0, t1);
+			}
+
+			near = std::max(near, t0);
+			far = std::min(far, t1);
+
+			if (near > far)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Maths/Matrix4.hpp"
+#include "Maths/Vector3.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// An axis aligned bounding box.
+	/// </summary>
+	class ACID_EXPORT Aabb
+	{
+	public:
+		Vector3 m_min;
+		Vector3 m_max;
+
+		/// <summary>
+		/// Creates a new empty bounding box, merging it with another box gives the other box.
+		/// </summary>
+		Aabb();
+
+		/// <summary>
+		/// Creates a new bounding box.
+		/// </summary>
+		/// <param name="min"> The minimum corner. </param>
+		/// <param name="max"> The maximum corner. </param>
+		Aabb(const Vector3 &min, const Vector3 &max);
+
+		~Aabb();
+
+		/// <summary>
+		/// Gets if this box has no volume because it was never given any bounds.
+		/// </summary>
+		/// <returns> If the box is empty. </returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the smallest box containing this box and another.
+		/// </summary>
+		/// <param name="other"> The other box. </param>
+		/// <returns> The merged box. </returns>
+		Aabb Merge(const Aabb &other) const;
+
+		/// <summary>
+		/// Gets this box grown by a margin on every side.
+		/// </summary>
+		/// <param name="margin"> The margin. </param>
+		/// <returns> The grown box. </returns>
+		Aabb Expand(const float &margin) const;
+
+		/// <summary>
+		/// Gets the box containing this box after it is transformed by a matrix.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <returns> The transformed box. </returns>
+		Aabb Transformed(const Matrix4 &matrix) const;
+
+		/// <summary>
+		/// Gets the surface area of this box, used as the cost of a node in bounding volume hierarchies.
+		/// </summary>
+		/// <returns> The surface area. </returns>
+		float SurfaceArea() const;
+
+		bool Contains(const Aabb &other) const;
+
+		bool Intersects(const Aabb &other) const;
+
+		/// <summary>
+		/// Gets if a sphere touches this box.
+		/// </summary>
+		/// <param name="centre"> The spheres centre. </param>
+		/// <param name="radius"> The spheres radius. </param>
+		/// <returns> If the sphere intersects. </returns>
+		bool IntersectsSphere(const Vector3 &centre, const float &radius) const;
+
+		/// <summary>
+		/// Gets if a ray segment passes through this box.
+		/// </summary>
+		/// <param name="origin"> The rays origin. </param>
+		/// <param name="inverseDirection"> One divided by each component of the rays direction. </param>
+		/// <param name="maxDistance"> The length of the segment in units of the direction. </param>
+		/// <returns> If the ray intersects. </returns>
+		bool IntersectsRay(const Vector3 &origin, const Vector3 &inverseDirection, const float &maxDistance) const;
+	};
+}
@@ -13,13 +13,13 @@ namespace acid
 	{
 	}
 
-	bool Collider::InFrustum(const Frustum &frustum)
+	std::optional<Aabb> Collider::GetBounds() const
 	{
 		auto shape = GetCollisionShape();
 
 		if (shape == nullptr)
 		{
-			return true;
+			return {};
 		}
 
 		Vector3 position = GetGameObject()->GetTransform().GetPosition();
@@ -34,7 +34,19 @@ namespace acid
 		btVector3 max = btVector3();
 		shape->getAabb(worldTransform, min, max);
 
-		return frustum.CubeInFrustum(Convert(min), Convert(max));
+		return Aabb(Convert(min), Convert(max));
+	}
+
+	bool Collider::InFrustum(const Frustum &frustum)
+	{
+		auto bounds = GetBounds();
+
+		if (!bounds)
+		{
+			return true;
+		}
+
+		return frustum.CubeInFrustum(bounds->m_min, bounds->m_max);
 	}
 
 	btVector3 Collider::Convert(const Vector3 &vector)
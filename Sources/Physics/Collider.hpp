@@ -4,6 +4,7 @@
 #include "Maths/Quaternion.hpp"
 #include "Maths/Vector3.hpp"
 #include "Objects/IComponent.hpp"
+#include "Aabb.hpp"
 #include "Frustum.hpp"
 #include "Ray.hpp"
 
@@ -39,6 +40,12 @@ namespace acid
 
 		virtual btCollisionShape* GetCollisionShape() const = 0;
 
+		/// <summary>
+		/// Gets the world space bounds of the shape at the game objects position and rotation.
+		/// </summary>
+		/// <returns> The bounds, or nothing if there is no shape. </returns>
+		std::optional<Aabb> GetBounds() const;
+
 		/// <summary>
 		/// Gets if the shape is partially in the view frustum.
 		/// </summary>
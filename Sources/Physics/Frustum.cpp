@@ -135,6 +135,24 @@ namespace acid
 		return true;
 	}
 
+	bool Frustum::CubeContained(const Vector3 &min, const Vector3 &max) const
+	{
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			// The corner furthest behind the plane decides if any of the cube is outside of it.
+			float x = m_frustum[i][0] > 0.0f ? min.m_x : max.m_x;
+			float y = m_frustum[i][1] > 0.0f ? min.m_y : max.m_y;
+			float z = m_frustum[i][2] > 0.0f ? min.m_z : max.m_z;
+
+			if (m_frustum[i][0] * x + m_frustum[i][1] * y + m_frustum[i][2] * z + m_frustum[i][3] <= 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	void Frustum::NormalizePlane(const int32_t &side)
 	{
 		float magnitude = std::sqrt(m_frustum[side][0] * m_frustum[side][0] +
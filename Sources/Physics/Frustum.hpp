@@ -50,6 +50,20 @@ namespace acid
 		/// <returns> True if partially contained, false if outside. </returns>
 		bool CubeInFrustum(const Vector3 &min, const Vector3 &max) const;
 
+		/// <summary>
+		/// Is the cube contained entirely in the frustum?
+		/// </summary>
+		/// <param name="min"> The point 1st position. </param>
+		/// <param name="max"> The point 2nd position. </param>
+		/// <returns> True if fully contained, false if partially or not contained. </returns>
+		bool CubeContained(const Vector3 &min, const Vector3 &max) const;
+
+		/// <summary>
+		/// Gets the six normalized planes of the frustum, each as a normal and a distance.
+		/// </summary>
+		/// <returns> The frustum planes. </returns>
+		const std::array<std::array<float, 4>, 6> &GetPlanes() const { return m_frustum; }
+
 	private:
 		void NormalizePlane(const int32_t &side);
 	};
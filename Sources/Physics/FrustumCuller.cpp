@@ -0,0 +1,135 @@
+#include "FrustumCuller.hpp"
+
+#include <cmath>
+#include "Engine/Engine.hpp"
+#include "Meshes/Mesh.hpp"
+#include "Objects/GameObject.hpp"
+
+namespace acid
+{
+	const uint32_t FrustumCuller::PARALLEL_GRAIN_SIZE = 256;
+
+	FrustumCuller::FrustumCuller(const Frustum &frustum) :
+		m_planesX(std::array<float, 8>()),
+		m_planesY(std::array<float, 8>()),
+		m_planesZ(std::array<float, 8>()),
+		m_planesW(std::array<float, 8>())
+	{
+		auto &planes = frustum.GetPlanes();
+
+		// The two padding planes face every point, so they never cull.
+		for (uint32_t i = 0; i < 8; i++)
+		{
+			m_planesX[i] = i < 6 ? planes[i][0] : 0.0f;
+			m_planesY[i] = i < 6 ? planes[i][1] : 0.0f;
+			m_planesZ[i] = i < 6 ? planes[i][2] : 0.0f;
+			m_planesW[i] = i < 6 ? planes[i][3] : 1.0f;
+		}
+	}
+
+	FrustumCuller::~FrustumCuller()
+	{
+	}
+
+	bool FrustumCuller::IsVisible(const Aabb &bounds, const Matrix4 &worldMatrix) const
+	{
+		// A box is outside of a plane when its corner furthest in front is behind it, that corners distance is the distance
+		// of the centre plus the extents projected onto the absolute plane normal.
+#if ACID_SIMD_SSE
+		Vector3 centre = (bounds.m_min + bounds.m_max) * 0.5f;
+		Vector3 extents = (bounds.m_max - bounds.m_min) * 0.5f;
+		__m128 signMask = _mm_set1_ps(-0.0f);
+
+		__m128 row0 = worldMatrix[0].ToSimd();
+		__m128 row1 = worldMatrix[1].ToSimd();
+		__m128 row2 = worldMatrix[2].ToSimd();
+		__m128 worldCentre = _mm_add_ps(_mm_add_ps(_mm_mul_ps(row0, _mm_set1_ps(centre.m_x)), _mm_mul_ps(row1, _mm_set1_ps(centre.m_y))),
+			_mm_add_ps(_mm_mul_ps(row2, _mm_set1_ps(centre.m_z)), worldMatrix[3].ToSimd()));
+		__m128 worldExtents = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, row0), _mm_set1_ps(extents.m_x)),
+			_mm_mul_ps(_mm_andnot_ps(signMask, row1), _mm_set1_ps(extents.m_y))), _mm_mul_ps(_mm_andnot_ps(signMask, row2), _mm_set1_ps(extents.m_z)));
+
+		alignas(16) float c[4];
+		alignas(16) float e[4];
+		_mm_store_ps(c, worldCentre);
+		_mm_store_ps(e, worldExtents);
+
+		__m128 cx = _mm_set1_ps(c[0]);
+		__m128 cy = _mm_set1_ps(c[1]);
+		__m128 cz = _mm_set1_ps(c[2]);
+		__m128 ex = _mm_set1_ps(e[0]);
+		__m128 ey = _mm_set1_ps(e[1]);
+		__m128 ez = _mm_set1_ps(e[2]);
+
+		for (uint32_t i = 0; i < 8; i += 4)
+		{
+			__m128 px = _mm_load_ps(&m_planesX[i]);
+			__m128 py = _mm_load_ps(&m_planesY[i]);
+			__m128 pz = _mm_load_ps(&m_planesZ[i]);
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)),
+				_mm_add_ps(_mm_mul_ps(pz, cz), _mm_load_ps(&m_planesW[i])));
+			__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, px), ex), _mm_mul_ps(_mm_andnot_ps(signMask, py), ey)),
+				_mm_mul_ps(_mm_andnot_ps(signMask, pz), ez));
+
+			if (_mm_movemask_ps(_mm_cmple_ps(_mm_add_ps(distance, radius), _mm_setzero_ps())) != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+#else
+		Aabb world = bounds.Transformed(worldMatrix);
+		Vector3 centre = (world.m_min + world.m_max) * 0.5f;
+		Vector3 extents = (world.m_max - world.m_min) * 0.5f;
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			float distance = m_planesX[i] * centre.m_x + m_planesY[i] * centre.m_y + m_planesZ[i] * centre.m_z + m_planesW[i];
+			float radius = std::fabs(m_planesX[i]) * extents.m_x + std::fabs(m_planesY[i]) * extents.m_y + std::fabs(m_planesZ[i]) * extents.m_z;
+
+			if (distance + radius <= 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+#endif
+	}
+
+	std::vector<uint8_t> FrustumCuller::CullObjects(const std::vector<GameObject *> &objects) const
+	{
+		std::vector<uint8_t> visible(objects.size(), 1);
+
+		if (objects.empty())
+		{
+			return visible;
+		}
+
+		// World matrices have been rebuilt by the scene this frame, so they are only read here.
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		threadPool.Wait(threadPool.ParallelFor(0, static_cast<uint32_t>(objects.size()), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				auto mesh = objects[i]->GetComponent<Mesh>();
+
+				if (mesh == nullptr || mesh->GetModel() == nullptr)
+				{
+					continue;
+				}
+
+				auto bounds = Aabb(mesh->GetModel()->GetMinExtents(), mesh->GetModel()->GetMaxExtents());
+
+				if (bounds.IsEmpty())
+				{
+					continue;
+				}
+
+				visible[i] = IsVisible(bounds, objects[i]->GetTransform().GetWorldMatrix());
+			}
+		}, PARALLEL_GRAIN_SIZE));
+
+		return visible;
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include "Aabb.hpp"
+#include "Frustum.hpp"
+
+namespace acid
+{
+	class GameObject;
+
+	/// <summary>
+	/// Culls objects against the planes of a view frustum. The planes are stored transposed so four planes are tested
+	/// against a box at once, and objects are tested in parallel on the thread pool.
+	/// </summary>
+	class ACID_EXPORT FrustumCuller
+	{
+	public:
+		static const uint32_t PARALLEL_GRAIN_SIZE;
+	private:
+		alignas(16) std::array<float, 8> m_planesX;
+		alignas(16) std::array<float, 8> m_planesY;
+		alignas(16) std::array<float, 8> m_planesZ;
+		alignas(16) std::array<float, 8> m_planesW;
+	public:
+		/// <summary>
+		/// Creates a new culler from the planes of a frustum.
+		/// </summary>
+		/// <param name="frustum"> The view frustum. </param>
+		explicit FrustumCuller(const Frustum &frustum);
+
+		~FrustumCuller();
+
+		/// <summary>
+		/// Gets if a box in model space is partially in the view frustum.
+		/// </summary>
+		/// <param name="bounds"> The bounds in model space. </param>
+		/// <param name="worldMatrix"> The matrix that takes the bounds into world space. </param>
+		/// <returns> If the transformed box is partially in the view frustum. </returns>
+		bool IsVisible(const Aabb &bounds, const Matrix4 &worldMatrix) const;
+
+		/// <summary>
+		/// Gets which objects have a mesh partially in the view frustum, objects without a loaded model are kept.
+		/// </summary>
+		/// <param name="objects"> The objects to test. </param>
+		/// <returns> A flag for each object, set if it is visible. </returns>
+		std::vector<uint8_t> CullObjects(const std::vector<GameObject *> &objects) const;
+
+		/// <summary>
+		/// Builds a compact list of the enabled components whose game object is visible, in the same order.
+		/// </summary>
+		/// <param name="components"> The components to cull. </param>
+		/// <returns> The visible components. </returns>
+		template<typename T>
+		std::vector<T *> Cull(const std::vector<T *> &components) const
+		{
+			std::vector<T *> enabled;
+			std::vector<GameObject *> objects;
+			enabled.reserve(components.size());
+			objects.reserve(components.size());
+
+			for (auto &component : components)
+			{
+				if (component->IsEnabled())
+				{
+					enabled.emplace_back(component);
+					objects.emplace_back(component->GetGameObject());
+				}
+			}
+
+			auto visible = CullObjects(objects);
+			auto result = std::vector<T *>();
+			result.reserve(enabled.size());
+
+			for (std::size_t i = 0; i < enabled.size(); i++)
+			{
+				if (visible[i])
+				{
+					result.emplace_back(enabled[i]);
+				}
+			}
+
+			return result;
+		}
+	};
+}
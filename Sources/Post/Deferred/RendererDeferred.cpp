@@ -39,27 +39,25 @@ namespace acid
 		auto lightPositions = std::vector<Vector4>(MAX_LIGHTS);
 		int32_t lightCount = 0;
 
-		auto sceneLights = Scenes::Get()->GetStructure()->QueryComponents<Light>();
-
-		for (auto &light : sceneLights)
+		Scenes::Get()->GetStructure()->ForEach<Light>([&](Light &light)
 		{
-		//	auto position = *light->GetPosition();
-		//	float radius = light->GetRadius();
+		//	auto position = *light.GetPosition();
+		//	float radius = light.GetRadius();
 
 		//	if (radius >= 0.0f && !camera.GetViewFrustum()->SphereInFrustum(position, radius))
 		//	{
-		//		continue;
+		//		return;
 		//	}
 
-			lightColours[lightCount] = light->GetColour();
-			lightPositions[lightCount] = Vector4(light->GetPosition(), light->GetRadius());
-			lightCount++;
-
 			if (lightCount >= MAX_LIGHTS)
 			{
-				break;
+				return;
 			}
-		}
+
+			lightColours[lightCount] = light.GetColour();
+			lightPositions[lightCount] = Vector4(light.GetPosition(), light.GetRadius());
+			lightCount++;
+		});
 
 		// Updates uniforms.
 		m_uniformScene.Push("lightColours", *lightColours.data(), sizeof(Colour) * MAX_LIGHTS);
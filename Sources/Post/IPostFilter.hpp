@@ -9,6 +9,7 @@ namespace acid
 {
 	/// <summary>
 	/// Represents a post effect shader and on application saves the result into a fbo.
+	/// The filters pipeline is built on the thread pool, filters do not render until it is ready.
 	/// </summary>
 	class ACID_EXPORT IPostFilter :
 		public IRenderer
@@ -33,7 +34,7 @@ namespace acid
 
 		DescriptorsHandler GetDescriptorSet() const { return m_descriptorSet; }
 
-		Pipeline GetPipeline() const { return m_pipeline; }
+		const Pipeline &GetPipeline() const { return m_pipeline; }
 
 		std::shared_ptr<Model> GetModel() const { return m_model; }
 	};
@@ -8,7 +8,7 @@ namespace acid
 	Buffer::Buffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage, const VkMemoryPropertyFlags &properties) :
 		m_size(size),
 		m_buffer(VK_NULL_HANDLE),
-		m_bufferMemory(VK_NULL_HANDLE)
+		m_allocation({})
 	{
 		if (m_size == 0)
 		{
@@ -17,62 +17,49 @@ namespace acid
 
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 		auto graphicsFamily = Display::Get()->GetGraphicsFamily();
-		auto presentFamily = Display::Get()->GetPresentFamily();
-		auto computeFamily = Display::Get()->GetComputeFamily();
+		auto transferFamily = Display::Get()->GetTransferFamily();
 
-		std::array<uint32_t, 3> queueFamily = {graphicsFamily, presentFamily, computeFamily};
+		// Buffers are shared with the transfer queue so uploads need no ownership transfer.
+		std::array<uint32_t, 2> queueFamily = {graphicsFamily, transferFamily};
 
 		VkBufferCreateInfo bufferCreateInfo = {};
 		bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 		bufferCreateInfo.size = size;
 		bufferCreateInfo.usage = usage;
-		bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bufferCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamily.size());
-		bufferCreateInfo.pQueueFamilyIndices = queueFamily.data();
+
+		if (graphicsFamily != transferFamily)
+		{
+			bufferCreateInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			bufferCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamily.size());
+			bufferCreateInfo.pQueueFamilyIndices = queueFamily.data();
+		}
+		else
+		{
+			bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
 
 		Display::CheckVk(vkCreateBuffer(logicalDevice, &bufferCreateInfo, nullptr, &m_buffer));
 
-		// Allocates buffer memory.
+		// Sub-allocates buffer memory.
 		VkMemoryRequirements memoryRequirements;
 		vkGetBufferMemoryRequirements(logicalDevice, m_buffer, &memoryRequirements);
 
-		VkMemoryAllocateInfo memoryAllocateInfo = {};
-		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		memoryAllocateInfo.allocationSize = memoryRequirements.size;
-		memoryAllocateInfo.memoryTypeIndex = FindMemoryType(memoryRequirements.memoryTypeBits, properties);
-
-		Display::CheckVk(vkAllocateMemory(logicalDevice, &memoryAllocateInfo, nullptr, &m_bufferMemory));
+		m_allocation = Display::Get()->GetMemoryAllocator().Allocate(memoryRequirements, properties, true);
 
-		vkBindBufferMemory(logicalDevice, m_buffer, m_bufferMemory, 0);
+		Display::CheckVk(vkBindBufferMemory(logicalDevice, m_buffer, m_allocation.m_memory, m_allocation.m_offset));
 	}
 
 	Buffer::~Buffer()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		vkDestroyBuffer(logicalDevice, m_buffer, nullptr);
-		vkFreeMemory(logicalDevice, m_bufferMemory, nullptr);
-	}
-
-	uint32_t Buffer::FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &properties)
-	{
-		auto physicalDevice = Display::Get()->GetPhysicalDevice();
+		// Frames still in flight may read from the buffer.
+		auto buffer = m_buffer;
+		auto allocation = m_allocation;
 
-		VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &physicalDeviceMemoryProperties);
-
-		for (uint32_t i = 0; i < physicalDeviceMemoryProperties.memoryTypeCount; i++)
+		Renderer::Retire([buffer, allocation]() mutable
 		{
-			// If typefilter has a bit set to 1 and it contains the properties we indicated.
-			if ((typeFilter & (1 << i)) &&
-				(physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
-			{
-				return i;
-			}
-		}
-
-		throw std::runtime_error("Failed to find a valid memory type for buffer!");
-		return 0;
+			vkDestroyBuffer(Display::Get()->GetLogicalDevice(), buffer, nullptr);
+			Display::Get()->GetMemoryAllocator().Free(allocation);
+		});
 	}
 
 	void Buffer::CopyBuffer(const VkBuffer srcBuffer, const VkBuffer dstBuffer, const VkDeviceSize &size)
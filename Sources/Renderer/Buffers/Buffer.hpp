@@ -2,6 +2,7 @@
 
 #include <vulkan/vulkan.h>
 #include "Renderer/Descriptors/DescriptorSet.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 
 namespace acid
 {
@@ -10,7 +11,7 @@ namespace acid
 	protected:
 		VkDeviceSize m_size;
 		VkBuffer m_buffer;
-		VkDeviceMemory m_bufferMemory;
+		MemoryAllocation m_allocation;
 	public:
 		Buffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage, const VkMemoryPropertyFlags &properties);
 
@@ -20,9 +21,13 @@ namespace acid
 
 		VkBuffer GetBuffer() const { return m_buffer; }
 
-		VkDeviceMemory GetBufferMemory() const { return m_bufferMemory; }
+		const MemoryAllocation &GetAllocation() const { return m_allocation; }
 
-		static uint32_t FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &properties);
+		/// <summary>
+		/// Gets the persistent mapping of the buffers memory.
+		/// </summary>
+		/// <returns> The mapped memory, null unless the buffer was created host visible. </returns>
+		void *GetMapped() const { return m_allocation.m_mapped; }
 
 		static void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, const VkDeviceSize &size);
 	};
@@ -4,18 +4,13 @@
 
 namespace acid
 {
-	IndexBuffer::IndexBuffer(const VkIndexType &indexType, const uint64_t &elementSize, const size_t &indexCount, void *newData) :
-		Buffer(elementSize * indexCount, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT),
+	IndexBuffer::IndexBuffer(const VkIndexType &indexType, const uint64_t &elementSize, const size_t &indexCount, const void *newData) :
+		Buffer(elementSize * indexCount, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
 		m_indexType(indexType),
 		m_indexCount(static_cast<uint32_t>(indexCount))
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		// Copies the index data to the buffer.
-		void *data;
-		vkMapMemory(logicalDevice, m_bufferMemory, 0, m_size, 0, &data);
-		memcpy(data, newData, static_cast<size_t>(m_size));
-		vkUnmapMemory(logicalDevice, m_bufferMemory);
+		memcpy(m_allocation.m_mapped, newData, static_cast<size_t>(m_size));
 	}
 
 	IndexBuffer::~IndexBuffer()
@@ -0,0 +1,56 @@
+#include "StorageBuffer.hpp"
+
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	StorageBuffer::StorageBuffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage) :
+		Buffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+		IDescriptor(),
+		m_bufferInfo({})
+	{
+		m_bufferInfo.buffer = m_buffer;
+		m_bufferInfo.offset = 0;
+		m_bufferInfo.range = m_size;
+	}
+
+	StorageBuffer::~StorageBuffer()
+	{
+	}
+
+	void StorageBuffer::Update(const void *newData, const VkDeviceSize &size)
+	{
+		// Copies the data to the buffer.
+		memcpy(m_allocation.m_mapped, newData, static_cast<size_t>(std::min(size, m_size)));
+	}
+
+	DescriptorType StorageBuffer::CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage)
+	{
+		VkDescriptorSetLayoutBinding descriptorSetLayoutBinding = {};
+		descriptorSetLayoutBinding.binding = binding;
+		descriptorSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorSetLayoutBinding.descriptorCount = 1;
+		descriptorSetLayoutBinding.pImmutableSamplers = nullptr;
+		descriptorSetLayoutBinding.stageFlags = stage;
+
+		VkDescriptorPoolSize descriptorPoolSize = {};
+		descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorPoolSize.descriptorCount = 256; // Arbitrary number, culled instance batches take three each.
+
+		return DescriptorType(binding, stage, descriptorSetLayoutBinding, descriptorPoolSize);
+	}
+
+	VkWriteDescriptorSet StorageBuffer::GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const
+	{
+		VkWriteDescriptorSet descriptorWrite = {};
+		descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrite.dstSet = descriptorSet.GetDescriptorSet();
+		descriptorWrite.dstBinding = binding;
+		descriptorWrite.dstArrayElement = 0;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorWrite.descriptorCount = 1;
+		descriptorWrite.pBufferInfo = &m_bufferInfo;
+
+		return descriptorWrite;
+	}
+}
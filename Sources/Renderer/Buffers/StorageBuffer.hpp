@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include "Renderer/Descriptors/IDescriptor.hpp"
+#include "Renderer/Pipelines/ShaderProgram.hpp"
+#include "Buffer.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A host visible shader storage buffer, used for data too large or too variable in size for a uniform buffer.
+	/// </summary>
+	class ACID_EXPORT StorageBuffer :
+		public Buffer,
+		public IDescriptor
+	{
+	private:
+		VkDescriptorBufferInfo m_bufferInfo;
+	public:
+		/// <summary>
+		/// Creates a new storage buffer.
+		/// </summary>
+		/// <param name="size"> The size of the buffer. </param>
+		/// <param name="usage"> Usages the buffer has as well as storage, such as an indirect draw source. </param>
+		explicit StorageBuffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage = 0);
+
+		~StorageBuffer();
+
+		void Update(const void *newData, const VkDeviceSize &size);
+
+		static DescriptorType CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage);
+
+		VkWriteDescriptorSet GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const override;
+	};
+}
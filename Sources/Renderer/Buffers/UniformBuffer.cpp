@@ -5,7 +5,7 @@
 namespace acid
 {
 	UniformBuffer::UniformBuffer(const VkDeviceSize &size) :
-		Buffer(size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT),
+		Buffer(size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
 		IDescriptor(),
 		m_bufferInfo({})
 	{
@@ -20,26 +20,21 @@ namespace acid
 
 	void UniformBuffer::Update(void *newData)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		// Copies the data to the buffer.
-		void *data;
-		vkMapMemory(logicalDevice, m_bufferMemory, 0, m_size, 0, &data);
-		memcpy(data, newData, static_cast<size_t>(m_size));
-		vkUnmapMemory(logicalDevice, m_bufferMemory);
+		memcpy(m_allocation.m_mapped, newData, static_cast<size_t>(m_size));
 	}
 
 	DescriptorType UniformBuffer::CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage)
 	{
 		VkDescriptorSetLayoutBinding descriptorSetLayoutBinding = {};
 		descriptorSetLayoutBinding.binding = binding;
-		descriptorSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		descriptorSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 		descriptorSetLayoutBinding.descriptorCount = 1;
 		descriptorSetLayoutBinding.pImmutableSamplers = nullptr;
 		descriptorSetLayoutBinding.stageFlags = stage;
 
 		VkDescriptorPoolSize descriptorPoolSize = {};
-		descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 		descriptorPoolSize.descriptorCount = 64; // Arbitrary number.
 
 		return DescriptorType(binding, stage, descriptorSetLayoutBinding, descriptorPoolSize);
@@ -52,7 +47,7 @@ namespace acid
 		descriptorWrite.dstSet = descriptorSet.GetDescriptorSet();
 		descriptorWrite.dstBinding = binding;
 		descriptorWrite.dstArrayElement = 0;
-		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 		descriptorWrite.descriptorCount = 1;
 		descriptorWrite.pBufferInfo = &m_bufferInfo;
 
@@ -0,0 +1,122 @@
+#include "UniformRing.hpp"
+
+#include <algorithm>
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	const VkDeviceSize UniformRing::FRAME_SIZE = 1024 * 1024;
+
+	UniformRing::Range::Range(const VkBuffer &buffer, const VkDeviceSize &range) :
+		IDescriptor(),
+		m_bufferInfo({})
+	{
+		m_bufferInfo.buffer = buffer;
+		m_bufferInfo.offset = 0;
+		m_bufferInfo.range = range;
+	}
+
+	VkWriteDescriptorSet UniformRing::Range::GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const
+	{
+		VkWriteDescriptorSet descriptorWrite = {};
+		descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrite.dstSet = descriptorSet.GetDescriptorSet();
+		descriptorWrite.dstBinding = binding;
+		descriptorWrite.dstArrayElement = 0;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		descriptorWrite.descriptorCount = 1;
+		descriptorWrite.pBufferInfo = &m_bufferInfo;
+
+		return descriptorWrite;
+	}
+
+	UniformRing::UniformRing(const uint32_t &framesInFlight) :
+		m_alignment(std::max<VkDeviceSize>(16, Display::Get()->GetPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment)),
+		m_framesInFlight(framesInFlight),
+		m_block(nullptr),
+		m_retired(std::vector<std::pair<uint32_t, std::unique_ptr<Block>>>()),
+		m_frameIndex(0),
+		m_frame(0),
+		m_head(0)
+	{
+		CreateBlock(FRAME_SIZE);
+	}
+
+	UniformRing::~UniformRing()
+	{
+	}
+
+	UniformRing::Allocation UniformRing::Allocate(const VkDeviceSize &size)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		VkDeviceSize start = (m_head + m_alignment - 1) / m_alignment * m_alignment;
+
+		// Ranges already taken this frame stay in the old buffer, it is destroyed once every frame using it has finished.
+		if (start + size > m_block->m_frameSize)
+		{
+			CreateBlock(std::max(2 * m_block->m_frameSize, size));
+			start = 0;
+		}
+
+		m_head = start + size;
+
+		auto &range = m_block->m_ranges[size];
+
+		if (range == nullptr)
+		{
+			range = std::make_unique<Range>(m_block->m_buffer->GetBuffer(), size);
+		}
+
+		auto offset = m_frameIndex * m_block->m_frameSize + start;
+
+		Allocation allocation = {};
+		allocation.m_descriptor = range.get();
+		allocation.m_offset = static_cast<uint32_t>(offset);
+		allocation.m_mapped = static_cast<char *>(m_block->m_buffer->GetMapped()) + offset;
+		return allocation;
+	}
+
+	void UniformRing::BeginFrame(const uint32_t &frameIndex, const uint32_t &framesInFlight)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_frameIndex = frameIndex;
+		m_frame++;
+		m_head = 0;
+
+		for (auto it = m_retired.begin(); it != m_retired.end();)
+		{
+			if (--it->first == 0)
+			{
+				it = m_retired.erase(it);
+				continue;
+			}
+
+			++it;
+		}
+
+		// The regions are laid out for the frames in flight the block was created with.
+		if (m_framesInFlight != framesInFlight)
+		{
+			m_framesInFlight = framesInFlight;
+			CreateBlock(m_block->m_frameSize);
+		}
+	}
+
+	void UniformRing::CreateBlock(const VkDeviceSize &frameSize)
+	{
+		if (m_block != nullptr)
+		{
+			m_retired.emplace_back(m_framesInFlight, std::move(m_block));
+		}
+
+		VkDeviceSize alignedFrameSize = (frameSize + m_alignment - 1) / m_alignment * m_alignment;
+
+		m_block = std::make_unique<Block>();
+		m_block->m_buffer = std::make_unique<Buffer>(alignedFrameSize * m_framesInFlight, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		m_block->m_frameSize = alignedFrameSize;
+		m_block->m_ranges = std::map<VkDeviceSize, std::unique_ptr<Range>>();
+	}
+}
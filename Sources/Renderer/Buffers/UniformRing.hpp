@@ -0,0 +1,96 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Renderer/Descriptors/IDescriptor.hpp"
+#include "Buffer.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// One persistently mapped uniform buffer split into a region for each frame in flight. Uniform handlers take a range
+	/// of the current frames region and bind it with a dynamic offset, so objects have no uniform buffer of their own and
+	/// descriptor sets only change when the ring grows.
+	/// </summary>
+	class ACID_EXPORT UniformRing
+	{
+	public:
+		static const VkDeviceSize FRAME_SIZE;
+
+		/// <summary>
+		/// A range of the current frames region.
+		/// </summary>
+		struct Allocation
+		{
+			IDescriptor *m_descriptor;
+			uint32_t m_offset;
+			void *m_mapped;
+		};
+	private:
+		/// <summary>
+		/// A descriptor for a range size of the ring, shared by every uniform block of that size.
+		/// </summary>
+		class Range :
+			public IDescriptor
+		{
+		private:
+			VkDescriptorBufferInfo m_bufferInfo;
+		public:
+			Range(const VkBuffer &buffer, const VkDeviceSize &range);
+
+			VkWriteDescriptorSet GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const override;
+		};
+
+		/// <summary>
+		/// The buffer backing every frames region, and the descriptors of its ranges.
+		/// </summary>
+		struct Block
+		{
+			std::unique_ptr<Buffer> m_buffer;
+			VkDeviceSize m_frameSize;
+			std::map<VkDeviceSize, std::unique_ptr<Range>> m_ranges;
+		};
+
+		VkDeviceSize m_alignment;
+		uint32_t m_framesInFlight;
+		std::unique_ptr<Block> m_block;
+		std::vector<std::pair<uint32_t, std::unique_ptr<Block>>> m_retired;
+		uint32_t m_frameIndex;
+		uint64_t m_frame;
+		VkDeviceSize m_head;
+		std::mutex m_mutex;
+	public:
+		/// <summary>
+		/// Creates a new uniform ring.
+		/// </summary>
+		/// <param name="framesInFlight"> The number of frames the renderer records ahead of the GPU. </param>
+		explicit UniformRing(const uint32_t &framesInFlight);
+
+		~UniformRing();
+
+		/// <summary>
+		/// Takes a range of the current frames region, it is valid until the frame is next recorded.
+		/// </summary>
+		/// <param name="size"> The size of the range. </param>
+		/// <returns> The descriptor, dynamic offset and mapped memory of the range. </returns>
+		Allocation Allocate(const VkDeviceSize &size);
+
+		/// <summary>
+		/// Starts recording a frame, its region is reused. Called by the renderer once the GPU has finished the last frame
+		/// that used the region.
+		/// </summary>
+		/// <param name="frameIndex"> The index of the frame in flight. </param>
+		/// <param name="framesInFlight"> The number of frames in flight, the ring is rebuilt when it changes. </param>
+		void BeginFrame(const uint32_t &frameIndex, const uint32_t &framesInFlight);
+
+		/// <summary>
+		/// Gets a count of the frames begun, ranges taken in an earlier frame must be taken again.
+		/// </summary>
+		/// <returns> The frame count. </returns>
+		uint64_t GetFrame() const { return m_frame; }
+	private:
+		void CreateBlock(const VkDeviceSize &frameSize);
+	};
+}
@@ -8,15 +8,15 @@ namespace acid
 	CommandBuffer::CommandBuffer(const bool &begin, const VkQueueFlagBits &queueType, const VkCommandBufferLevel &bufferLevel) :
 		m_queueType(queueType),
 		m_bufferLevel(bufferLevel),
+		m_commandPool(Renderer::Get()->GetCommandPool()),
 		m_commandBuffer(VK_NULL_HANDLE),
 		m_running(false)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto commandPool = Renderer::Get()->GetCommandPool();
 
 		VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
 		commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		commandBufferAllocateInfo.commandPool = commandPool;
+		commandBufferAllocateInfo.commandPool = m_commandPool;
 		commandBufferAllocateInfo.level = bufferLevel;
 		commandBufferAllocateInfo.commandBufferCount = 1;
 
@@ -31,16 +31,17 @@ namespace acid
 	CommandBuffer::~CommandBuffer()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto commandPool = Renderer::Get()->GetCommandPool();
 
-		vkFreeCommandBuffers(logicalDevice, commandPool, 1, &m_commandBuffer);
+		// Frees into the pool of the thread that allocated this buffer.
+		vkFreeCommandBuffers(logicalDevice, m_commandPool, 1, &m_commandBuffer);
 	}
 
-	void CommandBuffer::Begin(const VkCommandBufferUsageFlags &usage)
+	void CommandBuffer::Begin(const VkCommandBufferUsageFlags &usage, const VkCommandBufferInheritanceInfo *inheritanceInfo)
 	{
 		VkCommandBufferBeginInfo beginInfo = {};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		beginInfo.flags = usage;
+		beginInfo.pInheritanceInfo = inheritanceInfo;
 
 		Display::CheckVk(vkBeginCommandBuffer(m_commandBuffer, &beginInfo));
 		m_running = true;
@@ -52,16 +53,25 @@ namespace acid
 		m_running = false;
 	}
 
-	void CommandBuffer::Submit(VkSemaphore signalSemaphore, VkFence fence, const bool &createFence)
+	void CommandBuffer::Submit(const VkSemaphore &waitSemaphore, const VkSemaphore &signalSemaphore, VkFence fence)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 		auto queueSelected = GetQueue();
 
+		VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
 		VkSubmitInfo submitInfo = {};
 		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &m_commandBuffer;
 
+		if (waitSemaphore != VK_NULL_HANDLE)
+		{
+			submitInfo.waitSemaphoreCount = 1;
+			submitInfo.pWaitSemaphores = &waitSemaphore;
+			submitInfo.pWaitDstStageMask = &waitStage;
+		}
+
 		if (signalSemaphore != VK_NULL_HANDLE)
 		{
 			submitInfo.signalSemaphoreCount = 1;
@@ -70,7 +80,7 @@ namespace acid
 
 		bool createdFence = false;
 
-		if (fence == VK_NULL_HANDLE && createFence)
+		if (fence == VK_NULL_HANDLE)
 		{
 			VkFenceCreateInfo fenceCreateInfo = {};
 			fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -85,16 +95,15 @@ namespace acid
 			Display::CheckVk(vkResetFences(logicalDevice, 1, &fence));
 		}
 
-		Display::CheckVk(vkQueueSubmit(queueSelected, 1, &submitInfo, fence));
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkQueueSubmit(queueSelected, 1, &submitInfo, fence));
+		}
 
-		if (fence != VK_NULL_HANDLE)
+		if (createdFence)
 		{
 			Display::CheckVk(vkWaitForFences(logicalDevice, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
-
-			if (createdFence)
-			{
-				vkDestroyFence(logicalDevice, fence, nullptr);
-			}
+			vkDestroyFence(logicalDevice, fence, nullptr);
 		}
 	}
 
@@ -10,6 +10,7 @@ namespace acid
 	private:
 		VkQueueFlagBits m_queueType;
 		VkCommandBufferLevel m_bufferLevel;
+		VkCommandPool m_commandPool;
 		VkCommandBuffer m_commandBuffer;
 		bool m_running;
 	public:
@@ -17,14 +18,28 @@ namespace acid
 
 		~CommandBuffer();
 
-		void Begin(const VkCommandBufferUsageFlags &usage = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+		/// <summary>
+		/// Begins recording the command buffer.
+		/// </summary>
+		/// <param name="usage"> How the command buffer will be used. </param>
+		/// <param name="inheritanceInfo"> The render pass state a secondary command buffer continues, or null. </param>
+		void Begin(const VkCommandBufferUsageFlags &usage = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, const VkCommandBufferInheritanceInfo *inheritanceInfo = nullptr);
 
 		void End();
 
-		void Submit(VkSemaphore signalSemaphore = VK_NULL_HANDLE, VkFence fence = VK_NULL_HANDLE, const bool &createFence = true);
+		/// <summary>
+		/// Submits the command buffer to its queue. Without a fence a temporary one is created and waited on, so the
+		/// commands have finished when this returns. A given fence is reset and signalled by the submit, without waiting.
+		/// </summary>
+		/// <param name="waitSemaphore"> A semaphore the submit waits on before colour attachment output. </param>
+		/// <param name="signalSemaphore"> A semaphore signalled when the commands have finished. </param>
+		/// <param name="fence"> A fence signalled when the commands have finished. </param>
+		void Submit(const VkSemaphore &waitSemaphore = VK_NULL_HANDLE, const VkSemaphore &signalSemaphore = VK_NULL_HANDLE, VkFence fence = VK_NULL_HANDLE);
 
 		bool IsRunning() const { return m_running; }
 
+		VkCommandBufferLevel GetBufferLevel() const { return m_bufferLevel; }
+
 		VkCommandBuffer GetCommandBuffer() const { return m_commandBuffer; }
 	private:
 		VkQueue GetQueue() const;
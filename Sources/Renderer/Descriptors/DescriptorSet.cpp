@@ -1,10 +1,15 @@
 #include "DescriptorSet.hpp"
 
+#include <mutex>
 #include "Display/Display.hpp"
+#include "Renderer/Renderer.hpp"
 #include "IDescriptor.hpp"
 
 namespace acid
 {
+	// Descriptor pools are shared by every set of a pipeline, and sets are allocated while recording on several threads.
+	static std::mutex DESCRIPTOR_POOL_MUTEX;
+
 	DescriptorSet::DescriptorSet(const IPipeline &pipeline) :
 		m_shaderProgram(pipeline.GetShaderProgram()),
 		m_pipelineLayout(pipeline.GetPipelineLayout()),
@@ -23,14 +28,21 @@ namespace acid
 		descriptorSetAllocateInfo.descriptorSetCount = 1;
 		descriptorSetAllocateInfo.pSetLayouts = layouts;
 
+		std::lock_guard<std::mutex> lock(DESCRIPTOR_POOL_MUTEX);
 		Display::CheckVk(vkAllocateDescriptorSets(logicalDevice, &descriptorSetAllocateInfo, &m_descriptorSet));
 	}
 
 	DescriptorSet::~DescriptorSet()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		// Frames still in flight may have the set bound.
+		auto descriptorPool = m_descriptorPool;
+		auto descriptorSet = m_descriptorSet;
 
-		Display::CheckVk(vkFreeDescriptorSets(logicalDevice, m_descriptorPool, 1, &m_descriptorSet));
+		Renderer::Retire([descriptorPool, descriptorSet]()
+		{
+			std::lock_guard<std::mutex> lock(DESCRIPTOR_POOL_MUTEX);
+			Display::CheckVk(vkFreeDescriptorSets(Display::Get()->GetLogicalDevice(), descriptorPool, 1, &descriptorSet));
+		});
 	}
 
 	void DescriptorSet::Update(const std::vector<IDescriptor *> &descriptors)
@@ -50,9 +62,10 @@ namespace acid
 		vkUpdateDescriptorSets(logicalDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 	}
 
-	void DescriptorSet::BindDescriptor(const CommandBuffer &commandBuffer)
+	void DescriptorSet::BindDescriptor(const CommandBuffer &commandBuffer, const std::vector<uint32_t> &dynamicOffsets)
 	{
 		VkDescriptorSet descriptors[1] = {m_descriptorSet};
-		vkCmdBindDescriptorSets(commandBuffer.GetCommandBuffer(), m_pipelineBindPoint, m_pipelineLayout, 0, 1, descriptors, 0, nullptr);
+		vkCmdBindDescriptorSets(commandBuffer.GetCommandBuffer(), m_pipelineBindPoint, m_pipelineLayout, 0, 1, descriptors,
+			static_cast<uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
 	}
 }
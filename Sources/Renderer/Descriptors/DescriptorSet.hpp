@@ -24,7 +24,7 @@ namespace acid
 
 		void Update(const std::vector<IDescriptor *> &descriptors);
 
-		void BindDescriptor(const CommandBuffer &commandBuffer);
+		void BindDescriptor(const CommandBuffer &commandBuffer, const std::vector<uint32_t> &dynamicOffsets = {});
 
 		VkDescriptorSet GetDescriptorSet() const { return m_descriptorSet; }
 	};
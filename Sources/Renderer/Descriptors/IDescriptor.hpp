@@ -17,5 +17,11 @@ namespace acid
 		}
 
 		virtual VkWriteDescriptorSet GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const = 0;
+
+		/// <summary>
+		/// Gets if the descriptors contents can be read by the GPU, descriptors still being uploaded are not bound.
+		/// </summary>
+		/// <returns> If the descriptor is ready. </returns>
+		virtual bool IsReady() const { return true; }
 	};
 }
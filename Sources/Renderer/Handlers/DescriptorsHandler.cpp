@@ -1,30 +1,41 @@
 #include "DescriptorsHandler.hpp"
 
+#include <algorithm>
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
 	DescriptorsHandler::DescriptorsHandler() :
 		m_shaderProgram(nullptr),
-		m_descriptorSet(nullptr),
-		m_descriptors(std::vector<IDescriptor *>()),
-		m_changed(false)
+		m_descriptorSets(std::vector<std::shared_ptr<DescriptorSet>>()),
+		m_descriptors(std::vector<std::vector<IDescriptor *>>()),
+		m_changed(std::vector<bool>()),
+		m_dynamicBindings(std::vector<uint32_t>()),
+		m_dynamicOffsets(std::vector<uint32_t>()),
+		m_bindOffsets(std::vector<uint32_t>())
 	{
 	}
 
 	DescriptorsHandler::DescriptorsHandler(const IPipeline &pipeline) :
 		m_shaderProgram(pipeline.GetShaderProgram()),
-		m_descriptorSet(std::make_shared<DescriptorSet>(pipeline)),
-		m_descriptors(std::vector<IDescriptor *>(m_shaderProgram->GetLastDescriptorBinding() + 1)),
-		m_changed(true)
+		m_descriptorSets(std::vector<std::shared_ptr<DescriptorSet>>()),
+		m_descriptors(std::vector<std::vector<IDescriptor *>>()),
+		m_changed(std::vector<bool>()),
+		m_dynamicBindings(std::vector<uint32_t>()),
+		m_dynamicOffsets(std::vector<uint32_t>()),
+		m_bindOffsets(std::vector<uint32_t>())
 	{
+		CreateDescriptorSets(pipeline);
+		std::fill(m_changed.begin(), m_changed.end(), true);
 	}
 
 	DescriptorsHandler::~DescriptorsHandler()
 	{
 	}
 
-	void DescriptorsHandler::Push(const std::string &descriptorName, IDescriptor *descriptor)
+	void DescriptorsHandler::Push(const std::string &descriptorName, IDescriptor *descriptor, const uint32_t &dynamicOffset)
 	{
-		if (m_shaderProgram == nullptr)
+		if (m_shaderProgram == nullptr || m_descriptors.empty())
 		{
 			return;
 		}
@@ -43,10 +54,13 @@ namespace acid
 			return;
 		}
 
-		if (m_descriptors.at(location) != descriptor)
+		auto frameIndex = Renderer::Get()->GetFrameIndex() % m_descriptors.size();
+		m_dynamicOffsets.at(location) = dynamicOffset;
+
+		if (m_descriptors[frameIndex].at(location) != descriptor)
 		{
-			m_descriptors.at(location) = descriptor;
-			m_changed = true;
+			m_descriptors[frameIndex].at(location) = descriptor;
+			m_changed[frameIndex] = true;
 		}
 	}
 
@@ -57,29 +71,94 @@ namespace acid
 			return;
 		}
 
+		// Handlers of the same block size share a ring descriptor, only the dynamic offset differs between objects.
 		uniformHandler->Update(m_shaderProgram->GetUniformBlock(descriptorName));
-		Push(descriptorName, uniformHandler->GetUniformBuffer());
+		Push(descriptorName, uniformHandler->GetAllocation().m_descriptor, uniformHandler->GetAllocation().m_offset);
 	}
 
 	bool DescriptorsHandler::Update(const IPipeline &pipeline)
 	{
-		if (m_shaderProgram != pipeline.GetShaderProgram())
+		// Pipelines still being built have no reflection to bind against, the draw is skipped until they are ready.
+		if (!pipeline.IsReady())
 		{
-			m_descriptors.clear();
+			return false;
+		}
 
+		if (m_shaderProgram != pipeline.GetShaderProgram() || m_descriptorSets.size() != Renderer::Get()->GetFramesInFlight())
+		{
 			m_shaderProgram = pipeline.GetShaderProgram();
-			m_descriptors.resize(m_shaderProgram->GetLastDescriptorBinding() + 1);
-			m_descriptorSet = std::make_shared<DescriptorSet>(pipeline);
-			m_changed = false;
+			CreateDescriptorSets(pipeline);
 			return false;
 		}
 
-		if (m_changed)
+		auto frameIndex = Renderer::Get()->GetFrameIndex();
+
+		// Textures are bound once their upload has finished, until then the draw is skipped.
+		for (auto &descriptor : m_descriptors[frameIndex])
+		{
+			if (descriptor != nullptr && !descriptor->IsReady())
+			{
+				return false;
+			}
+		}
+
+		if (m_changed[frameIndex])
 		{
-			m_descriptorSet->Update(m_descriptors);
-			m_changed = false;
+			m_descriptorSets[frameIndex]->Update(m_descriptors[frameIndex]);
+			m_changed[frameIndex] = false;
 		}
 
 		return true;
 	}
+
+	void DescriptorsHandler::BindDescriptor(const CommandBuffer &commandBuffer)
+	{
+		// Dynamic offsets are consumed in binding order.
+		m_bindOffsets.clear();
+
+		for (auto &binding : m_dynamicBindings)
+		{
+			m_bindOffsets.emplace_back(m_dynamicOffsets[binding]);
+		}
+
+		GetDescriptorSet()->BindDescriptor(commandBuffer, m_bindOffsets);
+	}
+
+	std::shared_ptr<DescriptorSet> DescriptorsHandler::GetDescriptorSet() const
+	{
+		if (m_descriptorSets.empty())
+		{
+			return nullptr;
+		}
+
+		return m_descriptorSets.at(Renderer::Get()->GetFrameIndex() % m_descriptorSets.size());
+	}
+
+	void DescriptorsHandler::CreateDescriptorSets(const IPipeline &pipeline)
+	{
+		auto framesInFlight = Renderer::Get()->GetFramesInFlight();
+
+		m_descriptorSets.clear();
+		m_descriptors.clear();
+
+		for (uint32_t i = 0; i < framesInFlight; i++)
+		{
+			m_descriptorSets.emplace_back(std::make_shared<DescriptorSet>(pipeline));
+			m_descriptors.emplace_back(std::vector<IDescriptor *>(m_shaderProgram->GetLastDescriptorBinding() + 1));
+		}
+
+		m_changed = std::vector<bool>(framesInFlight, false);
+		m_dynamicBindings.clear();
+		m_dynamicOffsets = std::vector<uint32_t>(m_shaderProgram->GetLastDescriptorBinding() + 1, 0);
+
+		for (auto &type : m_shaderProgram->GetDescriptors())
+		{
+			if (type.GetLayoutBinding().descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+			{
+				m_dynamicBindings.emplace_back(type.GetBinding());
+			}
+		}
+
+		std::sort(m_dynamicBindings.begin(), m_dynamicBindings.end());
+	}
 }
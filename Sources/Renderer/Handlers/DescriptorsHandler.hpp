@@ -8,15 +8,19 @@
 namespace acid
 {
 	/// <summary>
-	/// Class that handles a descriptor set.
+	/// Class that handles a descriptor set, with a set for each frame in flight so a set is never written while the GPU
+	/// may still read it. Uniform blocks are dynamic uniform buffers, their offsets are bound with the set.
 	/// </summary>
 	class ACID_EXPORT DescriptorsHandler
 	{
 	private:
 		std::shared_ptr<ShaderProgram> m_shaderProgram;
-		std::shared_ptr<DescriptorSet> m_descriptorSet;
-		std::vector<IDescriptor *> m_descriptors;
-		bool m_changed;
+		std::vector<std::shared_ptr<DescriptorSet>> m_descriptorSets;
+		std::vector<std::vector<IDescriptor *>> m_descriptors;
+		std::vector<bool> m_changed;
+		std::vector<uint32_t> m_dynamicBindings;
+		std::vector<uint32_t> m_dynamicOffsets;
+		std::vector<uint32_t> m_bindOffsets;
 	public:
 		DescriptorsHandler();
 
@@ -24,7 +28,13 @@ namespace acid
 
 		~DescriptorsHandler();
 
-		void Push(const std::string &descriptorName, IDescriptor *descriptor);
+		/// <summary>
+		/// Pushes a descriptor to the binding of a name.
+		/// </summary>
+		/// <param name="descriptorName"> The name of the descriptor in the shader. </param>
+		/// <param name="descriptor"> The descriptor. </param>
+		/// <param name="dynamicOffset"> The offset bound with the descriptor, used by dynamic uniform buffers. </param>
+		void Push(const std::string &descriptorName, IDescriptor *descriptor, const uint32_t &dynamicOffset = 0);
 
 		void Push(const std::string &descriptorName, IDescriptor &descriptor) { Push(descriptorName, &descriptor); }
 
@@ -38,8 +48,14 @@ namespace acid
 
 		bool Update(const IPipeline &pipeline);
 
-		void BindDescriptor(const CommandBuffer &commandBuffer) { m_descriptorSet->BindDescriptor(commandBuffer); }
+		void BindDescriptor(const CommandBuffer &commandBuffer);
 
-		std::shared_ptr<DescriptorSet> GetDescriptorSet() const { return m_descriptorSet; }
+		/// <summary>
+		/// Gets the descriptor set of the frame being recorded.
+		/// </summary>
+		/// <returns> The current frames descriptor set. </returns>
+		std::shared_ptr<DescriptorSet> GetDescriptorSet() const;
+	private:
+		void CreateDescriptorSets(const IPipeline &pipeline);
 	};
 }
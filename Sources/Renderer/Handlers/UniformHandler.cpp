@@ -1,22 +1,26 @@
 #include "UniformHandler.hpp"
 
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
 	UniformHandler::UniformHandler(const bool &multipipeline) :
 		m_multipipeline(multipipeline),
 		m_uniformBlock(nullptr),
-		m_uniformBuffer(nullptr),
 		m_data(nullptr),
-		m_changed(false)
+		m_changed(false),
+		m_frame(UINT64_MAX),
+		m_allocation({})
 	{
 	}
 
 	UniformHandler::UniformHandler(const std::shared_ptr<UniformBlock> &uniformBlock, const bool &multipipeline) :
 		m_multipipeline(multipipeline),
 		m_uniformBlock(uniformBlock),
-		m_uniformBuffer(std::make_shared<UniformBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()))),
-		m_data(malloc(static_cast<size_t>(m_uniformBlock->GetSize()))),
-		m_changed(true)
+		m_data(calloc(1, static_cast<size_t>(m_uniformBlock->GetSize()))),
+		m_changed(true),
+		m_frame(UINT64_MAX),
+		m_allocation({})
 	{
 	}
 
@@ -27,23 +31,45 @@ namespace acid
 
 	bool UniformHandler::Update(const std::shared_ptr<UniformBlock> &uniformBlock)
 	{
+		if (uniformBlock == nullptr)
+		{
+			return false;
+		}
+
+		bool created = false;
+
 		if ((m_multipipeline && m_uniformBlock == nullptr) || (!m_multipipeline && m_uniformBlock != uniformBlock))
 		{
 			free(m_data);
 
 			m_uniformBlock = uniformBlock;
-			m_uniformBuffer = std::make_shared<UniformBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()));
-			m_data = malloc(static_cast<size_t>(m_uniformBlock->GetSize()));
-			m_changed = false;
-			return false;
+			m_data = calloc(1, static_cast<size_t>(m_uniformBlock->GetSize()));
+			m_changed = true;
+			created = true;
 		}
 
-		if (m_changed)
+		// Ranges of the ring only live for the frame they were taken in, so the block is written again every frame.
+		auto &uniformRing = Renderer::Get()->GetUniformRing();
+
+		if (m_changed || m_frame != uniformRing.GetFrame())
 		{
-			m_uniformBuffer->Update(m_data);
+			auto size = static_cast<VkDeviceSize>(m_uniformBlock->GetSize());
+			m_allocation = uniformRing.Allocate(size);
+			memcpy(m_allocation.m_mapped, m_data, static_cast<size_t>(size));
+			m_frame = uniformRing.GetFrame();
 			m_changed = false;
 		}
 
-		return true;
+		return !created;
+	}
+
+	std::shared_ptr<Uniform> UniformHandler::GetUniform(const std::string &uniformName) const
+	{
+		if (m_uniformBlock == nullptr)
+		{
+			return nullptr;
+		}
+
+		return m_uniformBlock->GetUniform(uniformName);
 	}
 }
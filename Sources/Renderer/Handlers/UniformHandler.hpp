@@ -2,20 +2,23 @@
 
 #include <algorithm>
 #include "Renderer/Buffers/UniformBuffer.hpp"
+#include "Renderer/Buffers/UniformRing.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// Class that handles a uniform buffer.
+	/// Class that handles a uniform block, its data is copied into the renderers uniform ring the first time it is bound
+	/// each frame and again whenever it changes.
 	/// </summary>
 	class ACID_EXPORT UniformHandler
 	{
 	private:
 		bool m_multipipeline;
 		std::shared_ptr<UniformBlock> m_uniformBlock;
-		std::shared_ptr<UniformBuffer> m_uniformBuffer;
 		void *m_data;
 		bool m_changed;
+		uint64_t m_frame;
+		UniformRing::Allocation m_allocation;
 	public:
 		UniformHandler(const bool &multipipeline = false);
 
@@ -51,6 +54,23 @@ namespace acid
 				return;
 			}
 
+			Push(uniform, object, size);
+		}
+
+		/// <summary>
+		/// Pushes a uniform through a handle from <seealso cref="#GetUniform()"/>, skipping the lookup by name.
+		/// </summary>
+		/// <param name="uniform"> The uniform handle. </param>
+		/// <param name="object"> The value to push. </param>
+		/// <param name="size"> The size to push, or 0 for the smaller of the value and the uniform. </param>
+		template<typename T>
+		void Push(const std::shared_ptr<Uniform> &uniform, const T &object, const size_t &size = 0)
+		{
+			if (uniform == nullptr)
+			{
+				return;
+			}
+
 			size_t realSize = size;
 
 			if (realSize == 0)
@@ -61,8 +81,21 @@ namespace acid
 			Push(object, static_cast<size_t>(uniform->GetOffset()), realSize);
 		}
 
+		/// <summary>
+		/// Gets a handle to a uniform of the block, it stays valid until the block changes.
+		/// </summary>
+		/// <param name="uniformName"> The uniform name. </param>
+		/// <returns> The uniform, or null if the block is not known yet or has no uniform of that name. </returns>
+		std::shared_ptr<Uniform> GetUniform(const std::string &uniformName) const;
+
 		bool Update(const std::shared_ptr<UniformBlock> &uniformBlock);
 
-		std::shared_ptr<UniformBuffer> GetUniformBuffer() const { return m_uniformBuffer; }
+		std::shared_ptr<UniformBlock> GetUniformBlock() const { return m_uniformBlock; }
+
+		/// <summary>
+		/// Gets the range of the uniform ring the block was last written to, bound with its offset as a dynamic offset.
+		/// </summary>
+		/// <returns> The ring allocation. </returns>
+		const UniformRing::Allocation &GetAllocation() const { return m_allocation; }
 	};
 }
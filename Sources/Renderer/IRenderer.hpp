@@ -31,6 +31,16 @@ namespace acid
 		{
 		}
 
+		/// <summary>
+		/// Called once a frame before any render pass begins, so compute work the renderer draws from later in the frame
+		/// can be recorded into the primary command buffer.
+		/// </summary>
+		/// <param name="commandBuffer"> The primary command buffer, outside of a render pass. </param>
+		/// <param name="camera"> The camera to be used when rendering. </param>
+		virtual void RenderCompute(const CommandBuffer &commandBuffer, const ICamera &camera)
+		{
+		}
+
 		/// <summary>
 		/// Called when the renderer is needed to be rendered.
 		/// </summary>
@@ -38,6 +48,22 @@ namespace acid
 		/// <param name="camera"> The camera to be used when rendering. </param>
 		virtual void Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera) = 0;
 
+		/// <summary>
+		/// Called from a job when the renderer is recorded in parallel, the returned secondary command buffers are executed
+		/// in order. By default <seealso cref="#Render()"/> is recorded into one buffer, renderers with many draws can split
+		/// them between jobs that each record a buffer from <seealso cref="Renderer#BeginSecondary()"/>.
+		/// </summary>
+		/// <param name="clipPlane"> The current clip plane. </param>
+		/// <param name="camera"> The camera to be used when rendering. </param>
+		/// <returns> The ended secondary command buffers. </returns>
+		virtual std::vector<std::shared_ptr<CommandBuffer>> RenderSecondary(const Vector4 &clipPlane, const ICamera &camera)
+		{
+			auto commandBuffer = Renderer::Get()->BeginSecondary();
+			Render(*commandBuffer, clipPlane, camera);
+			commandBuffer->End();
+			return {commandBuffer};
+		}
+
 		GraphicsStage GetGraphicsStage() const { return m_graphicsStage; }
 
 		bool IsEnabled() const { return m_enabled; };
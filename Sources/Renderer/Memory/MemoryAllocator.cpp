@@ -0,0 +1,309 @@
+#include "MemoryAllocator.hpp"
+
+#include <algorithm>
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	const VkDeviceSize MemoryAllocator::BLOCK_SIZE = 64 * 1024 * 1024;
+
+	static VkDeviceSize AlignUp(const VkDeviceSize &value, const VkDeviceSize &alignment)
+	{
+		return alignment == 0 ? value : (value + alignment - 1) / alignment * alignment;
+	}
+
+	float MemoryStatistics::GetFragmentation() const
+	{
+		VkDeviceSize freeBytes = m_allocatedBytes - m_usedBytes;
+
+		if (freeBytes == 0)
+		{
+			return 0.0f;
+		}
+
+		return 1.0f - (static_cast<float>(m_largestFreeRange) / static_cast<float>(freeBytes));
+	}
+
+	MemoryBlock::MemoryBlock(const VkDeviceMemory &memory, const VkDeviceSize &size, void *mapped) :
+		m_memory(memory),
+		m_size(size),
+		m_mapped(mapped),
+		m_freeRanges(std::map<VkDeviceSize, VkDeviceSize>()),
+		m_allocationCount(0)
+	{
+		m_freeRanges.emplace(0, size);
+	}
+
+	bool MemoryBlock::Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset)
+	{
+		for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it)
+		{
+			VkDeviceSize rangeOffset = it->first;
+			VkDeviceSize rangeSize = it->second;
+			VkDeviceSize alignedOffset = AlignUp(rangeOffset, alignment);
+
+			if (alignedOffset + size > rangeOffset + rangeSize)
+			{
+				continue;
+			}
+
+			// The padding before the aligned offset stays free, as does anything after the range.
+			m_freeRanges.erase(it);
+
+			if (alignedOffset > rangeOffset)
+			{
+				m_freeRanges.emplace(rangeOffset, alignedOffset - rangeOffset);
+			}
+
+			if (alignedOffset + size < rangeOffset + rangeSize)
+			{
+				m_freeRanges.emplace(alignedOffset + size, rangeOffset + rangeSize - alignedOffset - size);
+			}
+
+			offset = alignedOffset;
+			m_allocationCount++;
+			return true;
+		}
+
+		return false;
+	}
+
+	void MemoryBlock::Free(const VkDeviceSize &offset, const VkDeviceSize &size)
+	{
+		VkDeviceSize rangeOffset = offset;
+		VkDeviceSize rangeSize = size;
+
+		// Merges with the free range after this one.
+		auto next = m_freeRanges.lower_bound(offset);
+
+		if (next != m_freeRanges.end() && next->first == offset + size)
+		{
+			rangeSize += next->second;
+			next = m_freeRanges.erase(next);
+		}
+
+		// Merges with the free range before this one.
+		if (next != m_freeRanges.begin())
+		{
+			auto previous = std::prev(next);
+
+			if (previous->first + previous->second == offset)
+			{
+				rangeOffset = previous->first;
+				rangeSize += previous->second;
+				m_freeRanges.erase(previous);
+			}
+		}
+
+		m_freeRanges.emplace(rangeOffset, rangeSize);
+		m_allocationCount--;
+	}
+
+	MemoryAllocator::MemoryAllocator(const VkDevice &logicalDevice, const VkPhysicalDeviceMemoryProperties &memoryProperties) :
+		m_logicalDevice(logicalDevice),
+		m_memoryProperties(memoryProperties),
+		m_pools(std::array<std::vector<std::unique_ptr<MemoryBlock>>, 2 * VK_MAX_MEMORY_TYPES>()),
+		m_dedicatedCount(0),
+		m_dedicatedBytes(0)
+	{
+	}
+
+	MemoryAllocator::~MemoryAllocator()
+	{
+		for (auto &pool : m_pools)
+		{
+			for (auto &block : pool)
+			{
+				vkFreeMemory(m_logicalDevice, block->GetMemory(), nullptr);
+			}
+		}
+
+		if (m_dedicatedCount != 0)
+		{
+			Log::Error("Memory allocator destroyed with %i dedicated allocations still alive\n", m_dedicatedCount);
+		}
+	}
+
+	uint32_t MemoryAllocator::FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &properties) const
+	{
+		for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+		{
+			// If typefilter has a bit set to 1 and it contains the properties we indicated.
+			if ((typeFilter & (1 << i)) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			{
+				return i;
+			}
+		}
+
+		throw std::runtime_error("Failed to find a valid memory type!");
+	}
+
+	MemoryAllocation MemoryAllocator::Allocate(const VkMemoryRequirements &requirements, const VkMemoryPropertyFlags &properties, const bool &linear)
+	{
+		uint32_t memoryType = FindMemoryType(requirements.memoryTypeBits, properties);
+		uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryType].heapIndex;
+
+		// Small heaps, like host visible device memory, would be used up by a few blocks.
+		VkDeviceSize blockSize = std::min(BLOCK_SIZE, AlignUp(m_memoryProperties.memoryHeaps[heapIndex].size / 8, 1024 * 1024));
+
+		MemoryAllocation allocation = {};
+		allocation.m_size = requirements.size;
+		allocation.m_memoryType = memoryType;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (requirements.size <= blockSize / 2)
+		{
+			auto &pool = m_pools[(2 * memoryType) + (linear ? 0 : 1)];
+
+			for (auto &block : pool)
+			{
+				if (block->Allocate(requirements.size, requirements.alignment, allocation.m_offset))
+				{
+					allocation.m_block = block.get();
+					break;
+				}
+			}
+
+			VkDeviceMemory memory = VK_NULL_HANDLE;
+			void *mapped = nullptr;
+
+			if (allocation.m_block == nullptr && AllocateMemory(blockSize, memoryType, memory, mapped))
+			{
+				pool.emplace_back(std::make_unique<MemoryBlock>(memory, blockSize, mapped));
+				pool.back()->Allocate(requirements.size, requirements.alignment, allocation.m_offset);
+				allocation.m_block = pool.back().get();
+			}
+
+			if (allocation.m_block != nullptr)
+			{
+				allocation.m_memory = allocation.m_block->GetMemory();
+
+				if (allocation.m_block->GetMapped() != nullptr)
+				{
+					allocation.m_mapped = static_cast<char *>(allocation.m_block->GetMapped()) + allocation.m_offset;
+				}
+
+				return allocation;
+			}
+		}
+
+		// Large resources, or ones that did not fit a new block, get their own device memory.
+		if (!AllocateMemory(requirements.size, memoryType, allocation.m_memory, allocation.m_mapped))
+		{
+			throw std::runtime_error("Failed to allocate device memory!");
+		}
+
+		m_dedicatedCount++;
+		m_dedicatedBytes += requirements.size;
+		return allocation;
+	}
+
+	void MemoryAllocator::Free(MemoryAllocation &allocation)
+	{
+		if (allocation.m_memory == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (allocation.m_block == nullptr)
+		{
+			vkFreeMemory(m_logicalDevice, allocation.m_memory, nullptr);
+			m_dedicatedCount--;
+			m_dedicatedBytes -= allocation.m_size;
+			allocation = {};
+			return;
+		}
+
+		allocation.m_block->Free(allocation.m_offset, allocation.m_size);
+
+		if (allocation.m_block->IsEmpty())
+		{
+			// Keeps one empty block per pool so a resource that is recreated every frame does not reallocate the block,
+			// the newly empty block is only released when the pool already has another empty block.
+			for (uint32_t i = 2 * allocation.m_memoryType; i < (2 * allocation.m_memoryType) + 2; i++)
+			{
+				auto &pool = m_pools[i];
+				auto it = std::find_if(pool.begin(), pool.end(), [&](const std::unique_ptr<MemoryBlock> &block)
+				{
+					return block.get() == allocation.m_block;
+				});
+
+				if (it == pool.end())
+				{
+					continue;
+				}
+
+				auto emptyCount = std::count_if(pool.begin(), pool.end(), [](const std::unique_ptr<MemoryBlock> &block)
+				{
+					return block->IsEmpty();
+				});
+
+				if (emptyCount > 1)
+				{
+					vkFreeMemory(m_logicalDevice, (*it)->GetMemory(), nullptr);
+					pool.erase(it);
+				}
+			}
+		}
+
+		allocation = {};
+	}
+
+	MemoryStatistics MemoryAllocator::GetStatistics() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		MemoryStatistics statistics = {};
+		statistics.m_dedicatedCount = m_dedicatedCount;
+		statistics.m_allocationCount = m_dedicatedCount;
+		statistics.m_allocatedBytes = m_dedicatedBytes;
+		statistics.m_usedBytes = m_dedicatedBytes;
+
+		for (auto &pool : m_pools)
+		{
+			for (auto &block : pool)
+			{
+				VkDeviceSize freeBytes = 0;
+
+				for (auto &[offset, size] : block->GetFreeRanges())
+				{
+					freeBytes += size;
+					statistics.m_largestFreeRange = std::max(statistics.m_largestFreeRange, size);
+				}
+
+				statistics.m_blockCount++;
+				statistics.m_allocationCount += block->GetAllocationCount();
+				statistics.m_allocatedBytes += block->GetSize();
+				statistics.m_usedBytes += block->GetSize() - freeBytes;
+				statistics.m_freeRangeCount += static_cast<uint32_t>(block->GetFreeRanges().size());
+			}
+		}
+
+		return statistics;
+	}
+
+	bool MemoryAllocator::AllocateMemory(const VkDeviceSize &size, const uint32_t &memoryType, VkDeviceMemory &memory, void *&mapped)
+	{
+		VkMemoryAllocateInfo memoryAllocateInfo = {};
+		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		memoryAllocateInfo.allocationSize = size;
+		memoryAllocateInfo.memoryTypeIndex = memoryType;
+
+		if (vkAllocateMemory(m_logicalDevice, &memoryAllocateInfo, nullptr, &memory) != VK_SUCCESS)
+		{
+			return false;
+		}
+
+		mapped = nullptr;
+
+		if (m_memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+		{
+			Display::CheckVk(vkMapMemory(m_logicalDevice, memory, 0, VK_WHOLE_SIZE, 0, &mapped));
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	class MemoryBlock;
+
+	/// <summary>
+	/// A range of device memory handed out by the <seealso cref="MemoryAllocator"/>, resources are bound at the offset.
+	/// </summary>
+	struct ACID_EXPORT MemoryAllocation
+	{
+		VkDeviceMemory m_memory;
+		VkDeviceSize m_offset;
+		VkDeviceSize m_size;
+		// The persistent mapping of the range, null unless the memory is host visible.
+		void *m_mapped;
+		uint32_t m_memoryType;
+		// The block the range was taken from, null for dedicated allocations.
+		MemoryBlock *m_block;
+	};
+
+	/// <summary>
+	/// A snapshot of how much device memory the allocator holds and how fragmented the free space in its blocks is.
+	/// </summary>
+	struct ACID_EXPORT MemoryStatistics
+	{
+		uint32_t m_blockCount;
+		uint32_t m_dedicatedCount;
+		uint32_t m_allocationCount;
+		VkDeviceSize m_allocatedBytes;
+		VkDeviceSize m_usedBytes;
+		uint32_t m_freeRangeCount;
+		VkDeviceSize m_largestFreeRange;
+
+		/// <summary>
+		/// Gets the fragmentation of the free space in blocks.
+		/// </summary>
+		/// <returns> 0 when all free space is one range, approaches 1 as it is split into many small ranges. </returns>
+		float GetFragmentation() const;
+	};
+
+	/// <summary>
+	/// One vkAllocateMemory of a single memory type that resources are sub-allocated from. Free space is kept as a sorted
+	/// list of ranges that are merged with their neighbours when freed.
+	/// </summary>
+	class ACID_EXPORT MemoryBlock
+	{
+	private:
+		VkDeviceMemory m_memory;
+		VkDeviceSize m_size;
+		void *m_mapped;
+		std::map<VkDeviceSize, VkDeviceSize> m_freeRanges;
+		uint32_t m_allocationCount;
+	public:
+		MemoryBlock(const VkDeviceMemory &memory, const VkDeviceSize &size, void *mapped);
+
+		/// <summary>
+		/// Takes a range from the first free range it fits in.
+		/// </summary>
+		/// <param name="size"> The size of the range. </param>
+		/// <param name="alignment"> The alignment of the range offset. </param>
+		/// <param name="offset"> The offset of the range in the block. </param>
+		/// <returns> If the block had space. </returns>
+		bool Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset);
+
+		void Free(const VkDeviceSize &offset, const VkDeviceSize &size);
+
+		bool IsEmpty() const { return m_allocationCount == 0; }
+
+		VkDeviceMemory GetMemory() const { return m_memory; }
+
+		VkDeviceSize GetSize() const { return m_size; }
+
+		void *GetMapped() const { return m_mapped; }
+
+		const std::map<VkDeviceSize, VkDeviceSize> &GetFreeRanges() const { return m_freeRanges; }
+
+		uint32_t GetAllocationCount() const { return m_allocationCount; }
+	};
+
+	/// <summary>
+	/// Sub-allocates device memory for buffers and images from large blocks, keeping one pool of blocks per memory type.
+	/// Linear resources (buffers, linear images) and optimal images are pooled apart so neighbours never break the
+	/// buffer image granularity. Host visible blocks are mapped once for their whole life.
+	/// </summary>
+	class ACID_EXPORT MemoryAllocator
+	{
+	public:
+		static const VkDeviceSize BLOCK_SIZE;
+	private:
+		VkDevice m_logicalDevice;
+		VkPhysicalDeviceMemoryProperties m_memoryProperties;
+		std::array<std::vector<std::unique_ptr<MemoryBlock>>, 2 * VK_MAX_MEMORY_TYPES> m_pools;
+		uint32_t m_dedicatedCount;
+		VkDeviceSize m_dedicatedBytes;
+		mutable std::mutex m_mutex;
+	public:
+		/// <summary>
+		/// Creates a new memory allocator.
+		/// </summary>
+		/// <param name="logicalDevice"> The device memory is allocated from. </param>
+		/// <param name="memoryProperties"> The memory properties of the physical device. </param>
+		MemoryAllocator(const VkDevice &logicalDevice, const VkPhysicalDeviceMemoryProperties &memoryProperties);
+
+		~MemoryAllocator();
+
+		/// <summary>
+		/// Finds the first memory type allowed by a filter that has all of the properties.
+		/// </summary>
+		/// <param name="typeFilter"> The allowed memory type bits. </param>
+		/// <param name="properties"> The required memory properties. </param>
+		/// <returns> The memory type index. </returns>
+		uint32_t FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &properties) const;
+
+		/// <summary>
+		/// Allocates memory for a resource. Resources larger than half a block get their own device memory.
+		/// </summary>
+		/// <param name="requirements"> The resources memory requirements. </param>
+		/// <param name="properties"> The required memory properties. </param>
+		/// <param name="linear"> If the resource is a buffer or linear image. </param>
+		/// <returns> The allocation, the resource must be bound at its offset. </returns>
+		MemoryAllocation Allocate(const VkMemoryRequirements &requirements, const VkMemoryPropertyFlags &properties, const bool &linear);
+
+		/// <summary>
+		/// Returns an allocation to its block, a block left empty is released if its pool already has another empty block.
+		/// </summary>
+		/// <param name="allocation"> The allocation to free, it is reset. </param>
+		void Free(MemoryAllocation &allocation);
+
+		MemoryStatistics GetStatistics() const;
+	private:
+		bool AllocateMemory(const VkDeviceSize &size, const uint32_t &memoryType, VkDeviceMemory &memory, void *&mapped);
+	};
+}
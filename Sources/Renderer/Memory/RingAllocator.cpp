@@ -0,0 +1,62 @@
+#include "RingAllocator.hpp"
+
+namespace acid
+{
+	RingAllocator::RingAllocator(const VkDeviceSize &size) :
+		m_size(size),
+		m_head(0),
+		m_tail(0),
+		m_used(0)
+	{
+	}
+
+	bool RingAllocator::Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset)
+	{
+		if (m_used == 0)
+		{
+			m_head = 0;
+			m_tail = 0;
+		}
+
+		VkDeviceSize start = alignment == 0 ? m_head : (m_head + alignment - 1) / alignment * alignment;
+		bool wrapped = false;
+
+		if (m_used == 0 || m_head > m_tail)
+		{
+			// Live ranges are in [tail, head), so the space after the head and before the tail is free.
+			if (start + size > m_size)
+			{
+				if (size > m_tail)
+				{
+					return false;
+				}
+
+				wrapped = true;
+				start = 0;
+			}
+		}
+		else if (start + size > m_tail)
+		{
+			// Live ranges wrap, so only the space between the head and the tail is free.
+			return false;
+		}
+
+		offset = start;
+		m_used += wrapped ? (m_size - m_head) + size : (start + size) - m_head;
+		m_head = start + size;
+		return true;
+	}
+
+	void RingAllocator::Release(const VkDeviceSize &head)
+	{
+		if (head == m_head)
+		{
+			m_tail = m_head;
+			m_used = 0;
+			return;
+		}
+
+		m_used -= head >= m_tail ? head - m_tail : (m_size - m_tail) + head;
+		m_tail = head;
+	}
+}
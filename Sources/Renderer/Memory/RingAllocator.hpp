@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Hands out aligned offsets into a fixed size range that wraps around, ranges are released in the order they were
+	/// taken. Ranges never straddle the end, the space skipped when wrapping is released with the range before it.
+	/// Callers remember <seealso cref="GetHead()"/> when they submit work and release up to it once the GPU is done.
+	/// </summary>
+	class ACID_EXPORT RingAllocator
+	{
+	private:
+		VkDeviceSize m_size;
+		VkDeviceSize m_head;
+		VkDeviceSize m_tail;
+		VkDeviceSize m_used;
+	public:
+		/// <summary>
+		/// Creates a new ring allocator.
+		/// </summary>
+		/// <param name="size"> The size of the range offsets are taken from. </param>
+		explicit RingAllocator(const VkDeviceSize &size);
+
+		/// <summary>
+		/// Takes a range after the last one, wrapping to the start when it does not fit before the end.
+		/// </summary>
+		/// <param name="size"> The size of the range. </param>
+		/// <param name="alignment"> The alignment of the range offset. </param>
+		/// <param name="offset"> The offset of the range. </param>
+		/// <returns> If the range fit in the space that has been released. </returns>
+		bool Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset);
+
+		/// <summary>
+		/// Releases every range taken before the head was at a position.
+		/// </summary>
+		/// <param name="head"> A value returned by <seealso cref="GetHead()"/>. </param>
+		void Release(const VkDeviceSize &head);
+
+		VkDeviceSize GetSize() const { return m_size; }
+
+		VkDeviceSize GetHead() const { return m_head; }
+
+		VkDeviceSize GetUsed() const { return m_used; }
+	};
+}
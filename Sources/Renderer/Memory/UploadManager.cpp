@@ -0,0 +1,383 @@
+#include "UploadManager.hpp"
+
+#include <algorithm>
+#include "Display/Display.hpp"
+#include "Textures/Texture.hpp"
+
+namespace acid
+{
+	const VkDeviceSize UploadManager::STAGING_SIZE = 32 * 1024 * 1024;
+
+	static VkCommandPool CreateCommandPool(const uint32_t &queueFamily)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		commandPoolCreateInfo.queueFamilyIndex = queueFamily;
+		commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+		VkCommandPool commandPool = VK_NULL_HANDLE;
+		Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &commandPool));
+		return commandPool;
+	}
+
+	static VkCommandBuffer AllocateCommandBuffer(const VkCommandPool &commandPool)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+		commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		commandBufferAllocateInfo.commandPool = commandPool;
+		commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandBufferAllocateInfo.commandBufferCount = 1;
+
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		Display::CheckVk(vkAllocateCommandBuffers(logicalDevice, &commandBufferAllocateInfo, &commandBuffer));
+		return commandBuffer;
+	}
+
+	static bool IsFenceDone(const VkFence &fence, const bool &used, const bool &wait)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		if (!used)
+		{
+			return true;
+		}
+
+		if (wait)
+		{
+			Display::CheckVk(vkWaitForFences(logicalDevice, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			return true;
+		}
+
+		return vkGetFenceStatus(logicalDevice, fence) == VK_SUCCESS;
+	}
+
+	UploadManager::UploadManager() :
+		m_dedicatedTransfer(Display::Get()->GetTransferFamily() != Display::Get()->GetGraphicsFamily()),
+		m_transferPool(VK_NULL_HANDLE),
+		m_graphicsPool(VK_NULL_HANDLE),
+		m_stagingAlignment(std::max<VkDeviceSize>(16, Display::Get()->GetPhysicalDeviceProperties().limits.optimalBufferCopyOffsetAlignment)),
+		m_stagingBuffer(std::make_unique<Buffer>(STAGING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)),
+		m_stagingRing(RingAllocator(STAGING_SIZE)),
+		m_recording(nullptr),
+		m_pending(std::vector<std::unique_ptr<Submission>>()),
+		m_free(std::vector<std::unique_ptr<Submission>>())
+	{
+		m_graphicsPool = CreateCommandPool(Display::Get()->GetGraphicsFamily());
+
+		if (m_dedicatedTransfer)
+		{
+			m_transferPool = CreateCommandPool(Display::Get()->GetTransferFamily());
+		}
+	}
+
+	UploadManager::~UploadManager()
+	{
+		Wait();
+
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		for (auto &submission : m_free)
+		{
+			DestroySubmission(*submission);
+		}
+
+		if (m_recording != nullptr)
+		{
+			DestroySubmission(*m_recording);
+		}
+
+		vkDestroyCommandPool(logicalDevice, m_graphicsPool, nullptr);
+
+		if (m_transferPool != VK_NULL_HANDLE)
+		{
+			vkDestroyCommandPool(logicalDevice, m_transferPool, nullptr);
+		}
+	}
+
+	void UploadManager::UploadBuffer(const void *data, const VkDeviceSize &size, const VkBuffer &buffer, const VkDeviceSize &offset, const std::function<void()> &onComplete)
+	{
+		if (size == 0)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto &submission = GetRecording();
+
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+
+		VkBufferCopy region = {};
+		region.srcOffset = Stage(submission, data, size, stagingBuffer);
+		region.dstOffset = offset;
+		region.size = size;
+		vkCmdCopyBuffer(GetCommands(submission, false), stagingBuffer, buffer, 1, &region);
+
+		if (onComplete)
+		{
+			submission.m_callbacks.emplace_back(onComplete);
+		}
+	}
+
+	void UploadManager::UploadImage(const void *data, const VkDeviceSize &size, const VkImage &image, const uint32_t &width, const uint32_t &height,
+		const uint32_t &mipLevels, const uint32_t &layerCount, const std::function<void()> &onComplete)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto &submission = GetRecording();
+		auto transferCommands = GetCommands(submission, false);
+
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VkDeviceSize stagingOffset = Stage(submission, data, size, stagingBuffer);
+
+		Texture::InsertImageMemoryBarrier(transferCommands, image, 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, mipLevels, 0, layerCount});
+
+		VkBufferImageCopy region = {};
+		region.bufferOffset = stagingOffset;
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = layerCount;
+		region.imageOffset = {0, 0, 0};
+		region.imageExtent = {width, height, 1};
+		vkCmdCopyBufferToImage(transferCommands, stagingBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+		if (mipLevels > 1)
+		{
+			// Blits need the graphics queue, when copies ran on the transfer queue the graphics submission waits for them.
+			Texture::CreateMipmaps(GetCommands(submission, true), image, width, height, mipLevels, layerCount);
+		}
+		else if (m_dedicatedTransfer)
+		{
+			// Transfer queues can not wait on shader stages, the fence orders the transition before any draws using it.
+			Texture::InsertImageMemoryBarrier(transferCommands, image, VK_ACCESS_TRANSFER_WRITE_BIT, 0,
+				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+				VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, mipLevels, 0, layerCount});
+		}
+		else
+		{
+			Texture::InsertImageMemoryBarrier(transferCommands, image, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+				VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, mipLevels, 0, layerCount});
+		}
+
+		if (onComplete)
+		{
+			submission.m_callbacks.emplace_back(onComplete);
+		}
+	}
+
+	void UploadManager::Update()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto callbacks = Retire(false);
+		Submit();
+		lock.unlock();
+
+		for (auto &callback : callbacks)
+		{
+			callback();
+		}
+	}
+
+	void UploadManager::Wait()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		Submit();
+		auto callbacks = Retire(true);
+		lock.unlock();
+
+		for (auto &callback : callbacks)
+		{
+			callback();
+		}
+	}
+
+	UploadManager::Submission &UploadManager::GetRecording()
+	{
+		if (m_recording != nullptr)
+		{
+			return *m_recording;
+		}
+
+		if (!m_free.empty())
+		{
+			m_recording = std::move(m_free.back());
+			m_free.pop_back();
+			return *m_recording;
+		}
+
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		VkFenceCreateInfo fenceCreateInfo = {};
+		fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+		VkSemaphoreCreateInfo semaphoreCreateInfo = {};
+		semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+		m_recording = std::make_unique<Submission>();
+		m_recording->m_graphicsCommands = AllocateCommandBuffer(m_graphicsPool);
+		Display::CheckVk(vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_recording->m_graphicsFence));
+
+		if (m_dedicatedTransfer)
+		{
+			m_recording->m_transferCommands = AllocateCommandBuffer(m_transferPool);
+			Display::CheckVk(vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_recording->m_transferFence));
+			Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_recording->m_semaphore));
+		}
+
+		return *m_recording;
+	}
+
+	VkCommandBuffer UploadManager::GetCommands(Submission &submission, const bool &graphics)
+	{
+		// Without a dedicated transfer queue everything is recorded in order into the graphics commands.
+		bool useGraphics = graphics || !m_dedicatedTransfer;
+		bool &used = useGraphics ? submission.m_graphicsUsed : submission.m_transferUsed;
+		VkCommandBuffer commandBuffer = useGraphics ? submission.m_graphicsCommands : submission.m_transferCommands;
+
+		if (!used)
+		{
+			VkCommandBufferBeginInfo beginInfo = {};
+			beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+			Display::CheckVk(vkBeginCommandBuffer(commandBuffer, &beginInfo));
+			used = true;
+		}
+
+		return commandBuffer;
+	}
+
+	VkDeviceSize UploadManager::Stage(Submission &submission, const void *data, const VkDeviceSize &size, VkBuffer &buffer)
+	{
+		VkDeviceSize offset = 0;
+
+		if (m_stagingRing.Allocate(size, m_stagingAlignment, offset))
+		{
+			memcpy(static_cast<char *>(m_stagingBuffer->GetMapped()) + offset, data, static_cast<size_t>(size));
+			buffer = m_stagingBuffer->GetBuffer();
+			return offset;
+		}
+
+		// Uploads larger than the free part of the ring get a staging buffer that lives until the submission is retired.
+		auto stagingBuffer = std::make_unique<Buffer>(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		memcpy(stagingBuffer->GetMapped(), data, static_cast<size_t>(size));
+		buffer = stagingBuffer->GetBuffer();
+		submission.m_stagingBuffers.emplace_back(std::move(stagingBuffer));
+		return 0;
+	}
+
+	void UploadManager::Submit()
+	{
+		if (m_recording == nullptr || (!m_recording->m_transferUsed && !m_recording->m_graphicsUsed))
+		{
+			return;
+		}
+
+		auto &submission = *m_recording;
+		submission.m_stagingHead = m_stagingRing.GetHead();
+
+		std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+
+		if (submission.m_transferUsed)
+		{
+			Display::CheckVk(vkEndCommandBuffer(submission.m_transferCommands));
+
+			VkSubmitInfo submitInfo = {};
+			submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			submitInfo.commandBufferCount = 1;
+			submitInfo.pCommandBuffers = &submission.m_transferCommands;
+
+			if (submission.m_graphicsUsed)
+			{
+				submitInfo.signalSemaphoreCount = 1;
+				submitInfo.pSignalSemaphores = &submission.m_semaphore;
+			}
+
+			Display::CheckVk(vkQueueSubmit(Display::Get()->GetTransferQueue(), 1, &submitInfo, submission.m_transferFence));
+		}
+
+		if (submission.m_graphicsUsed)
+		{
+			Display::CheckVk(vkEndCommandBuffer(submission.m_graphicsCommands));
+
+			VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+			VkSubmitInfo submitInfo = {};
+			submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			submitInfo.commandBufferCount = 1;
+			submitInfo.pCommandBuffers = &submission.m_graphicsCommands;
+
+			if (submission.m_transferUsed)
+			{
+				submitInfo.waitSemaphoreCount = 1;
+				submitInfo.pWaitSemaphores = &submission.m_semaphore;
+				submitInfo.pWaitDstStageMask = &waitStage;
+			}
+
+			Display::CheckVk(vkQueueSubmit(Display::Get()->GetGraphicsQueue(), 1, &submitInfo, submission.m_graphicsFence));
+		}
+
+		m_pending.emplace_back(std::move(m_recording));
+	}
+
+	std::vector<std::function<void()>> UploadManager::Retire(const bool &wait)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		std::vector<std::function<void()>> callbacks = {};
+		std::size_t retired = 0;
+
+		// Submissions are retired in order, the staging ring has to be released in the order it was written.
+		for (; retired < m_pending.size(); retired++)
+		{
+			auto &submission = *m_pending[retired];
+
+			if (!IsFenceDone(submission.m_transferFence, submission.m_transferUsed, wait) ||
+				!IsFenceDone(submission.m_graphicsFence, submission.m_graphicsUsed, wait))
+			{
+				break;
+			}
+
+			if (submission.m_transferUsed)
+			{
+				Display::CheckVk(vkResetFences(logicalDevice, 1, &submission.m_transferFence));
+			}
+
+			if (submission.m_graphicsUsed)
+			{
+				Display::CheckVk(vkResetFences(logicalDevice, 1, &submission.m_graphicsFence));
+			}
+
+			m_stagingRing.Release(submission.m_stagingHead);
+			submission.m_transferUsed = false;
+			submission.m_graphicsUsed = false;
+			submission.m_stagingBuffers.clear();
+			std::move(submission.m_callbacks.begin(), submission.m_callbacks.end(), std::back_inserter(callbacks));
+			submission.m_callbacks.clear();
+			m_free.emplace_back(std::move(m_pending[retired]));
+		}
+
+		m_pending.erase(m_pending.begin(), m_pending.begin() + retired);
+		return callbacks;
+	}
+
+	void UploadManager::DestroySubmission(Submission &submission)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		vkFreeCommandBuffers(logicalDevice, m_graphicsPool, 1, &submission.m_graphicsCommands);
+		vkDestroyFence(logicalDevice, submission.m_graphicsFence, nullptr);
+
+		if (m_dedicatedTransfer)
+		{
+			vkFreeCommandBuffers(logicalDevice, m_transferPool, 1, &submission.m_transferCommands);
+			vkDestroyFence(logicalDevice, submission.m_transferFence, nullptr);
+			vkDestroySemaphore(logicalDevice, submission.m_semaphore, nullptr);
+		}
+	}
+}
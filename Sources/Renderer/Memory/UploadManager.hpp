@@ -0,0 +1,102 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Renderer/Buffers/Buffer.hpp"
+#include "RingAllocator.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Batches buffer and image uploads into one submission per frame instead of a blocking submit per copy. Data is copied
+	/// into a persistent staging ring when an upload is requested, so the caller can free it straight away. Copies run on
+	/// the dedicated transfer queue when the device has one, mipmaps are then generated on the graphics queue.
+	/// </summary>
+	class ACID_EXPORT UploadManager
+	{
+	public:
+		static const VkDeviceSize STAGING_SIZE;
+	private:
+		/// <summary>
+		/// The uploads recorded between two updates and the objects needed to know when the GPU has finished them.
+		/// </summary>
+		struct Submission
+		{
+			VkCommandBuffer m_transferCommands;
+			VkCommandBuffer m_graphicsCommands;
+			VkFence m_transferFence;
+			VkFence m_graphicsFence;
+			VkSemaphore m_semaphore;
+			bool m_transferUsed;
+			bool m_graphicsUsed;
+			VkDeviceSize m_stagingHead;
+			std::vector<std::unique_ptr<Buffer>> m_stagingBuffers;
+			std::vector<std::function<void()>> m_callbacks;
+		};
+
+		bool m_dedicatedTransfer;
+		VkCommandPool m_transferPool;
+		VkCommandPool m_graphicsPool;
+		VkDeviceSize m_stagingAlignment;
+		std::unique_ptr<Buffer> m_stagingBuffer;
+		RingAllocator m_stagingRing;
+		std::unique_ptr<Submission> m_recording;
+		std::vector<std::unique_ptr<Submission>> m_pending;
+		std::vector<std::unique_ptr<Submission>> m_free;
+		std::mutex m_mutex;
+	public:
+		UploadManager();
+
+		~UploadManager();
+
+		/// <summary>
+		/// Queues a copy of data into a buffer, the buffer must have been created with a transfer destination usage.
+		/// </summary>
+		/// <param name="data"> The data to copy, it is staged before this returns. </param>
+		/// <param name="size"> The size of the data. </param>
+		/// <param name="buffer"> The buffer to copy into. </param>
+		/// <param name="offset"> The offset in the buffer to copy to. </param>
+		/// <param name="onComplete"> Called once the GPU has finished the copy. </param>
+		void UploadBuffer(const void *data, const VkDeviceSize &size, const VkBuffer &buffer, const VkDeviceSize &offset = 0, const std::function<void()> &onComplete = nullptr);
+
+		/// <summary>
+		/// Queues a copy of pixels into the first mip level of an image, then generates the other mip levels. The image
+		/// must be in the undefined layout and is left in the shader read only layout.
+		/// </summary>
+		/// <param name="data"> The tightly packed pixels of every layer, they are staged before this returns. </param>
+		/// <param name="size"> The size of the pixels. </param>
+		/// <param name="image"> The image to copy into. </param>
+		/// <param name="width"> The width of the image. </param>
+		/// <param name="height"> The height of the image. </param>
+		/// <param name="mipLevels"> The number of mip levels in the image. </param>
+		/// <param name="layerCount"> The number of layers in the image. </param>
+		/// <param name="onComplete"> Called once the GPU has finished the copy and mipmaps. </param>
+		void UploadImage(const void *data, const VkDeviceSize &size, const VkImage &image, const uint32_t &width, const uint32_t &height,
+			const uint32_t &mipLevels, const uint32_t &layerCount, const std::function<void()> &onComplete = nullptr);
+
+		/// <summary>
+		/// Runs the callbacks of submissions the GPU has finished, and submits the uploads recorded since the last update.
+		/// Called once a frame by the renderer.
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Submits the recorded uploads and blocks until the GPU has finished every upload.
+		/// </summary>
+		void Wait();
+	private:
+		Submission &GetRecording();
+
+		VkCommandBuffer GetCommands(Submission &submission, const bool &graphics);
+
+		VkDeviceSize Stage(Submission &submission, const void *data, const VkDeviceSize &size, VkBuffer &buffer);
+
+		void Submit();
+
+		std::vector<std::function<void()>> Retire(const bool &wait);
+
+		void DestroySubmission(Submission &submission);
+	};
+}
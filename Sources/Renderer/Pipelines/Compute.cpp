@@ -39,7 +39,10 @@ namespace acid
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
-		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+		}
 
 		vkDestroyShaderModule(logicalDevice, m_shaderModule, nullptr);
 
@@ -51,8 +54,13 @@ namespace acid
 
 	void Compute::CmdRender(const CommandBuffer &commandBuffer) const
 	{
-		uint32_t groupCountX = static_cast<uint32_t>(std::ceil(float(m_computeCreate.GetWidth()) / float(m_computeCreate.GetWorkgroupSize())));
-		uint32_t groupCountY = static_cast<uint32_t>(std::ceil(float(m_computeCreate.GetHeight()) / float(m_computeCreate.GetWorkgroupSize())));
+		CmdRender(commandBuffer, m_computeCreate.GetWidth(), m_computeCreate.GetHeight());
+	}
+
+	void Compute::CmdRender(const CommandBuffer &commandBuffer, const uint32_t &width, const uint32_t &height) const
+	{
+		uint32_t groupCountX = static_cast<uint32_t>(std::ceil(float(width) / float(m_computeCreate.GetWorkgroupSize())));
+		uint32_t groupCountY = static_cast<uint32_t>(std::ceil(float(height) / float(m_computeCreate.GetWorkgroupSize())));
 		vkCmdDispatch(commandBuffer.GetCommandBuffer(), groupCountX, groupCountY, 1);
 	}
 
@@ -119,9 +127,12 @@ namespace acid
 
 		std::vector<VkDescriptorPoolSize> poolSizes = std::vector<VkDescriptorPoolSize>();
 
+		// Descriptor handlers allocate a set for each frame in flight.
 		for (auto &type : m_shaderProgram->GetDescriptors())
 		{
-			poolSizes.emplace_back(type.GetPoolSize());
+			auto poolSize = type.GetPoolSize();
+			poolSize.descriptorCount *= Renderer::Get()->GetFramesInFlight();
+			poolSizes.emplace_back(poolSize);
 		}
 
 		VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
@@ -37,12 +37,22 @@ namespace acid
 
 		void CmdRender(const CommandBuffer &commandBuffer) const;
 
+		/// <summary>
+		/// Dispatches enough workgroups to cover a size that is only known when recording.
+		/// </summary>
+		/// <param name="commandBuffer"> The command buffer to record into. </param>
+		/// <param name="width"> The number of invocations wide. </param>
+		/// <param name="height"> The number of invocations high. </param>
+		void CmdRender(const CommandBuffer &commandBuffer, const uint32_t &width, const uint32_t &height) const;
+
 		std::shared_ptr<ShaderProgram> GetShaderProgram() const override { return m_shaderProgram; }
 
 		VkDescriptorSetLayout GetDescriptorSetLayout() const override { return m_descriptorSetLayout; }
 
 		VkDescriptorPool GetDescriptorPool() const override { return m_descriptorPool; }
 
+		bool IsReady() const override { return m_pipeline != VK_NULL_HANDLE; }
+
 		VkPipeline GetPipeline() const override { return m_pipeline; }
 
 		VkPipelineLayout GetPipelineLayout() const override { return m_pipelineLayout; }
@@ -22,6 +22,12 @@ namespace acid
 			vkCmdBindPipeline(commandBuffer.GetCommandBuffer(), GetPipelineBindPoint(), GetPipeline());
 		}
 
+		/// <summary>
+		/// Gets if the pipeline has been built and can be bound, pipelines may be built on the thread pool.
+		/// </summary>
+		/// <returns> If the pipeline is ready. </returns>
+		virtual bool IsReady() const = 0;
+
 		virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const = 0;
 
 		virtual VkDescriptorSetLayout GetDescriptorSetLayout() const = 0;
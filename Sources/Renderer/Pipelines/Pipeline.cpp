@@ -13,7 +13,7 @@ namespace acid
 		VK_DYNAMIC_STATE_LINE_WIDTH
 	};
 
-	Pipeline::Pipeline(const GraphicsStage &graphicsStage, const PipelineCreate &pipelineCreate) :
+	Pipeline::Pipeline(const GraphicsStage &graphicsStage, const PipelineCreate &pipelineCreate, const bool &async) :
 		IPipeline(),
 		m_graphicsStage(graphicsStage),
 		m_pipelineCreate(pipelineCreate),
@@ -32,7 +32,69 @@ namespace acid
 		m_viewportState({}),
 		m_multisampleState({}),
 		m_dynamicState({}),
-		m_tessellationState({})
+		m_tessellationState({}),
+		m_build(JobHandle())
+	{
+		if (async && Engine::Get() != nullptr)
+		{
+			m_build = Engine::Get()->GetThreadPool().Enqueue([this]()
+			{
+				try
+				{
+					Build();
+				}
+				catch (const std::exception &e)
+				{
+					Log::Error("Pipeline '%s' failed to build: %s\n", m_pipelineCreate.GetShaderStages().back().c_str(), e.what());
+				}
+			});
+			return;
+		}
+
+		Build();
+	}
+
+	Pipeline::~Pipeline()
+	{
+		Wait();
+
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+		}
+
+		for (auto &shaderModule : m_modules)
+		{
+			vkDestroyShaderModule(logicalDevice, shaderModule, nullptr);
+		}
+
+		vkDestroyDescriptorSetLayout(logicalDevice, m_descriptorSetLayout, nullptr);
+		vkDestroyDescriptorPool(logicalDevice, m_descriptorPool, nullptr);
+		vkDestroyPipeline(logicalDevice, m_pipeline, nullptr);
+		vkDestroyPipelineLayout(logicalDevice, m_pipelineLayout, nullptr);
+	}
+
+	void Pipeline::Wait() const
+	{
+		if (!m_build.IsComplete())
+		{
+			Engine::Get()->GetThreadPool().Wait(m_build);
+		}
+	}
+
+	std::shared_ptr<DepthStencil> Pipeline::GetDepthStencil(const int32_t &stage) const
+	{
+		return Renderer::Get()->GetRenderStage(stage == -1 ? m_graphicsStage.GetRenderpass() : stage)->GetDepthStencil();
+	}
+
+	std::shared_ptr<Texture> Pipeline::GetTexture(const uint32_t &index, const int32_t &stage) const
+	{
+		return Renderer::Get()->GetRenderStage(stage == -1 ? m_graphicsStage.GetRenderpass() : stage)->GetFramebuffers()->GetAttachment(index);
+	}
+
+	void Pipeline::Build()
 	{
 #if ACID_VERBOSE
 		float debugStart = Engine::Get()->GetTimeMs();
@@ -44,7 +106,7 @@ namespace acid
 		CreatePipelineLayout();
 		CreateAttributes();
 
-		switch (pipelineCreate.GetMode())
+		switch (m_pipelineCreate.GetMode())
 		{
 		case PIPELINE_MODE_POLYGON:
 			CreatePipelinePolygon();
@@ -70,33 +132,6 @@ namespace acid
 #endif
 	}
 
-	Pipeline::~Pipeline()
-	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
-
-		for (auto &shaderModule : m_modules)
-		{
-			vkDestroyShaderModule(logicalDevice, shaderModule, nullptr);
-		}
-
-		vkDestroyDescriptorSetLayout(logicalDevice, m_descriptorSetLayout, nullptr);
-		vkDestroyDescriptorPool(logicalDevice, m_descriptorPool, nullptr);
-		vkDestroyPipeline(logicalDevice, m_pipeline, nullptr);
-		vkDestroyPipelineLayout(logicalDevice, m_pipelineLayout, nullptr);
-	}
-
-	std::shared_ptr<DepthStencil> Pipeline::GetDepthStencil(const int32_t &stage) const
-	{
-		return Renderer::Get()->GetRenderStage(stage == -1 ? m_graphicsStage.GetRenderpass() : stage)->GetDepthStencil();
-	}
-
-	std::shared_ptr<Texture> Pipeline::GetTexture(const uint32_t &index, const int32_t &stage) const
-	{
-		return Renderer::Get()->GetRenderStage(stage == -1 ? m_graphicsStage.GetRenderpass() : stage)->GetFramebuffers()->GetAttachment(index);
-	}
-
 	void Pipeline::CreateShaderProgram()
 	{
 		std::stringstream defineBlock;
@@ -166,9 +201,12 @@ namespace acid
 
 		std::vector<VkDescriptorPoolSize> poolSizes = std::vector<VkDescriptorPoolSize>();
 
+		// Descriptor handlers allocate a set for each frame in flight.
 		for (auto &type : m_shaderProgram->GetDescriptors())
 		{
-			poolSizes.emplace_back(type.GetPoolSize());
+			auto poolSize = type.GetPoolSize();
+			poolSize.descriptorCount *= Renderer::Get()->GetFramesInFlight();
+			poolSizes.emplace_back(poolSize);
 		}
 
 		VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
@@ -3,6 +3,7 @@
 #include <array>
 #include <string>
 #include <vector>
+#include "Threads/Job.hpp"
 #include "Textures/Texture.hpp"
 #include "PipelineCreate.hpp"
 #include "ShaderProgram.hpp"
@@ -40,16 +41,34 @@ namespace acid
 		VkPipelineMultisampleStateCreateInfo m_multisampleState;
 		VkPipelineDynamicStateCreateInfo m_dynamicState;
 		VkPipelineTessellationStateCreateInfo m_tessellationState;
+
+		JobHandle m_build;
 	public:
 		/// <summary>
 		/// Creates a new pipeline.
 		/// </summary>
 		/// <param name="graphicsStage"> The pipelines graphics stage. </param>
 		/// <param name="pipelineCreate"> The pipelines creation info. </param>
-		Pipeline(const GraphicsStage &graphicsStage, const PipelineCreate &pipelineCreate);
+		/// <param name="async"> If the shaders are compiled and the pipeline is created on the thread pool, the pipeline can not be used until <seealso cref="#IsReady()"/>. </param>
+		Pipeline(const GraphicsStage &graphicsStage, const PipelineCreate &pipelineCreate, const bool &async = false);
+
+		Pipeline(const Pipeline &) = delete;
+
+		Pipeline &operator=(const Pipeline &) = delete;
 
 		~Pipeline();
 
+		/// <summary>
+		/// Gets if the pipeline has been built, a pipeline that failed to build never becomes ready.
+		/// </summary>
+		/// <returns> If the pipeline can be bound. </returns>
+		bool IsReady() const override { return m_build.IsComplete() && m_pipeline != VK_NULL_HANDLE; }
+
+		/// <summary>
+		/// Blocks until the pipeline has been built, pending jobs are run on the calling thread while waiting.
+		/// </summary>
+		void Wait() const;
+
 		PipelineCreate GetPipelineCreate() const { return m_pipelineCreate; }
 
 		std::shared_ptr<ShaderProgram> GetShaderProgram() const override { return m_shaderProgram; }
@@ -70,6 +89,8 @@ namespace acid
 
 		virtual VkPipelineBindPoint GetPipelineBindPoint() const { return VK_PIPELINE_BIND_POINT_GRAPHICS; }
 	private:
+		void Build();
+
 		void CreateShaderProgram();
 
 		void CreateDescriptorLayout();
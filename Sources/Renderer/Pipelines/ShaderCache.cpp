@@ -0,0 +1,249 @@
+#include "ShaderCache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include "Helpers/FileSystem.hpp"
+#include "Helpers/MappedFile.hpp"
+
+namespace acid
+{
+	const std::string ShaderCache::DIRECTORY = "Cache/Shaders";
+
+	static const char CACHE_MAGIC[4] = {'A', 'S', 'P', 'V'};
+
+	/// <summary>
+	/// Must be increased whenever the compile options or the reflection written to entries change.
+	/// </summary>
+	static const uint32_t CACHE_VERSION = 2;
+
+	/// <summary>
+	/// The header at the start of a cache entry. It is followed by the SPIR-V words, the uniform blocks, the uniforms
+	/// and then the vertex attributes. Strings are written as a length followed by their characters.
+	/// </summary>
+	struct CacheHeader
+	{
+		char m_magic[4];
+		uint32_t m_version;
+		uint32_t m_stageFlag;
+		uint32_t m_spirvCount;
+		uint32_t m_uniformBlockCount;
+		uint32_t m_uniformCount;
+		uint32_t m_vertexAttributeCount;
+	};
+
+	static void AppendData(std::vector<char> &data, const void *source, const std::size_t &size)
+	{
+		auto bytes = static_cast<const char *>(source);
+		data.insert(data.end(), bytes, bytes + size);
+	}
+
+	static void AppendInt(std::vector<char> &data, const int32_t &value)
+	{
+		AppendData(data, &value, sizeof(int32_t));
+	}
+
+	static void AppendString(std::vector<char> &data, const std::string &value)
+	{
+		auto size = static_cast<uint32_t>(value.size());
+		AppendData(data, &size, sizeof(uint32_t));
+		AppendData(data, value.data(), value.size());
+	}
+
+	static bool ReadData(const MappedFile &file, std::size_t &offset, void *destination, const std::size_t &size)
+	{
+		if (offset + size > file.GetSize())
+		{
+			return false;
+		}
+
+		memcpy(destination, file.GetData() + offset, size);
+		offset += size;
+		return true;
+	}
+
+	static bool ReadInt(const MappedFile &file, std::size_t &offset, int32_t &value)
+	{
+		return ReadData(file, offset, &value, sizeof(int32_t));
+	}
+
+	static bool ReadString(const MappedFile &file, std::size_t &offset, std::string &value)
+	{
+		uint32_t size = 0;
+
+		if (!ReadData(file, offset, &size, sizeof(uint32_t)) || offset + size > file.GetSize())
+		{
+			return false;
+		}
+
+		value.assign(file.GetData() + offset, size);
+		offset += size;
+		return true;
+	}
+
+	static std::string GetFilename(const std::string &key)
+	{
+		return ShaderCache::DIRECTORY + "/" + key + ".spv";
+	}
+
+	std::string ShaderCache::GetKey(const std::string &shaderCode, const VkShaderStageFlags &stageFlag)
+	{
+		// Two 64 bit FNV-1a hashes with different offset bases, the source size is also part of the key.
+		uint64_t hash0 = 0xcbf29ce484222325;
+		uint64_t hash1 = 0x84222325cbf29ce4;
+
+		for (auto &c : shaderCode)
+		{
+			hash0 = (hash0 ^ static_cast<uint8_t>(c)) * 0x100000001b3;
+			hash1 = (hash1 ^ static_cast<uint8_t>(c)) * 0x100000001b3;
+		}
+
+		char key[64];
+		snprintf(key, sizeof(key), "%016llx%016llx-%llx-%x", static_cast<unsigned long long>(hash0), static_cast<unsigned long long>(hash1),
+			static_cast<unsigned long long>(shaderCode.size()), static_cast<uint32_t>(stageFlag));
+		return key;
+	}
+
+	bool ShaderCache::Load(const std::string &key, ShaderStageData &data)
+	{
+		std::string filename = GetFilename(key);
+
+		if (!FileSystem::FileExists(filename))
+		{
+			return false;
+		}
+
+		MappedFile file = MappedFile(filename);
+
+		if (!file.IsOpen())
+		{
+			return false;
+		}
+
+		CacheHeader header = {};
+		std::size_t offset = 0;
+
+		if (!ReadData(file, offset, &header, sizeof(CacheHeader)) || memcmp(header.m_magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+			header.m_version != CACHE_VERSION)
+		{
+			return false;
+		}
+
+		if (offset + (static_cast<std::size_t>(header.m_spirvCount) * sizeof(uint32_t)) > file.GetSize())
+		{
+			Log::Error("Shader cache entry '%s' is truncated\n", filename.c_str());
+			return false;
+		}
+
+		data.m_stageFlag = header.m_stageFlag;
+		data.m_spirv.resize(header.m_spirvCount);
+		data.m_uniformBlocks.clear();
+		data.m_uniforms.clear();
+		data.m_vertexAttributes.clear();
+		ReadData(file, offset, data.m_spirv.data(), data.m_spirv.size() * sizeof(uint32_t));
+
+		std::string name;
+		int32_t values[4];
+
+		for (uint32_t i = 0; i < header.m_uniformBlockCount; i++)
+		{
+			if (!ReadString(file, offset, name) || !ReadInt(file, offset, values[0]) || !ReadInt(file, offset, values[1]) ||
+				!ReadInt(file, offset, values[2]))
+			{
+				Log::Error("Shader cache entry '%s' is truncated\n", filename.c_str());
+				return false;
+			}
+
+			data.m_uniformBlocks.emplace_back(UniformBlock(name, values[0], values[1], header.m_stageFlag, values[2] != 0));
+		}
+
+		for (uint32_t i = 0; i < header.m_uniformCount; i++)
+		{
+			if (!ReadString(file, offset, name) || !ReadInt(file, offset, values[0]) || !ReadInt(file, offset, values[1]) ||
+				!ReadInt(file, offset, values[2]) || !ReadInt(file, offset, values[3]))
+			{
+				Log::Error("Shader cache entry '%s' is truncated\n", filename.c_str());
+				return false;
+			}
+
+			data.m_uniforms.emplace_back(Uniform(name, values[0], values[1], values[2], values[3], header.m_stageFlag));
+		}
+
+		for (uint32_t i = 0; i < header.m_vertexAttributeCount; i++)
+		{
+			if (!ReadString(file, offset, name) || !ReadInt(file, offset, values[0]) || !ReadInt(file, offset, values[1]) ||
+				!ReadInt(file, offset, values[2]))
+			{
+				Log::Error("Shader cache entry '%s' is truncated\n", filename.c_str());
+				return false;
+			}
+
+			data.m_vertexAttributes.emplace_back(VertexAttribute(name, values[0], values[1], values[2]));
+		}
+
+		return true;
+	}
+
+	bool ShaderCache::Save(const std::string &key, const ShaderStageData &data)
+	{
+		FileSystem::CreateFolder(DIRECTORY);
+
+		CacheHeader header = {};
+		memcpy(header.m_magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+		header.m_version = CACHE_VERSION;
+		header.m_stageFlag = data.m_stageFlag;
+		header.m_spirvCount = static_cast<uint32_t>(data.m_spirv.size());
+		header.m_uniformBlockCount = static_cast<uint32_t>(data.m_uniformBlocks.size());
+		header.m_uniformCount = static_cast<uint32_t>(data.m_uniforms.size());
+		header.m_vertexAttributeCount = static_cast<uint32_t>(data.m_vertexAttributes.size());
+
+		std::vector<char> result = {};
+		result.reserve(sizeof(CacheHeader) + (data.m_spirv.size() * sizeof(uint32_t)));
+		AppendData(result, &header, sizeof(CacheHeader));
+		AppendData(result, data.m_spirv.data(), data.m_spirv.size() * sizeof(uint32_t));
+
+		for (auto &uniformBlock : data.m_uniformBlocks)
+		{
+			AppendString(result, uniformBlock.GetName());
+			AppendInt(result, uniformBlock.GetBinding());
+			AppendInt(result, uniformBlock.GetSize());
+			AppendInt(result, static_cast<int32_t>(uniformBlock.IsStorage()));
+		}
+
+		for (auto &uniform : data.m_uniforms)
+		{
+			AppendString(result, uniform.GetName());
+			AppendInt(result, uniform.GetBinding());
+			AppendInt(result, uniform.GetOffset());
+			AppendInt(result, uniform.GetSize());
+			AppendInt(result, uniform.GetGlType());
+		}
+
+		for (auto &vertexAttribute : data.m_vertexAttributes)
+		{
+			AppendString(result, vertexAttribute.GetName());
+			AppendInt(result, vertexAttribute.GetLocation());
+			AppendInt(result, vertexAttribute.GetSize());
+			AppendInt(result, vertexAttribute.GetGlType());
+		}
+
+		std::string filename = GetFilename(key);
+		std::string temporary = filename + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+		if (!FileSystem::WriteBinaryFile<char>(temporary, result))
+		{
+			return false;
+		}
+
+		// Replaces a stale entry in one step, the same way the pipeline cache is saved. Renaming can still fail if the
+		// entry is mapped for reading, the entry that is there is then kept.
+		if (!FileSystem::RenameFile(temporary, filename))
+		{
+			std::remove(temporary.c_str());
+			return false;
+		}
+
+		return true;
+	}
+}
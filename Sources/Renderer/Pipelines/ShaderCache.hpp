@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ShaderProgram.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// The SPIR-V of one compiled shader stage with the reflection glslang found in it. Uniforms keep their full names,
+	/// members of uniform blocks are named 'Block.member' and have no binding.
+	/// </summary>
+	struct ACID_EXPORT ShaderStageData
+	{
+		VkShaderStageFlags m_stageFlag;
+		std::vector<uint32_t> m_spirv;
+		std::vector<UniformBlock> m_uniformBlocks;
+		std::vector<Uniform> m_uniforms;
+		std::vector<VertexAttribute> m_vertexAttributes;
+	};
+
+	/// <summary>
+	/// A content addressed disk cache of compiled shader stages. Entries are keyed on the preprocessed source, which already
+	/// holds the define block and includes, and the stage so a warm start never runs glslang.
+	/// </summary>
+	class ACID_EXPORT ShaderCache
+	{
+	public:
+		static const std::string DIRECTORY;
+
+		/// <summary>
+		/// Gets the cache key of a shader stage.
+		/// </summary>
+		/// <param name="shaderCode"> The preprocessed shader source. </param>
+		/// <param name="stageFlag"> The shader stage. </param>
+		/// <returns> The key, usable as a filename. </returns>
+		static std::string GetKey(const std::string &shaderCode, const VkShaderStageFlags &stageFlag);
+
+		/// <summary>
+		/// Loads a cached shader stage.
+		/// </summary>
+		/// <param name="key"> The cache key. </param>
+		/// <param name="data"> The stage data to fill. </param>
+		/// <returns> If the stage was in the cache and could be read. </returns>
+		static bool Load(const std::string &key, ShaderStageData &data);
+
+		/// <summary>
+		/// Saves a shader stage to the cache, the file is written under a temporary name and then renamed so other threads
+		/// and processes never read a partial entry.
+		/// </summary>
+		/// <param name="key"> The cache key. </param>
+		/// <param name="data"> The stage data. </param>
+		/// <returns> If the stage was written. </returns>
+		static bool Save(const std::string &key, const ShaderStageData &data);
+	};
+}
@@ -4,7 +4,9 @@
 #include "Display/Display.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Helpers/String.hpp"
+#include "Renderer/Buffers/StorageBuffer.hpp"
 #include "Renderer/Buffers/UniformBuffer.hpp"
+#include "ShaderCache.hpp"
 #include "Textures/Cubemap.hpp"
 #include "Textures/Texture.hpp"
 
@@ -76,7 +78,14 @@ namespace acid
 		// Process to descriptors.
 		for (auto &uniformBlock : m_uniformBlocks)
 		{
-			m_descriptors.emplace_back(UniformBuffer::CreateDescriptor(static_cast<uint32_t>(uniformBlock->GetBinding()), uniformBlock->GetStageFlags()));
+			if (uniformBlock->IsStorage())
+			{
+				m_descriptors.emplace_back(StorageBuffer::CreateDescriptor(static_cast<uint32_t>(uniformBlock->GetBinding()), uniformBlock->GetStageFlags()));
+			}
+			else
+			{
+				m_descriptors.emplace_back(UniformBuffer::CreateDescriptor(static_cast<uint32_t>(uniformBlock->GetBinding()), uniformBlock->GetStageFlags()));
+			}
 		}
 
 		for (auto &uniform : m_uniforms)
@@ -357,10 +366,8 @@ namespace acid
 		return resources;
 	}
 
-	VkShaderModule ShaderProgram::ProcessShader(const std::string &shaderCode, const VkShaderStageFlags &stageFlag)
+	static bool CompileShader(const std::string &shaderCode, const VkShaderStageFlags &stageFlag, ShaderStageData &stageData)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		EShLanguage language = GetEshLanguage(stageFlag);
 
 		// Starts converting GLSL to SPIR-V.
@@ -384,11 +391,14 @@ namespace acid
 	//		Log::Error("SPRIV shader preprocess failed!\n");
 	//	}
 
+		bool compiled = true;
+
 		if (!shader.parse(&resources, 100, false, messages))
 		{
 			Log::Out("%s\n", shader.getInfoLog());
 			Log::Out("%s\n", shader.getInfoDebugLog());
 			Log::Error("SPRIV shader compile failed!\n");
+			compiled = false;
 		}
 
 		program.addShader(&shader);
@@ -396,24 +406,68 @@ namespace acid
 		if (!program.link(messages) || !program.mapIO())
 		{
 			Log::Error("Error while linking shader program.\n");
+			compiled = false;
 		}
 
 		program.buildReflection();
 	//	program.dumpReflection();
-		LoadProgram(program, stageFlag);
 
+		stageData.m_stageFlag = stageFlag;
+
+		for (int32_t i = program.getNumLiveUniformBlocks() - 1; i >= 0; i--)
+		{
+			bool storage = program.getUniformBlockTType(i)->getQualifier().storage == glslang::EvqBuffer;
+			stageData.m_uniformBlocks.emplace_back(UniformBlock(program.getUniformBlockName(i), program.getUniformBlockBinding(i),
+				program.getUniformBlockSize(i), stageFlag, storage));
+		}
+
+		for (int32_t i = 0; i < program.getNumLiveUniformVariables(); i++)
+		{
+			// Only members of uniform blocks have no binding, their size is used to lay out the block.
+			int32_t size = program.getUniformBinding(i) == -1 ? static_cast<int32_t>(sizeof(float)) * program.getUniformTType(i)->computeNumComponents() : -1;
+			stageData.m_uniforms.emplace_back(Uniform(program.getUniformName(i), program.getUniformBinding(i), program.getUniformBufferOffset(i),
+				size, program.getUniformType(i), stageFlag));
+		}
+
+		for (int32_t i = 0; i < program.getNumLiveAttributes(); i++)
+		{
+			stageData.m_vertexAttributes.emplace_back(VertexAttribute(program.getAttributeName(i), program.getAttributeTType(i)->getQualifier().layoutLocation,
+				sizeof(float) * program.getAttributeTType(i)->getVectorSize(), program.getAttributeType(i)));
+		}
+
+		// The optimizer only runs when glslang is built with SPIRV-Tools (ENABLE_OPT).
 		glslang::SpvOptions spvOptions;
-		spvOptions.generateDebugInfo = true;
-		spvOptions.disableOptimizer = true;
+		spvOptions.generateDebugInfo = false;
+		spvOptions.disableOptimizer = false;
 		spvOptions.optimizeSize = false;
 
-		std::vector<uint32_t> spirv = std::vector<uint32_t>();
-		glslang::GlslangToSpv(*program.getIntermediate(language), spirv, &spvOptions);
+		glslang::GlslangToSpv(*program.getIntermediate(language), stageData.m_spirv, &spvOptions);
+		return compiled;
+	}
+
+	VkShaderModule ShaderProgram::ProcessShader(const std::string &shaderCode, const VkShaderStageFlags &stageFlag)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		std::string cacheKey = ShaderCache::GetKey(shaderCode, stageFlag);
+		ShaderStageData stageData = {};
+
+		if (!ShaderCache::Load(cacheKey, stageData))
+		{
+			stageData = {};
+
+			if (CompileShader(shaderCode, stageFlag, stageData))
+			{
+				ShaderCache::Save(cacheKey, stageData);
+			}
+		}
+
+		LoadStage(stageData);
 
 		VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
 		shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		shaderModuleCreateInfo.codeSize = spirv.size() * sizeof(uint32_t);
-		shaderModuleCreateInfo.pCode = spirv.data();
+		shaderModuleCreateInfo.codeSize = stageData.m_spirv.size() * sizeof(uint32_t);
+		shaderModuleCreateInfo.pCode = stageData.m_spirv.data();
 
 		VkShaderModule shaderModule = VK_NULL_HANDLE;
 		Display::CheckVk(vkCreateShaderModule(logicalDevice, &shaderModuleCreateInfo, nullptr, &shaderModule));
@@ -501,43 +555,43 @@ namespace acid
 		return result.str();
 	}
 
-	void ShaderProgram::LoadProgram(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag)
+	void ShaderProgram::LoadStage(const ShaderStageData &stageData)
 	{
-		for (int32_t i = program.getNumLiveUniformBlocks() - 1; i >= 0; i--)
+		for (auto &uniformBlock : stageData.m_uniformBlocks)
 		{
-			LoadUniformBlock(program, stageFlag, i);
+			LoadUniformBlock(uniformBlock, stageData.m_stageFlag);
 		}
 
-		for (int32_t i = 0; i < program.getNumLiveUniformVariables(); i++)
+		for (auto &uniform : stageData.m_uniforms)
 		{
-			LoadUniform(program, stageFlag, i);
+			LoadUniform(uniform, stageData.m_stageFlag);
 		}
 
-		for (int32_t i = 0; i < program.getNumLiveAttributes(); i++)
+		for (auto &vertexAttribute : stageData.m_vertexAttributes)
 		{
-			LoadVertexAttribute(program, stageFlag, i);
+			LoadVertexAttribute(vertexAttribute);
 		}
 	}
 
-	void ShaderProgram::LoadUniformBlock(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i)
+	void ShaderProgram::LoadUniformBlock(const UniformBlock &uniformBlock, const VkShaderStageFlags &stageFlag)
 	{
-		for (auto &uniformBlock : m_uniformBlocks)
+		for (auto &block : m_uniformBlocks)
 		{
-			if (uniformBlock->GetName() == program.getUniformBlockName(i))
+			if (block->GetName() == uniformBlock.GetName())
 			{
-				uniformBlock->SetStageFlags(uniformBlock->GetStageFlags() | stageFlag);
+				block->SetStageFlags(block->GetStageFlags() | stageFlag);
 				return;
 			}
 		}
 
-		m_uniformBlocks.emplace_back(std::make_shared<UniformBlock>(program.getUniformBlockName(i), program.getUniformBlockBinding(i), program.getUniformBlockSize(i), stageFlag));
+		m_uniformBlocks.emplace_back(std::make_shared<UniformBlock>(uniformBlock.GetName(), uniformBlock.GetBinding(), uniformBlock.GetSize(), stageFlag, uniformBlock.IsStorage()));
 	}
 
-	void ShaderProgram::LoadUniform(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i)
+	void ShaderProgram::LoadUniform(const Uniform &uniform, const VkShaderStageFlags &stageFlag)
 	{
-		if (program.getUniformBinding(i) == -1)
+		if (uniform.GetBinding() == -1)
 		{
-			auto splitName = String::Split(program.getUniformName(i), ".");
+			auto splitName = String::Split(uniform.GetName(), ".");
 
 			if (splitName.size() == 2)
 			{
@@ -545,37 +599,36 @@ namespace acid
 				{
 					if (uniformBlock->GetName() == splitName.at(0))
 					{
-						uniformBlock->AddUniform(std::make_shared<Uniform>(splitName.at(1), program.getUniformBinding(i), program.getUniformBufferOffset(i),
-							sizeof(float) * program.getUniformTType(i)->computeNumComponents(), program.getUniformType(i), stageFlag));
+						uniformBlock->AddUniform(std::make_shared<Uniform>(splitName.at(1), uniform.GetBinding(), uniform.GetOffset(),
+							uniform.GetSize(), uniform.GetGlType(), stageFlag));
 						return;
 					}
 				}
 			}
 		}
 
-		for (auto &uniform : m_uniforms)
+		for (auto &u : m_uniforms)
 		{
-			if (uniform->GetName() == program.getUniformName(i))
+			if (u->GetName() == uniform.GetName())
 			{
-				uniform->SetStageFlags(uniform->GetStageFlags() | stageFlag);
+				u->SetStageFlags(u->GetStageFlags() | stageFlag);
 				return;
 			}
 		}
 
-		m_uniforms.emplace_back(std::make_shared<Uniform>(program.getUniformName(i), program.getUniformBinding(i), program.getUniformBufferOffset(i), -1, program.getUniformType(i), stageFlag));
+		m_uniforms.emplace_back(std::make_shared<Uniform>(uniform.GetName(), uniform.GetBinding(), uniform.GetOffset(), -1, uniform.GetGlType(), stageFlag));
 	}
 
-	void ShaderProgram::LoadVertexAttribute(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i)
+	void ShaderProgram::LoadVertexAttribute(const VertexAttribute &vertexAttribute)
 	{
-		for (auto &vertexAttribute : m_vertexAttributes)
+		for (auto &attribute : m_vertexAttributes)
 		{
-			if (vertexAttribute->GetName() == program.getAttributeName(i))
+			if (attribute->GetName() == vertexAttribute.GetName())
 			{
 				return;
 			}
 		}
 
-		m_vertexAttributes.emplace_back(std::make_shared<VertexAttribute>(program.getAttributeName(i), program.getAttributeTType(i)->getQualifier().layoutLocation,
-			sizeof(float) * program.getAttributeTType(i)->getVectorSize(), program.getAttributeType(i)));
+		m_vertexAttributes.emplace_back(std::make_shared<VertexAttribute>(vertexAttribute));
 	}
 }
@@ -8,13 +8,10 @@
 #include <vulkan/vulkan.h>
 #include "PipelineCreate.hpp"
 
-namespace glslang 
-{
-	class TProgram;
-}
-
 namespace acid
 {
+	struct ShaderStageData;
+
 	class ACID_EXPORT Uniform
 	{
 	private:
@@ -78,13 +75,15 @@ namespace acid
 		int32_t m_binding;
 		int32_t m_size;
 		VkShaderStageFlags m_stageFlags;
+		bool m_storage;
 		std::vector<std::shared_ptr<Uniform>> m_uniforms;
 	public:
-		UniformBlock(const std::string &name, const int32_t &binding, const int32_t &size, const VkShaderStageFlags &stageFlags) :
+		UniformBlock(const std::string &name, const int32_t &binding, const int32_t &size, const VkShaderStageFlags &stageFlags, const bool &storage = false) :
 			m_name(name),
 			m_binding(binding),
 			m_size(size),
 			m_stageFlags(stageFlags),
+			m_storage(storage),
 			m_uniforms(std::vector<std::shared_ptr<Uniform>>())
 		{
 		}
@@ -129,12 +128,18 @@ namespace acid
 
 		void SetStageFlags(const VkShaderStageFlags &stageFlags) { m_stageFlags = stageFlags; }
 
+		/// <summary>
+		/// Gets if the block is a shader storage buffer, its size only counts the members before a runtime array.
+		/// </summary>
+		/// <returns> If the block is a storage buffer. </returns>
+		bool IsStorage() const { return m_storage; }
+
 		std::vector<std::shared_ptr<Uniform>> &GetUniforms() { return m_uniforms; }
 
 		std::string ToString() const
 		{
 			std::stringstream result;
-			result << "UniformBlock(name '" << m_name << "', binding " << m_binding << ", size " << m_size << ")";
+			result << "UniformBlock(name '" << m_name << "', binding " << m_binding << ", size " << m_size << ", storage " << m_storage << ")";
 			return result.str();
 		}
 	};
@@ -220,17 +225,24 @@ namespace acid
 
 		static std::string ProcessIncludes(const std::string &shaderCode);
 
+		/// <summary>
+		/// Creates a shader module from preprocessed source and adds the stages reflection to this program. The stage is
+		/// loaded from the <seealso cref="ShaderCache"/> when possible, otherwise it is compiled and the result is cached.
+		/// </summary>
+		/// <param name="shaderCode"> The source with the define block and includes already inserted. </param>
+		/// <param name="stageFlag"> The shader stage. </param>
+		/// <returns> The shader module. </returns>
 		VkShaderModule ProcessShader(const std::string &shaderCode, const VkShaderStageFlags &stageFlag);
 
 		std::string ToString() const;
 
 	private:
-		void LoadProgram(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag);
+		void LoadStage(const ShaderStageData &stageData);
 
-		void LoadUniformBlock(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i);
+		void LoadUniformBlock(const UniformBlock &uniformBlock, const VkShaderStageFlags &stageFlag);
 
-		void LoadUniform(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i);
+		void LoadUniform(const Uniform &uniform, const VkShaderStageFlags &stageFlag);
 
-		void LoadVertexAttribute(const glslang::TProgram &program, const VkShaderStageFlags &stageFlag, const int32_t &i);
+		void LoadVertexAttribute(const VertexAttribute &vertexAttribute);
 	};
 }
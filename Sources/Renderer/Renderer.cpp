@@ -1,25 +1,95 @@
 #include "Renderer.hpp"
 
+#include <cstring>
+#include <iomanip>
 #include "Helpers/FileSystem.hpp"
 #include "Scenes/Scenes.hpp"
 #include "IRenderer.hpp"
 
 namespace acid
 {
+	const uint32_t Renderer::DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+	static const std::string PIPELINE_CACHE_DIRECTORY = "Cache/Pipelines";
+
+	/// <summary>
+	/// The renderer GPU object destruction is queued on, unset while the renderer is torn down as it can no longer be looked up through the engine.
+	/// </summary>
+	static Renderer *RETIRE_RENDERER = nullptr;
+
+	/// <summary>
+	/// The header Vulkan writes at the start of pipeline cache data, see VK_PIPELINE_CACHE_HEADER_VERSION_ONE.
+	/// </summary>
+	struct PipelineCacheHeader
+	{
+		uint32_t m_headerSize;
+		uint32_t m_headerVersion;
+		uint32_t m_vendorId;
+		uint32_t m_deviceId;
+		uint8_t m_pipelineCacheUuid[VK_UUID_SIZE];
+	};
+
+	static std::string GetPipelineCacheFilename()
+	{
+		auto physicalDeviceProperties = Display::Get()->GetPhysicalDeviceProperties();
+		std::stringstream result;
+		result << PIPELINE_CACHE_DIRECTORY << "/" << std::hex;
+
+		for (auto &byte : physicalDeviceProperties.pipelineCacheUUID)
+		{
+			result << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(byte);
+		}
+
+		result << "-" << physicalDeviceProperties.driverVersion << ".bin";
+		return result.str();
+	}
+
+	static bool IsPipelineCacheValid(const std::vector<char> &data)
+	{
+		auto physicalDeviceProperties = Display::Get()->GetPhysicalDeviceProperties();
+		PipelineCacheHeader header = {};
+
+		if (data.size() < sizeof(PipelineCacheHeader))
+		{
+			return false;
+		}
+
+		memcpy(&header, data.data(), sizeof(PipelineCacheHeader));
+		return header.m_headerSize >= sizeof(PipelineCacheHeader) && header.m_headerSize <= data.size() &&
+			header.m_headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.m_vendorId == physicalDeviceProperties.vendorID &&
+			header.m_deviceId == physicalDeviceProperties.deviceID &&
+			memcmp(header.m_pipelineCacheUuid, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+	}
+
 	Renderer::Renderer() :
 		m_managerRender(nullptr),
 		m_renderStages(std::vector<std::shared_ptr<RenderStage>>()),
 		m_swapchain(nullptr),
-		m_fenceSwapchainImage(VK_NULL_HANDLE),
 		m_activeSwapchainImage(UINT32_MAX),
 		m_pipelineCache(VK_NULL_HANDLE),
-		m_semaphore(VK_NULL_HANDLE),
-		m_commandPool(VK_NULL_HANDLE),
-		m_commandBuffer(nullptr)
+		m_pipelineCacheSize(0),
+		m_timerPipelineCache(Timer(30.0f)),
+		m_commandPools(std::map<std::thread::id, VkCommandPool>()),
+		m_framesInFlight(DEFAULT_FRAMES_IN_FLIGHT),
+		m_frameIndex(0),
+		m_commandBuffers(std::vector<std::shared_ptr<CommandBuffer>>()),
+		m_presentCompletes(std::vector<VkSemaphore>()),
+		m_renderCompletes(std::vector<VkSemaphore>()),
+		m_flightFences(std::vector<VkFence>()),
+		m_imagesInFlight(std::vector<VkFence>()),
+		m_parallelRecording(true),
+		m_activeStage(0),
+		m_activeSubpass(0),
+		m_secondaryCommandBuffers(std::vector<std::map<std::thread::id, SecondaryCommandBuffers>>()),
+		m_uploadManager(nullptr),
+		m_uniformRing(nullptr),
+		m_deletionQueues(std::vector<std::vector<std::function<void()>>>(DEFAULT_FRAMES_IN_FLIGHT))
 	{
-		CreateFences();
-		CreateCommandPool();
+		CreateFrames();
 		CreatePipelineCache();
+		m_uploadManager = std::make_unique<UploadManager>();
+		m_uniformRing = std::make_unique<UniformRing>(m_framesInFlight);
+		RETIRE_RENDERER = this;
 	}
 
 	Renderer::~Renderer()
@@ -27,7 +97,21 @@ namespace acid
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
 
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		}
+
+		// Nothing is in flight anymore, objects destroyed from here on are destroyed straight away.
+		RETIRE_RENDERER = nullptr;
+
+		for (uint32_t i = 0; i < m_deletionQueues.size(); i++)
+		{
+			RunDeletions(i);
+		}
+
+		m_uploadManager = nullptr;
+		m_uniformRing = nullptr;
 
 		delete m_managerRender;
 
@@ -39,26 +123,70 @@ namespace acid
 	//	delete m_swapchain;
 	//	delete m_commandBuffer;
 
+		SavePipelineCache();
 		vkDestroyPipelineCache(logicalDevice, m_pipelineCache, nullptr);
 
-		vkDestroyFence(logicalDevice, m_fenceSwapchainImage, nullptr);
-		vkDestroySemaphore(logicalDevice, m_semaphore, nullptr);
-		vkDestroyCommandPool(logicalDevice, m_commandPool, nullptr);
+		DestroyFrames();
+
+		for (auto &commandPool : m_commandPools)
+		{
+			vkDestroyCommandPool(logicalDevice, commandPool.second, nullptr);
+		}
 	}
 
 	void Renderer::Update()
 	{
+		m_uploadManager->Update();
+
 		if (Display::Get()->IsIconified())
 		{
 			return;
 		}
 
+		// Waits for the GPU to finish the last frame that used this frames command buffer and uniform copies.
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		Display::CheckVk(vkWaitForFences(logicalDevice, 1, &m_flightFences[m_frameIndex], VK_TRUE, std::numeric_limits<uint64_t>::max()));
+
+		RunDeletions(m_frameIndex);
+
+		for (auto &secondaryCommandBuffers : m_secondaryCommandBuffers[m_frameIndex])
+		{
+			secondaryCommandBuffers.second.m_used = 0;
+		}
+
+		m_uniformRing->BeginFrame(m_frameIndex, m_framesInFlight);
+
 		m_managerRender->Update();
 
+		if (m_timerPipelineCache.IsPassedTime())
+		{
+			m_timerPipelineCache.ResetStartTime();
+			SavePipelineCache();
+		}
+
 		auto camera = Scenes::Get()->GetCamera();
 		auto stages = m_managerRender->GetStages();
 		Vector4 clipPlane = Vector4(0.0f, 1.0f, 0.0f, +std::numeric_limits<float>::infinity());
 
+		// Compute work is recorded before the first render pass, dispatches cannot be recorded inside one.
+		auto &commandBuffer = m_commandBuffers[m_frameIndex];
+
+		if (!commandBuffer->IsRunning())
+		{
+			commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+		}
+
+		for (auto &stage : stages)
+		{
+			for (auto &renderer : stage.second)
+			{
+				if (renderer->IsEnabled())
+				{
+					renderer->RenderCompute(*commandBuffer, *camera);
+				}
+			}
+		}
+
 		for (uint32_t stage = 0; stage < m_renderStages.size(); stage++)
 		{
 			// Starts Rendering.
@@ -79,15 +207,7 @@ namespace acid
 
 				if (renderers != stages.end())
 				{
-					for (auto &renderer : (*renderers).second)
-					{
-						if (!renderer->IsEnabled())
-						{
-							continue;
-						}
-
-						renderer->Render(*m_commandBuffer, clipPlane, *camera);
-					}
+					RenderSubpass((*renderers).second, clipPlane, *camera);
 				}
 
 				if (subpass != subpassCount - 1)
@@ -101,6 +221,50 @@ namespace acid
 		}
 	}
 
+	std::shared_ptr<CommandBuffer> Renderer::BeginSecondary()
+	{
+		auto renderStage = GetRenderStage(m_activeStage);
+
+		std::unique_lock<std::mutex> lock(m_secondaryMutex);
+		auto &secondaryCommandBuffers = m_secondaryCommandBuffers[m_frameIndex][std::this_thread::get_id()];
+		lock.unlock();
+
+		// Secondary buffers are allocated from the calling threads pool, so only that thread touches them.
+		if (secondaryCommandBuffers.m_used == secondaryCommandBuffers.m_commandBuffers.size())
+		{
+			secondaryCommandBuffers.m_commandBuffers.emplace_back(std::make_shared<CommandBuffer>(false, VK_QUEUE_GRAPHICS_BIT, VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+		}
+
+		auto commandBuffer = secondaryCommandBuffers.m_commandBuffers[secondaryCommandBuffers.m_used++];
+
+		VkCommandBufferInheritanceInfo inheritanceInfo = {};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.renderPass = renderStage->GetRenderpass()->GetRenderpass();
+		inheritanceInfo.subpass = m_activeSubpass;
+		inheritanceInfo.framebuffer = renderStage->GetActiveFramebuffer(m_activeSwapchainImage);
+
+		commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &inheritanceInfo);
+
+		// Dynamic state is not inherited from the primary command buffer.
+		VkViewport viewport = {};
+		viewport.x = 0.0f;
+		viewport.y = 0.0f;
+		viewport.width = static_cast<float>(renderStage->GetWidth());
+		viewport.height = static_cast<float>(renderStage->GetHeight());
+		viewport.minDepth = 0.0f;
+		viewport.maxDepth = 1.0f;
+		vkCmdSetViewport(commandBuffer->GetCommandBuffer(), 0, 1, &viewport);
+
+		VkRect2D scissor = {};
+		scissor.offset.x = 0;
+		scissor.offset.y = 0;
+		scissor.extent.width = renderStage->GetWidth();
+		scissor.extent.height = renderStage->GetHeight();
+		vkCmdSetScissor(commandBuffer->GetCommandBuffer(), 0, 1, &scissor);
+
+		return commandBuffer;
+	}
+
 	void Renderer::CreateRenderpass(const std::vector<RenderpassCreate> &renderpassCreates)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
@@ -129,6 +293,29 @@ namespace acid
 #endif
 	}
 
+	VkCommandPool Renderer::GetCommandPool(const std::thread::id &threadId)
+	{
+		std::lock_guard<std::mutex> lock(m_commandPoolMutex);
+		auto it = m_commandPools.find(threadId);
+
+		if (it != m_commandPools.end())
+		{
+			return (*it).second;
+		}
+
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		commandPoolCreateInfo.queueFamilyIndex = Display::Get()->GetGraphicsFamily();
+		commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+		VkCommandPool commandPool = VK_NULL_HANDLE;
+		Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &commandPool));
+		m_commandPools.emplace(threadId, commandPool);
+		return commandPool;
+	}
+
 	void Renderer::CaptureScreenshot(const std::string &filename)
 	{
 #if ACID_VERBOSE
@@ -144,7 +331,7 @@ namespace acid
 
 		VkImage srcImage = Renderer::Get()->GetSwapchain()->GetImages().at(Renderer::Get()->GetActiveSwapchainImage());
 		VkImage dstImage;
-		VkDeviceMemory dstImageMemory;
+		MemoryAllocation dstImageMemory;
 		bool supportsBlit = Texture::CopyImage(srcImage, dstImage, dstImageMemory, width, height, true);
 
 		// Get layout of the image (including row pitch).
@@ -157,10 +344,8 @@ namespace acid
 		// Creates the screenshot image file.
 		FileSystem::CreateFile(filename);
 
-		// Map image memory so we can start copying from it.
-		char *data;
-		vkMapMemory(logicalDevice, dstImageMemory, 0, VK_WHOLE_SIZE, 0, (void **) &data);
-		data += subResourceLayout.offset;
+		// The image memory is persistently mapped, so we can start copying from it.
+		char *data = static_cast<char *>(dstImageMemory.m_mapped) + subResourceLayout.offset;
 
 		// If source is BGR (destination is always RGB) and we can't use blit (which does automatic conversion), we'll have to manually swizzle color components
 		bool colourSwizzle = false;
@@ -178,9 +363,8 @@ namespace acid
 		Texture::WritePixels(filename, data, width, height, 4);
 
 		// Clean up resources.
-		vkUnmapMemory(logicalDevice, dstImageMemory);
-		vkFreeMemory(logicalDevice, dstImageMemory, nullptr);
 		vkDestroyImage(logicalDevice, dstImage, nullptr);
+		Display::Get()->GetMemoryAllocator().Free(dstImageMemory);
 
 #if ACID_VERBOSE
 		float debugEnd = Engine::Get()->GetTimeMs();
@@ -188,42 +372,184 @@ namespace acid
 #endif
 	}
 
-	void Renderer::CreateFences()
+	void Renderer::SetFramesInFlight(const uint32_t &framesInFlight)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
-		VkFenceCreateInfo fenceCreateInfo = {};
-		fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-		vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_fenceSwapchainImage);
+		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+
+		DestroyFrames();
+
+		// The GPU is idle, everything queued so far can be destroyed before the queues are laid out for the new frame count.
+		std::vector<std::function<void()>> deletions;
+
+		{
+			std::lock_guard<std::mutex> lock(m_deletionMutex);
+
+			for (auto &deletionQueue : m_deletionQueues)
+			{
+				for (auto &deletion : deletionQueue)
+				{
+					deletions.emplace_back(std::move(deletion));
+				}
+			}
+
+			m_framesInFlight = std::max(framesInFlight, 1u);
+			m_frameIndex = 0;
+			m_deletionQueues = std::vector<std::vector<std::function<void()>>>(m_framesInFlight);
+		}
+
+		for (auto &deletion : deletions)
+		{
+			deletion();
+		}
+
+		CreateFrames();
 	}
 
-	void Renderer::CreateCommandPool()
+	void Renderer::CreateFrames()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkSemaphoreCreateInfo semaphoreCreateInfo = {};
 		semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-		Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_semaphore));
+		// Fences start signalled, the first wait on each frame returns straight away.
+		VkFenceCreateInfo fenceCreateInfo = {};
+		fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
-		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		commandPoolCreateInfo.queueFamilyIndex = Display::Get()->GetGraphicsFamily();
-		commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+		m_commandBuffers.resize(m_framesInFlight);
+		m_presentCompletes.resize(m_framesInFlight);
+		m_renderCompletes.resize(m_framesInFlight);
+		m_flightFences.resize(m_framesInFlight);
 
-		Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &m_commandPool));
+		for (uint32_t i = 0; i < m_framesInFlight; i++)
+		{
+			Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_presentCompletes[i]));
+			Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_renderCompletes[i]));
+			Display::CheckVk(vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_flightFences[i]));
+			m_commandBuffers[i] = std::make_shared<CommandBuffer>(false);
+		}
 
-		m_commandBuffer = std::make_shared<CommandBuffer>(false);
+		m_imagesInFlight.clear();
+		m_secondaryCommandBuffers.resize(m_framesInFlight);
+	}
+
+	void Renderer::DestroyFrames()
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		for (uint32_t i = 0; i < m_flightFences.size(); i++)
+		{
+			vkDestroySemaphore(logicalDevice, m_presentCompletes[i], nullptr);
+			vkDestroySemaphore(logicalDevice, m_renderCompletes[i], nullptr);
+			vkDestroyFence(logicalDevice, m_flightFences[i], nullptr);
+		}
+
+		m_commandBuffers.clear();
+		m_presentCompletes.clear();
+		m_renderCompletes.clear();
+		m_flightFences.clear();
+		m_imagesInFlight.clear();
+		m_secondaryCommandBuffers.clear();
+	}
+
+	void Renderer::Retire(std::function<void()> &&destroy)
+	{
+		auto renderer = RETIRE_RENDERER;
+
+		if (renderer == nullptr)
+		{
+			destroy();
+			return;
+		}
+
+		// Queued on the frame being recorded, its fence is next waited on once every frame that could have used the object has finished.
+		std::lock_guard<std::mutex> lock(renderer->m_deletionMutex);
+		renderer->m_deletionQueues[renderer->m_frameIndex].emplace_back(std::move(destroy));
+	}
+
+	void Renderer::RunDeletions(const uint32_t &frameIndex)
+	{
+		std::vector<std::function<void()>> deletions;
+
+		{
+			std::lock_guard<std::mutex> lock(m_deletionMutex);
+			deletions.swap(m_deletionQueues[frameIndex]);
+		}
+
+		for (auto &deletion : deletions)
+		{
+			deletion();
+		}
+	}
+
+	void Renderer::SavePipelineCache()
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		// The size grows as pipelines are added, so a unchanged size means there is nothing new to write.
+		std::size_t dataSize = 0;
+		Display::CheckVk(vkGetPipelineCacheData(logicalDevice, m_pipelineCache, &dataSize, nullptr));
+
+		if (dataSize == 0 || dataSize == m_pipelineCacheSize)
+		{
+			return;
+		}
+
+		std::vector<char> data(dataSize);
+		Display::CheckVk(vkGetPipelineCacheData(logicalDevice, m_pipelineCache, &dataSize, data.data()));
+		data.resize(dataSize);
+
+		std::string filename = GetPipelineCacheFilename();
+		std::string temporary = filename + ".tmp";
+		FileSystem::CreateFolder(PIPELINE_CACHE_DIRECTORY);
+
+		if (!FileSystem::WriteBinaryFile<char>(temporary, data))
+		{
+			return;
+		}
+
+		// The old cache is replaced in one step, a crash leaves either the old or the new file.
+		if (!FileSystem::RenameFile(temporary, filename))
+		{
+			Log::Error("Could not save pipeline cache: '%s'\n", filename.c_str());
+			std::remove(temporary.c_str());
+			return;
+		}
+
+		m_pipelineCacheSize = dataSize;
 	}
 
 	void Renderer::CreatePipelineCache()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
+		std::string filename = GetPipelineCacheFilename();
+		std::vector<char> data = {};
+
+		if (FileSystem::FileExists(filename))
+		{
+			auto fileLoaded = FileSystem::ReadBinaryFile<char>(filename);
+
+			if (fileLoaded && IsPipelineCacheValid(*fileLoaded))
+			{
+				data = *fileLoaded;
+			}
+			else
+			{
+				Log::Out("Pipeline cache '%s' does not match this device, it will be rebuilt\n", filename.c_str());
+			}
+		}
+
 		VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
 		pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		pipelineCacheCreateInfo.initialDataSize = data.size();
+		pipelineCacheCreateInfo.pInitialData = data.data();
 
 		Display::CheckVk(vkCreatePipelineCache(logicalDevice, &pipelineCacheCreateInfo, nullptr, &m_pipelineCache));
+		m_pipelineCacheSize = data.size();
 	}
 
 	void Renderer::RecreatePass(const uint32_t &i)
@@ -233,7 +559,10 @@ namespace acid
 
 		VkExtent2D displayExtent = {Display::Get()->GetWidth(), Display::Get()->GetHeight()};
 
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		}
 
 		if (renderStage->HasSwapchain() && !m_swapchain->IsSameExtent(displayExtent))
 		{
@@ -241,6 +570,7 @@ namespace acid
 			Log::Out("Resizing swapchain: Old (%i, %i), New (%i, %i)\n", m_swapchain->GetExtent().width, m_swapchain->GetExtent().height, displayExtent.width, displayExtent.height);
 #endif
 			m_swapchain = std::make_shared<Swapchain>(displayExtent);
+			m_imagesInFlight.clear();
 		}
 
 		renderStage->Rebuild(*m_swapchain);
@@ -257,13 +587,11 @@ namespace acid
 		}
 
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
-
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		auto &commandBuffer = m_commandBuffers[m_frameIndex];
 
 		if (renderStage->HasSwapchain())
 		{
-			VkResult acquireResult = vkAcquireNextImageKHR(logicalDevice, *m_swapchain->GetSwapchain(), std::numeric_limits<uint64_t>::max(), VK_NULL_HANDLE, m_fenceSwapchainImage, &m_activeSwapchainImage);
+			VkResult acquireResult = vkAcquireNextImageKHR(logicalDevice, *m_swapchain->GetSwapchain(), std::numeric_limits<uint64_t>::max(), m_presentCompletes[m_frameIndex], VK_NULL_HANDLE, &m_activeSwapchainImage);
 
 			if (acquireResult == VK_ERROR_OUT_OF_DATE_KHR)
 			{
@@ -276,14 +604,21 @@ namespace acid
 				throw std::runtime_error("Renderer failed to acquire swapchain image!");
 			}
 
-			Display::CheckVk(vkWaitForFences(logicalDevice, 1, &m_fenceSwapchainImage, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			// Swapchain images can be handed out of order, waits for an older frame still rendering to this image.
+			m_imagesInFlight.resize(m_swapchain->GetImageCount(), VK_NULL_HANDLE);
+			VkFence &imageInFlight = m_imagesInFlight[m_activeSwapchainImage];
 
-			Display::CheckVk(vkResetFences(logicalDevice, 1, &m_fenceSwapchainImage));
+			if (imageInFlight != VK_NULL_HANDLE && imageInFlight != m_flightFences[m_frameIndex])
+			{
+				Display::CheckVk(vkWaitForFences(logicalDevice, 1, &imageInFlight, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			}
+
+			imageInFlight = m_flightFences[m_frameIndex];
 		}
 
-		if (!m_commandBuffer->IsRunning())
+		if (!commandBuffer->IsRunning())
 		{
-			m_commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+			commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
 		}
 
 		VkRect2D renderArea = {};
@@ -302,8 +637,7 @@ namespace acid
 		renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
 		renderPassBeginInfo.pClearValues = clearValues.data();
 
-		vkCmdBeginRenderPass(m_commandBuffer->GetCommandBuffer(), &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-
+		// Inside a render pass with secondary contents only vkCmdExecuteCommands may be recorded, so dynamic state is set first.
 		VkViewport viewport = {};
 		viewport.x = 0.0f;
 		viewport.y = 0.0f;
@@ -311,15 +645,18 @@ namespace acid
 		viewport.height = static_cast<float>(renderStage->GetHeight());
 		viewport.minDepth = 0.0f;
 		viewport.maxDepth = 1.0f;
-		vkCmdSetViewport(m_commandBuffer->GetCommandBuffer(), 0, 1, &viewport);
+		vkCmdSetViewport(commandBuffer->GetCommandBuffer(), 0, 1, &viewport);
 
 		VkRect2D scissor = {};
 		scissor.offset.x = 0;
 		scissor.offset.y = 0;
 		scissor.extent.width = renderStage->GetWidth();
 		scissor.extent.height = renderStage->GetHeight();
-		vkCmdSetScissor(m_commandBuffer->GetCommandBuffer(), 0, 1, &scissor);
+		vkCmdSetScissor(commandBuffer->GetCommandBuffer(), 0, 1, &scissor);
 
+		vkCmdBeginRenderPass(commandBuffer->GetCommandBuffer(), &renderPassBeginInfo, GetSubpassContents());
+		m_activeStage = i;
+		m_activeSubpass = 0;
 		return true;
 	}
 
@@ -327,20 +664,19 @@ namespace acid
 	{
 		auto renderStage = GetRenderStage(i);
 		auto presentQueue = Display::Get()->GetPresentQueue();
+		auto &commandBuffer = m_commandBuffers[m_frameIndex];
 
-		vkCmdEndRenderPass(m_commandBuffer->GetCommandBuffer());
+		vkCmdEndRenderPass(commandBuffer->GetCommandBuffer());
 
 		if (!renderStage->HasSwapchain())
 		{
 			return;
 		}
 
-		m_commandBuffer->End();
-		m_commandBuffer->Submit(m_semaphore, VK_NULL_HANDLE, false);
-
-	//	Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		commandBuffer->End();
+		commandBuffer->Submit(m_presentCompletes[m_frameIndex], m_renderCompletes[m_frameIndex], m_flightFences[m_frameIndex]);
 
-		std::vector<VkSemaphore> waitSemaphores = {m_semaphore};
+		std::vector<VkSemaphore> waitSemaphores = {m_renderCompletes[m_frameIndex]};
 
 		VkResult presentResult = VK_RESULT_MAX_ENUM;
 
@@ -353,7 +689,15 @@ namespace acid
 		presentInfo.pImageIndices = &m_activeSwapchainImage;
 		presentInfo.pResults = &presentResult;
 
+		std::unique_lock<std::mutex> lock(Display::Get()->GetQueueMutex());
 		const VkResult queuePresentResult = vkQueuePresentKHR(presentQueue, &presentInfo);
+		lock.unlock();
+
+		// The next frame records into the next set of resources while the GPU works on this one.
+		{
+			std::lock_guard<std::mutex> deletionLock(m_deletionMutex);
+			m_frameIndex = (m_frameIndex + 1) % m_framesInFlight;
+		}
 
 		if (queuePresentResult == VK_ERROR_OUT_OF_DATE_KHR || queuePresentResult == VK_SUBOPTIMAL_KHR)
 		{
@@ -362,11 +706,62 @@ namespace acid
 		}
 
 		Display::CheckVk(presentResult);
-		Display::CheckVk(vkQueueWaitIdle(presentQueue));
 	}
 
 	void Renderer::NextSubpass()
 	{
-		vkCmdNextSubpass(m_commandBuffer->GetCommandBuffer(), VK_SUBPASS_CONTENTS_INLINE);
+		vkCmdNextSubpass(m_commandBuffers[m_frameIndex]->GetCommandBuffer(), GetSubpassContents());
+		m_activeSubpass++;
+	}
+
+	void Renderer::RenderSubpass(const std::vector<std::shared_ptr<IRenderer>> &renderers, const Vector4 &clipPlane, const ICamera &camera)
+	{
+		std::vector<std::shared_ptr<IRenderer>> enabled = {};
+
+		for (auto &renderer : renderers)
+		{
+			if (renderer->IsEnabled())
+			{
+				enabled.emplace_back(renderer);
+			}
+		}
+
+		if (!m_parallelRecording)
+		{
+			for (auto &renderer : enabled)
+			{
+				renderer->Render(*m_commandBuffers[m_frameIndex], clipPlane, camera);
+			}
+
+			return;
+		}
+
+		// Each renderer records into its own secondary command buffers on the job system, they are executed in order.
+		std::vector<std::vector<std::shared_ptr<CommandBuffer>>> recorded(enabled.size());
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		auto handle = threadPool.ParallelFor(0, static_cast<uint32_t>(enabled.size()), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				recorded[i] = enabled[i]->RenderSecondary(clipPlane, camera);
+			}
+		}, 1);
+		threadPool.Wait(handle);
+
+		std::vector<VkCommandBuffer> commandBuffers = {};
+
+		for (auto &secondaries : recorded)
+		{
+			for (auto &secondary : secondaries)
+			{
+				commandBuffers.emplace_back(secondary->GetCommandBuffer());
+			}
+		}
+
+		if (!commandBuffers.empty())
+		{
+			vkCmdExecuteCommands(m_commandBuffers[m_frameIndex]->GetCommandBuffer(), static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
+		}
 	}
 }
@@ -1,8 +1,15 @@
 #pragma once
 
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vulkan/vulkan.h>
+#include "Renderer/Buffers/UniformRing.hpp"
 #include "Renderer/Commands/CommandBuffer.hpp"
 #include "Engine/Engine.hpp"
+#include "Maths/Timer.hpp"
+#include "Memory/UploadManager.hpp"
 #include "Swapchain/DepthStencil.hpp"
 #include "Swapchain/Swapchain.hpp"
 #include "IManagerRender.hpp"
@@ -10,24 +17,57 @@
 
 namespace acid
 {
+	class ICamera;
+	class Vector4;
+
 	class ACID_EXPORT Renderer :
 		public IModule
 	{
+	public:
+		static const uint32_t DEFAULT_FRAMES_IN_FLIGHT;
 	private:
+		/// <summary>
+		/// The secondary command buffers a thread allocated for a frame, reused each time the frame comes around.
+		/// </summary>
+		struct SecondaryCommandBuffers
+		{
+			std::vector<std::shared_ptr<CommandBuffer>> m_commandBuffers;
+			uint32_t m_used;
+		};
+
 		IManagerRender *m_managerRender;
 
 		std::vector<std::shared_ptr<RenderStage>> m_renderStages;
 
 		std::shared_ptr<Swapchain> m_swapchain;
-		VkFence m_fenceSwapchainImage;
 		uint32_t m_activeSwapchainImage;
 
 		VkPipelineCache m_pipelineCache;
-
-		VkSemaphore m_semaphore;
-		VkCommandPool m_commandPool;
-
-		std::shared_ptr<CommandBuffer> m_commandBuffer;
+		std::size_t m_pipelineCacheSize;
+		Timer m_timerPipelineCache;
+
+		std::map<std::thread::id, VkCommandPool> m_commandPools;
+		std::mutex m_commandPoolMutex;
+
+		uint32_t m_framesInFlight;
+		uint32_t m_frameIndex;
+		std::vector<std::shared_ptr<CommandBuffer>> m_commandBuffers;
+		std::vector<VkSemaphore> m_presentCompletes;
+		std::vector<VkSemaphore> m_renderCompletes;
+		std::vector<VkFence> m_flightFences;
+		std::vector<VkFence> m_imagesInFlight;
+
+		bool m_parallelRecording;
+		uint32_t m_activeStage;
+		uint32_t m_activeSubpass;
+		std::vector<std::map<std::thread::id, SecondaryCommandBuffers>> m_secondaryCommandBuffers;
+		std::mutex m_secondaryMutex;
+
+		std::unique_ptr<UploadManager> m_uploadManager;
+		std::unique_ptr<UniformRing> m_uniformRing;
+
+		std::vector<std::vector<std::function<void()>>> m_deletionQueues;
+		std::mutex m_deletionMutex;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -71,17 +111,92 @@ namespace acid
 
 		std::shared_ptr<Swapchain> GetSwapchain() const { return m_swapchain; }
 
-		VkCommandPool GetCommandPool() const { return m_commandPool; }
+		/// <summary>
+		/// Gets the command pool owned by a thread, command pools are created for each thread as they are first requested.
+		/// </summary>
+		/// <param name="threadId"> The thread that will record from the pool. </param>
+		/// <returns> The threads command pool. </returns>
+		VkCommandPool GetCommandPool(const std::thread::id &threadId = std::this_thread::get_id());
 
-		std::shared_ptr<CommandBuffer> GetCommandBuffer() const { return m_commandBuffer; }
+		/// <summary>
+		/// Gets the command buffer the current frame is recorded into.
+		/// </summary>
+		/// <returns> The current frames command buffer. </returns>
+		std::shared_ptr<CommandBuffer> GetCommandBuffer() const { return m_commandBuffers.at(m_frameIndex); }
+
+		/// <summary>
+		/// Gets the number of frames the CPU may record ahead of the GPU, resources written by the CPU every frame need
+		/// a copy for each of these frames.
+		/// </summary>
+		/// <returns> The number of frames in flight. </returns>
+		uint32_t GetFramesInFlight() const { return m_framesInFlight; }
+
+		/// <summary>
+		/// Sets the number of frames the CPU may record ahead of the GPU, waits for the device to be idle.
+		/// </summary>
+		/// <param name="framesInFlight"> The new number of frames in flight. </param>
+		void SetFramesInFlight(const uint32_t &framesInFlight);
+
+		/// <summary>
+		/// Gets the index of the frame being recorded, in the range [0, frames in flight).
+		/// </summary>
+		/// <returns> The current frame index. </returns>
+		uint32_t GetFrameIndex() const { return m_frameIndex; }
+
+		/// <summary>
+		/// Gets if renderers are recorded in parallel into secondary command buffers.
+		/// </summary>
+		/// <returns> If recording is parallel. </returns>
+		bool IsParallelRecording() const { return m_parallelRecording; }
+
+		/// <summary>
+		/// Sets if renderers are recorded in parallel into secondary command buffers, or inline on the main thread.
+		/// </summary>
+		/// <param name="parallelRecording"> If recording is parallel. </param>
+		void SetParallelRecording(const bool &parallelRecording) { m_parallelRecording = parallelRecording; }
+
+		/// <summary>
+		/// Begins a secondary command buffer that continues the active subpass, with the viewport and scissor set. The
+		/// buffer is owned by the calling thread and the current frame, it can be recorded from any job while renderers
+		/// are being recorded, and must be ended by the caller.
+		/// </summary>
+		/// <returns> The begun secondary command buffer. </returns>
+		std::shared_ptr<CommandBuffer> BeginSecondary();
+
+		/// <summary>
+		/// Gets the upload manager, uploads requested from any thread are submitted together at the start of the next frame.
+		/// </summary>
+		/// <returns> The upload manager. </returns>
+		UploadManager &GetUploadManager() { return *m_uploadManager; }
+
+		/// <summary>
+		/// Gets the uniform ring, uniform handlers write their blocks into it every frame.
+		/// </summary>
+		/// <returns> The uniform ring. </returns>
+		UniformRing &GetUniformRing() { return *m_uniformRing; }
+
+		/// <summary>
+		/// Queues the destruction of a GPU object until the frames that may still use it have finished.
+		/// The object is destroyed straight away when there is no renderer running.
+		/// </summary>
+		/// <param name="destroy"> The function that destroys the object. </param>
+		static void Retire(std::function<void()> &&destroy);
 
 		uint32_t GetActiveSwapchainImage() const { return m_activeSwapchainImage; }
 
 		VkPipelineCache GetPipelineCache() const { return m_pipelineCache; }
+
+		/// <summary>
+		/// Writes the pipeline cache to disk if pipelines were added to it since it was last loaded or saved.
+		/// The cache is saved on shutdown and periodically while new pipelines are being created.
+		/// </summary>
+		void SavePipelineCache();
 	private:
-		void CreateFences();
+		void CreateFrames();
+
+		void DestroyFrames();
 
-		void CreateCommandPool();
+		void RunDeletions(const uint32_t &frameIndex);
 
 		void CreatePipelineCache();
 
@@ -92,5 +207,9 @@ namespace acid
 		void EndRenderpass(const uint32_t &i);
 
 		void NextSubpass();
+
+		VkSubpassContents GetSubpassContents() const { return m_parallelRecording ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE; }
+
+		void RenderSubpass(const std::vector<std::shared_ptr<IRenderer>> &renderers, const Vector4 &clipPlane, const ICamera &camera);
 	};
 }
@@ -1,6 +1,7 @@
 #include "DepthStencil.hpp"
 
 #include "Display/Display.hpp"
+#include "Renderer/Renderer.hpp"
 
 namespace acid
 {
@@ -19,6 +20,7 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_sampler(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_UNDEFINED),
@@ -43,7 +45,7 @@ namespace acid
 			throw std::runtime_error("Vulkan runtime error, depth stencil format not selected!");
 		}
 
-		Texture::CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, 1, m_format, VK_IMAGE_TILING_OPTIMAL,
+		Texture::CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, 1, m_format, VK_IMAGE_TILING_OPTIMAL,
 			VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
 		Texture::CreateImageSampler(m_sampler, true, false, false, 1);
 		Texture::CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_2D, m_format, VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT, 1, 1);
@@ -55,11 +57,21 @@ namespace acid
 
 	DepthStencil::~DepthStencil()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		// Frames still in flight may render into or sample from the image.
+		auto sampler = m_sampler;
+		auto imageView = m_imageView;
+		auto image = m_image;
+		auto imageMemory = m_imageMemory;
 
-		vkDestroySampler(logicalDevice, m_sampler, nullptr);
-		vkDestroyImageView(logicalDevice, m_imageView, nullptr);
-		vkDestroyImage(logicalDevice, m_image, nullptr);
+		Renderer::Retire([sampler, imageView, image, imageMemory]() mutable
+		{
+			auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+			vkDestroySampler(logicalDevice, sampler, nullptr);
+			vkDestroyImageView(logicalDevice, imageView, nullptr);
+			vkDestroyImage(logicalDevice, image, nullptr);
+			Display::Get()->GetMemoryAllocator().Free(imageMemory);
+		});
 	}
 
 	DescriptorType DepthStencil::CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage)
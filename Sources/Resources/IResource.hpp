@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace acid
 {
+	/// <summary>
+	/// A interface used for defining resources that are shared and cached by <seealso cref="Resources"/>.
+	/// </summary>
 	class ACID_EXPORT IResource
 	{
 	private:
@@ -16,6 +20,16 @@ namespace acid
 		{
 		}
 
+		/// <summary>
+		/// Gets the unique name this resource is cached under.
+		/// </summary>
+		/// <returns> The resources filename. </returns>
 		virtual std::string GetFilename() = 0;
+
+		/// <summary>
+		/// Gets the approximate memory (bytes) held by this resource, counted against the resource cache budget.
+		/// </summary>
+		/// <returns> The memory size, or 0 if unknown. </returns>
+		virtual std::size_t GetMemorySize() const { return 0; }
 	};
 }
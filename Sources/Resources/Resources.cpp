@@ -1,11 +1,14 @@
 #include "Resources.hpp"
 
-#include <algorithm>
-
 namespace acid
 {
+	const std::size_t Resources::DEFAULT_MEMORY_BUDGET = 512 * 1024 * 1024;
+
 	Resources::Resources() :
-		m_resources(std::vector<std::shared_ptr<IResource>>()),
+		m_resources(std::unordered_map<std::string, ResourceEntry>()),
+		m_recent(std::list<const std::string *>()),
+		m_memoryBudget(DEFAULT_MEMORY_BUDGET),
+		m_memoryUsed(0),
 		m_timerPurge(Timer(5.0f))
 	{
 	}
@@ -20,52 +23,64 @@ namespace acid
 		{
 			m_timerPurge.ResetStartTime();
 
-			for (auto it = m_resources.begin(); it != m_resources.end();)
-			{
-				if ((*it).use_count() <= 1)
-				{
-#if ACID_VERBOSE
-					Log::Out("Resource '%s' erased\n", (*it)->GetFilename().c_str());
-#endif
-					it = m_resources.erase(it);
-					continue;
-				}
-
-				++it;
-			}
+			// Evicted resources are destroyed once the lock has been released.
+			std::vector<std::shared_ptr<IResource>> evicted = {};
+			std::lock_guard<std::mutex> lock(m_mutex);
+			Evict(evicted, true);
 		}
 	}
 
 	std::shared_ptr<IResource> Resources::Get(const std::string &filename)
 	{
-		for (auto &resource : m_resources)
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_resources.find(filename);
+
+		if (it == m_resources.end())
 		{
-			if (resource != nullptr && resource->GetFilename() == filename)
-			{
-				return resource;
-			}
+			return nullptr;
 		}
 
-		return nullptr;
+		m_recent.splice(m_recent.begin(), m_recent, (*it).second.m_recent);
+		return (*it).second.m_resource;
 	}
 
 	void Resources::Add(const std::shared_ptr<IResource> &resource)
 	{
-		if (std::find(m_resources.begin(), m_resources.end(), resource) != m_resources.end())
+		if (resource == nullptr)
 		{
 			return;
 		}
 
-		m_resources.emplace_back(resource);
+		std::vector<std::shared_ptr<IResource>> evicted = {};
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto inserted = m_resources.emplace(resource->GetFilename(), ResourceEntry());
+
+		if (!inserted.second)
+		{
+			return;
+		}
+
+		auto &entry = (*inserted.first).second;
+		entry.m_resource = resource;
+		entry.m_memorySize = resource->GetMemorySize();
+		entry.m_recent = m_recent.emplace(m_recent.begin(), &(*inserted.first).first);
+		m_memoryUsed += entry.m_memorySize;
+
+		if (m_memoryUsed > m_memoryBudget)
+		{
+			Evict(evicted, false);
+		}
 	}
 
 	bool Resources::Remove(const std::shared_ptr<IResource> &resource)
 	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
 		for (auto it = m_resources.begin(); it != m_resources.end(); ++it)
 		{
-			if (*it == resource)
+			if ((*it).second.m_resource == resource)
 			{
-				m_resources.erase(it);
+				Erase(it);
 				return true;
 			}
 		}
@@ -75,15 +90,61 @@ namespace acid
 
 	bool Resources::Remove(const std::string &filename)
 	{
-		for (auto it = m_resources.begin(); it != m_resources.end(); ++it)
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_resources.find(filename);
+
+		if (it == m_resources.end())
 		{
-			if ((*it)->GetFilename() == filename)
+			return false;
+		}
+
+		Erase(it);
+		return true;
+	}
+
+	void Resources::SetMemoryBudget(const std::size_t &memoryBudget)
+	{
+		std::vector<std::shared_ptr<IResource>> evicted = {};
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_memoryBudget = memoryBudget;
+		Evict(evicted, false);
+	}
+
+	void Resources::Evict(std::vector<std::shared_ptr<IResource>> &evicted, const bool &unsized)
+	{
+		// Walks from the least recently used resource.
+		for (auto it = m_recent.end(); it != m_recent.begin();)
+		{
+			--it;
+			auto entry = m_resources.find(**it);
+
+			// Only the cache holds a reference to this resource.
+			if ((*entry).second.m_resource.use_count() > 1)
 			{
-				m_resources.erase(it);
-				return true;
+				continue;
 			}
+
+			bool overBudget = m_memoryUsed > m_memoryBudget && (*entry).second.m_memorySize != 0;
+
+			if (!overBudget && !(unsized && (*entry).second.m_memorySize == 0))
+			{
+				continue;
+			}
+
+#if ACID_VERBOSE
+			Log::Out("Resource '%s' erased\n", (*entry).first.c_str());
+#endif
+			auto following = std::next(it);
+			evicted.emplace_back((*entry).second.m_resource);
+			Erase(entry);
+			it = following;
 		}
+	}
 
-		return false;
+	void Resources::Erase(const std::unordered_map<std::string, ResourceEntry>::iterator &it)
+	{
+		m_memoryUsed -= (*it).second.m_memorySize;
+		m_recent.erase((*it).second.m_recent);
+		m_resources.erase(it);
 	}
 }
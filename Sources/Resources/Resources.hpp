@@ -1,7 +1,10 @@
 #pragma once
 
+#include <future>
+#include <list>
 #include <memory>
-#include <vector>
+#include <mutex>
+#include <unordered_map>
 #include "Engine/Engine.hpp"
 #include "Maths/Timer.hpp"
 #include "IResource.hpp"
@@ -9,15 +12,29 @@
 namespace acid
 {
 	/// <summary>
-	/// A module used for managing resources.
+	/// A module used for managing resources. Resources are indexed by filename, and unused resources are
+	/// kept until the memory budget is exceeded, then evicted in least recently used order.
 	/// </summary>
 	class ACID_EXPORT Resources :
 		public IModule
 	{
 	private:
-		std::vector<std::shared_ptr<IResource>> m_resources;
+		struct ResourceEntry
+		{
+			std::shared_ptr<IResource> m_resource;
+			std::size_t m_memorySize;
+			std::list<const std::string *>::iterator m_recent;
+		};
+
+		std::unordered_map<std::string, ResourceEntry> m_resources;
+		std::list<const std::string *> m_recent;
+		std::size_t m_memoryBudget;
+		std::size_t m_memoryUsed;
+		std::mutex m_mutex;
 		Timer m_timerPurge;
 	public:
+		static const std::size_t DEFAULT_MEMORY_BUDGET;
+
 		/// <summary>
 		/// Gets this engine instance.
 		/// </summary>
@@ -30,12 +47,70 @@ namespace acid
 
 		void Update() override;
 
+		/// <summary>
+		/// Finds a cached resource and marks it as recently used.
+		/// </summary>
+		/// <param name="filename"> The resources filename. </param>
+		/// <returns> The resource, or nullptr if it is not cached. </returns>
 		std::shared_ptr<IResource> Get(const std::string &filename);
 
+		/// <summary>
+		/// Adds a resource to the cache, evicting unused resources if the memory budget is exceeded.
+		/// </summary>
+		/// <param name="resource"> The resource to add. </param>
 		void Add(const std::shared_ptr<IResource> &resource);
 
 		bool Remove(const std::shared_ptr<IResource> &resource);
 
 		bool Remove(const std::string &filename);
+
+		/// <summary>
+		/// Loads a resource on the engines thread pool, using the resource types static <code>Resource(filename)</code> loader.
+		/// </summary>
+		/// <param name="filename"> The resources filename. </param>
+		/// <param name="T"> The resource type to load. </param>
+		/// <returns> A future holding the loaded resource. </returns>
+		template<typename T>
+		std::shared_future<std::shared_ptr<T>> LoadAsync(const std::string &filename)
+		{
+			auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+			std::shared_future<std::shared_ptr<T>> result = promise->get_future().share();
+
+			Engine::Get()->GetThreadPool().Enqueue([promise, filename]()
+			{
+				try
+				{
+					promise->set_value(T::Resource(filename));
+				}
+				catch (...)
+				{
+					promise->set_exception(std::current_exception());
+				}
+			});
+
+			return result;
+		}
+
+		/// <summary>
+		/// Gets the memory (bytes) unused resources may occupy before being evicted.
+		/// </summary>
+		/// <returns> The memory budget. </returns>
+		std::size_t GetMemoryBudget() const { return m_memoryBudget; }
+
+		/// <summary>
+		/// Sets the memory (bytes) unused resources may occupy before being evicted.
+		/// </summary>
+		/// <param name="memoryBudget"> The new memory budget. </param>
+		void SetMemoryBudget(const std::size_t &memoryBudget);
+
+		/// <summary>
+		/// Gets the memory (bytes) reported by all cached resources.
+		/// </summary>
+		/// <returns> The memory used. </returns>
+		std::size_t GetMemoryUsed() const { return m_memoryUsed; }
+	private:
+		void Evict(std::vector<std::shared_ptr<IResource>> &evicted, const bool &unsized);
+
+		void Erase(const std::unordered_map<std::string, ResourceEntry>::iterator &it);
 	};
 }
@@ -0,0 +1,379 @@
+#include "DynamicAabbTree.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include "Objects/GameObject.hpp"
+
+namespace acid
+{
+	const int32_t DynamicAabbTree::NULL_NODE = -1;
+	const float DynamicAabbTree::FAT_MARGIN = 0.1f;
+
+	DynamicAabbTree::DynamicAabbTree() :
+		m_nodes(std::vector<Node>()),
+		m_root(NULL_NODE),
+		m_freeList(NULL_NODE),
+		m_leafCount(0)
+	{
+	}
+
+	DynamicAabbTree::~DynamicAabbTree()
+	{
+	}
+
+	int32_t DynamicAabbTree::Insert(const Aabb &bounds, const std::shared_ptr<GameObject> &object)
+	{
+		int32_t leaf = AllocateNode();
+		m_nodes[leaf].m_bounds = bounds.Expand(FAT_MARGIN);
+		m_nodes[leaf].m_object = object;
+		m_nodes[leaf].m_height = 0;
+		InsertLeaf(leaf);
+		m_leafCount++;
+		return leaf;
+	}
+
+	void DynamicAabbTree::Remove(const int32_t &leaf)
+	{
+		assert(leaf >= 0 && leaf < static_cast<int32_t>(m_nodes.size()) && m_nodes[leaf].IsLeaf());
+		RemoveLeaf(leaf);
+		FreeNode(leaf);
+		m_leafCount--;
+	}
+
+	bool DynamicAabbTree::Move(const int32_t &leaf, const Aabb &bounds)
+	{
+		assert(leaf >= 0 && leaf < static_cast<int32_t>(m_nodes.size()) && m_nodes[leaf].IsLeaf());
+
+		if (m_nodes[leaf].m_bounds.Contains(bounds))
+		{
+			return false;
+		}
+
+		RemoveLeaf(leaf);
+		m_nodes[leaf].m_bounds = bounds.Expand(FAT_MARGIN);
+		InsertLeaf(leaf);
+		return true;
+	}
+
+	void DynamicAabbTree::Clear()
+	{
+		m_nodes.clear();
+		m_root = NULL_NODE;
+		m_freeList = NULL_NODE;
+		m_leafCount = 0;
+	}
+
+	void DynamicAabbTree::QueryFrustum(const Frustum &frustum, std::vector<std::shared_ptr<GameObject>> &result) const
+	{
+		if (m_root == NULL_NODE)
+		{
+			return;
+		}
+
+		std::vector<int32_t> stack = {m_root};
+
+		while (!stack.empty())
+		{
+			int32_t index = stack.back();
+			auto &node = m_nodes[index];
+			stack.pop_back();
+
+			if (!frustum.CubeInFrustum(node.m_bounds.m_min, node.m_bounds.m_max))
+			{
+				continue;
+			}
+
+			// Everything below a node inside the frustum is visible, so the subtree is added without more plane tests.
+			if (node.IsLeaf() || frustum.CubeContained(node.m_bounds.m_min, node.m_bounds.m_max))
+			{
+				AddSubtree(index, result);
+				continue;
+			}
+
+			stack.emplace_back(node.m_left);
+			stack.emplace_back(node.m_right);
+		}
+	}
+
+	void DynamicAabbTree::QuerySphere(const Vector3 &centre, const float &radius, std::vector<std::shared_ptr<GameObject>> &result) const
+	{
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.IntersectsSphere(centre, radius);
+		}, result);
+	}
+
+	void DynamicAabbTree::QueryBounding(const Aabb &range, std::vector<std::shared_ptr<GameObject>> &result) const
+	{
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.Intersects(range);
+		}, result);
+	}
+
+	void DynamicAabbTree::QueryRay(const Vector3 &origin, const Vector3 &direction, const float &maxDistance, std::vector<std::shared_ptr<GameObject>> &result) const
+	{
+		Vector3 inverseDirection = Vector3(1.0f / direction.m_x, 1.0f / direction.m_y, 1.0f / direction.m_z);
+
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.IntersectsRay(origin, inverseDirection, maxDistance);
+		}, result);
+	}
+
+	int32_t DynamicAabbTree::AllocateNode()
+	{
+		if (m_freeList == NULL_NODE)
+		{
+			m_nodes.emplace_back(Node());
+			m_nodes.back().m_parent = m_freeList;
+			m_nodes.back().m_height = -1;
+			m_freeList = static_cast<int32_t>(m_nodes.size()) - 1;
+		}
+
+		// Free nodes are chained through their parent index.
+		int32_t node = m_freeList;
+		m_freeList = m_nodes[node].m_parent;
+		m_nodes[node].m_parent = NULL_NODE;
+		m_nodes[node].m_left = NULL_NODE;
+		m_nodes[node].m_right = NULL_NODE;
+		m_nodes[node].m_height = 0;
+		return node;
+	}
+
+	void DynamicAabbTree::FreeNode(const int32_t &node)
+	{
+		m_nodes[node].m_object = nullptr;
+		m_nodes[node].m_parent = m_freeList;
+		m_nodes[node].m_height = -1;
+		m_freeList = node;
+	}
+
+	void DynamicAabbTree::InsertLeaf(const int32_t &leaf)
+	{
+		if (m_root == NULL_NODE)
+		{
+			m_root = leaf;
+			m_nodes[m_root].m_parent = NULL_NODE;
+			return;
+		}
+
+		// Descends to the sibling that gives the least surface area, counting the growth of every ancestor on the way.
+		Aabb leafBounds = m_nodes[leaf].m_bounds;
+		int32_t index = m_root;
+
+		while (!m_nodes[index].IsLeaf())
+		{
+			int32_t left = m_nodes[index].m_left;
+			int32_t right = m_nodes[index].m_right;
+
+			float area = m_nodes[index].m_bounds.SurfaceArea();
+			float combinedArea = m_nodes[index].m_bounds.Merge(leafBounds).SurfaceArea();
+
+			// The cost of making a new parent for this node and the leaf, and the cost pushed down to the children.
+			float cost = 2.0f * combinedArea;
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto childCost = [&](const int32_t &child)
+			{
+				float mergedArea = m_nodes[child].m_bounds.Merge(leafBounds).SurfaceArea();
+
+				if (m_nodes[child].IsLeaf())
+				{
+					return mergedArea + inheritanceCost;
+				}
+
+				return mergedArea - m_nodes[child].m_bounds.SurfaceArea() + inheritanceCost;
+			};
+
+			float costLeft = childCost(left);
+			float costRight = childCost(right);
+
+			if (cost < costLeft && cost < costRight)
+			{
+				break;
+			}
+
+			index = costLeft < costRight ? left : right;
+		}
+
+		int32_t sibling = index;
+
+		// Creates a new parent for the sibling and the leaf.
+		int32_t oldParent = m_nodes[sibling].m_parent;
+		int32_t newParent = AllocateNode();
+		m_nodes[newParent].m_parent = oldParent;
+		m_nodes[newParent].m_bounds = leafBounds.Merge(m_nodes[sibling].m_bounds);
+		m_nodes[newParent].m_height = m_nodes[sibling].m_height + 1;
+		m_nodes[newParent].m_left = sibling;
+		m_nodes[newParent].m_right = leaf;
+		m_nodes[sibling].m_parent = newParent;
+		m_nodes[leaf].m_parent = newParent;
+
+		if (oldParent == NULL_NODE)
+		{
+			m_root = newParent;
+		}
+		else if (m_nodes[oldParent].m_left == sibling)
+		{
+			m_nodes[oldParent].m_left = newParent;
+		}
+		else
+		{
+			m_nodes[oldParent].m_right = newParent;
+		}
+
+		// Walks back up refitting bounds and heights.
+		index = m_nodes[leaf].m_parent;
+
+		while (index != NULL_NODE)
+		{
+			index = Balance(index);
+
+			int32_t left = m_nodes[index].m_left;
+			int32_t right = m_nodes[index].m_right;
+			m_nodes[index].m_height = 1 + std::max(m_nodes[left].m_height, m_nodes[right].m_height);
+			m_nodes[index].m_bounds = m_nodes[left].m_bounds.Merge(m_nodes[right].m_bounds);
+
+			index = m_nodes[index].m_parent;
+		}
+	}
+
+	void DynamicAabbTree::RemoveLeaf(const int32_t &leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NULL_NODE;
+			return;
+		}
+
+		int32_t parent = m_nodes[leaf].m_parent;
+		int32_t grandParent = m_nodes[parent].m_parent;
+		int32_t sibling = m_nodes[parent].m_left == leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+		if (grandParent == NULL_NODE)
+		{
+			m_root = sibling;
+			m_nodes[sibling].m_parent = NULL_NODE;
+			FreeNode(parent);
+			return;
+		}
+
+		// The sibling takes the place of the parent.
+		if (m_nodes[grandParent].m_left == parent)
+		{
+			m_nodes[grandParent].m_left = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].m_right = sibling;
+		}
+
+		m_nodes[sibling].m_parent = grandParent;
+		FreeNode(parent);
+
+		int32_t index = grandParent;
+
+		while (index != NULL_NODE)
+		{
+			index = Balance(index);
+
+			int32_t left = m_nodes[index].m_left;
+			int32_t right = m_nodes[index].m_right;
+			m_nodes[index].m_bounds = m_nodes[left].m_bounds.Merge(m_nodes[right].m_bounds);
+			m_nodes[index].m_height = 1 + std::max(m_nodes[left].m_height, m_nodes[right].m_height);
+
+			index = m_nodes[index].m_parent;
+		}
+	}
+
+	int32_t DynamicAabbTree::Balance(const int32_t &a)
+	{
+		if (m_nodes[a].IsLeaf() || m_nodes[a].m_height < 2)
+		{
+			return a;
+		}
+
+		int32_t b = m_nodes[a].m_left;
+		int32_t c = m_nodes[a].m_right;
+		int32_t balance = m_nodes[c].m_height - m_nodes[b].m_height;
+
+		// Rotates the taller child up, its shorter child swaps over to this node.
+		auto rotate = [&](const int32_t &up, const int32_t &other, const bool &upIsRight) -> int32_t
+		{
+			int32_t f = m_nodes[up].m_left;
+			int32_t g = m_nodes[up].m_right;
+
+			m_nodes[up].m_left = a;
+			m_nodes[up].m_parent = m_nodes[a].m_parent;
+			m_nodes[a].m_parent = up;
+
+			if (m_nodes[up].m_parent == NULL_NODE)
+			{
+				m_root = up;
+			}
+			else if (m_nodes[m_nodes[up].m_parent].m_left == a)
+			{
+				m_nodes[m_nodes[up].m_parent].m_left = up;
+			}
+			else
+			{
+				m_nodes[m_nodes[up].m_parent].m_right = up;
+			}
+
+			// The taller grandchild stays under the rotated node, the shorter one moves under this node.
+			int32_t keep = m_nodes[f].m_height > m_nodes[g].m_height ? f : g;
+			int32_t move = keep == f ? g : f;
+
+			m_nodes[up].m_right = keep;
+
+			if (upIsRight)
+			{
+				m_nodes[a].m_right = move;
+			}
+			else
+			{
+				m_nodes[a].m_left = move;
+			}
+
+			m_nodes[move].m_parent = a;
+			m_nodes[a].m_bounds = m_nodes[other].m_bounds.Merge(m_nodes[move].m_bounds);
+			m_nodes[up].m_bounds = m_nodes[a].m_bounds.Merge(m_nodes[keep].m_bounds);
+			m_nodes[a].m_height = 1 + std::max(m_nodes[other].m_height, m_nodes[move].m_height);
+			m_nodes[up].m_height = 1 + std::max(m_nodes[a].m_height, m_nodes[keep].m_height);
+			return up;
+		};
+
+		if (balance > 1)
+		{
+			return rotate(c, b, true);
+		}
+
+		if (balance < -1)
+		{
+			return rotate(b, c, false);
+		}
+
+		return a;
+	}
+
+	void DynamicAabbTree::AddSubtree(const int32_t &node, std::vector<std::shared_ptr<GameObject>> &result) const
+	{
+		std::vector<int32_t> stack = {node};
+
+		while (!stack.empty())
+		{
+			auto &current = m_nodes[stack.back()];
+			stack.pop_back();
+
+			if (current.IsLeaf())
+			{
+				result.emplace_back(current.m_object);
+				continue;
+			}
+
+			stack.emplace_back(current.m_left);
+			stack.emplace_back(current.m_right);
+		}
+	}
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Physics/Aabb.hpp"
+#include "Physics/Frustum.hpp"
+
+namespace acid
+{
+	class GameObject;
+
+	/// <summary>
+	/// A bounding volume hierarchy of game objects that is updated incrementally. Leaves are inserted where they add the
+	/// least surface area and the tree is rebalanced with rotations on the way back up. Leaves store their bounds grown by
+	/// a margin, so objects that move a little are not reinserted.
+	/// </summary>
+	class ACID_EXPORT DynamicAabbTree
+	{
+	public:
+		static const int32_t NULL_NODE;
+		static const float FAT_MARGIN;
+	private:
+		struct Node
+		{
+			Aabb m_bounds;
+			std::shared_ptr<GameObject> m_object;
+			int32_t m_parent;
+			int32_t m_left;
+			int32_t m_right;
+			int32_t m_height;
+
+			bool IsLeaf() const { return m_left == NULL_NODE; }
+		};
+
+		std::vector<Node> m_nodes;
+		int32_t m_root;
+		int32_t m_freeList;
+		uint32_t m_leafCount;
+	public:
+		/// <summary>
+		/// Creates a new empty tree.
+		/// </summary>
+		DynamicAabbTree();
+
+		~DynamicAabbTree();
+
+		/// <summary>
+		/// Adds an object to the tree.
+		/// </summary>
+		/// <param name="bounds"> The objects world bounds. </param>
+		/// <param name="object"> The object. </param>
+		/// <returns> The leaf the object is stored in, used to move or remove it. </returns>
+		int32_t Insert(const Aabb &bounds, const std::shared_ptr<GameObject> &object);
+
+		/// <summary>
+		/// Removes a leaf from the tree.
+		/// </summary>
+		/// <param name="leaf"> The leaf returned by <seealso cref="#Insert()"/>. </param>
+		void Remove(const int32_t &leaf);
+
+		/// <summary>
+		/// Updates the bounds of a leaf, it is only reinserted when the new bounds leave its grown bounds.
+		/// </summary>
+		/// <param name="leaf"> The leaf returned by <seealso cref="#Insert()"/>. </param>
+		/// <param name="bounds"> The objects new world bounds. </param>
+		/// <returns> If the leaf was reinserted. </returns>
+		bool Move(const int32_t &leaf, const Aabb &bounds);
+
+		/// <summary>
+		/// Removes every leaf from the tree.
+		/// </summary>
+		void Clear();
+
+		void QueryFrustum(const Frustum &frustum, std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		void QuerySphere(const Vector3 &centre, const float &radius, std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		void QueryBounding(const Aabb &range, std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		void QueryRay(const Vector3 &origin, const Vector3 &direction, const float &maxDistance, std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		uint32_t GetLeafCount() const { return m_leafCount; }
+
+		/// <summary>
+		/// Gets the height of the tree, a leaf has a height of 0.
+		/// </summary>
+		/// <returns> The height of the root, or -1 when the tree is empty. </returns>
+		int32_t GetHeight() const { return m_root == NULL_NODE ? -1 : m_nodes[m_root].m_height; }
+	private:
+		int32_t AllocateNode();
+
+		void FreeNode(const int32_t &node);
+
+		void InsertLeaf(const int32_t &leaf);
+
+		void RemoveLeaf(const int32_t &leaf);
+
+		int32_t Balance(const int32_t &node);
+
+		void AddSubtree(const int32_t &node, std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		/// <summary>
+		/// Walks the nodes whose bounds pass a test, and adds the objects of the leaves that pass it.
+		/// </summary>
+		template<typename T>
+		void Query(const T &overlaps, std::vector<std::shared_ptr<GameObject>> &result) const
+		{
+			if (m_root == NULL_NODE)
+			{
+				return;
+			}
+
+			std::vector<int32_t> stack = {m_root};
+
+			while (!stack.empty())
+			{
+				auto &node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				if (!overlaps(node.m_bounds))
+				{
+					continue;
+				}
+
+				if (node.IsLeaf())
+				{
+					result.emplace_back(node.m_object);
+					continue;
+				}
+
+				stack.emplace_back(node.m_left);
+				stack.emplace_back(node.m_right);
+			}
+		}
+	};
+}
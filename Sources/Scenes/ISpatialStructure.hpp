@@ -2,7 +2,10 @@
 
 #include <memory>
 #include <vector>
+#include <limits>
+#include "Physics/Aabb.hpp"
 #include "Physics/Frustum.hpp"
+#include "Physics/Ray.hpp"
 
 namespace acid
 {
@@ -10,8 +13,6 @@ namespace acid
 
 	class IComponent;
 
-	class Collider;
-
 	/// <summary>
 	/// A data structure that stores objects with a notion of space.
 	/// </summary>
@@ -36,6 +37,12 @@ namespace acid
 		/// </summary>
 		virtual void Clear() = 0;
 
+		/// <summary>
+		/// Removes objects that have been marked as removed, and updates the space taken by objects that have moved.
+		/// Called once a frame after world matrices have been rebuilt.
+		/// </summary>
+		virtual void Update() = 0;
+
 		/// <summary>
 		/// Gets the size of this structure.
 		/// </summary>
@@ -64,14 +71,28 @@ namespace acid
 		/// <returns> The list of all object in range. </returns>
 		virtual std::vector<std::shared_ptr<GameObject>> QueryFrustum(const Frustum &range) = 0;
 
+		/// <summary>
+		/// Returns a set of all objects in a sphere of the spatial structure.
+		/// </summary>
+		/// <param name="centre"> The centre of the sphere. </param>
+		/// <param name="radius"> The radius of the sphere. </param>
+		/// <returns> The list of all object in range. </returns>
+		virtual std::vector<std::shared_ptr<GameObject>> QuerySphere(const Vector3 &centre, const float &radius) = 0;
+
 		/// <summary>
 		/// Returns a set of all objects in a specific range of the spatial structure.
 		/// </summary>
-		/// <param name="range"> The shape range of space being queried. </param>
-		/// <param name="result"> The list to store the data into.
-		/// </param>
+		/// <param name="range"> The box range of space being queried. </param>
 		/// <returns> The list of all object in range. </returns>
-	//	virtual std::vector<std::shared_ptr<GameObject>> QueryBounding(Collider *range) = 0;
+		virtual std::vector<std::shared_ptr<GameObject>> QueryBounding(const Aabb &range) = 0;
+
+		/// <summary>
+		/// Returns a set of all objects that may be hit by a ray, in no particular order.
+		/// </summary>
+		/// <param name="ray"> The ray being cast. </param>
+		/// <param name="maxDistance"> How far along the ray objects are found. </param>
+		/// <returns> The list of all object along the ray. </returns>
+		virtual std::vector<std::shared_ptr<GameObject>> QueryRay(const Ray &ray, const float &maxDistance = std::numeric_limits<float>::infinity()) = 0;
 
 		/// <summary>
 		/// If the structure contains the object.
@@ -80,5 +101,17 @@ namespace acid
 		/// </param>
 		/// <returns> If the structure contains the object. </returns>
 		virtual bool Contains(const std::shared_ptr<GameObject> &object) = 0;
+
+		/// <summary>
+		/// Called by an object in the structure after a component has been attached to it.
+		/// </summary>
+		/// <param name="component"> The attached component. </param>
+		virtual void OnComponentAdd(IComponent *component) = 0;
+
+		/// <summary>
+		/// Called by an object in the structure before a component is detached from it.
+		/// </summary>
+		/// <param name="component"> The component being detached. </param>
+		virtual void OnComponentRemove(IComponent *component) = 0;
 	};
 }
@@ -1,40 +1,191 @@
 ﻿#include "SceneStructure.hpp"
 
+#include "Meshes/Mesh.hpp"
 #include "Physics/Collider.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// Gets the world bounds of an object from its collider, or from the model of its mesh.
+	/// </summary>
+	static std::optional<Aabb> GetObjectBounds(GameObject &object)
+	{
+		auto collider = object.GetComponent<Collider>(true);
+
+		if (collider != nullptr)
+		{
+			auto bounds = collider->GetBounds();
+
+			if (bounds)
+			{
+				return bounds;
+			}
+		}
+
+		auto mesh = object.GetComponent<Mesh>(true);
+
+		if (mesh == nullptr || mesh->GetModel() == nullptr)
+		{
+			return {};
+		}
+
+		auto bounds = Aabb(mesh->GetModel()->GetMinExtents(), mesh->GetModel()->GetMaxExtents());
+
+		if (bounds.IsEmpty())
+		{
+			return {};
+		}
+
+		return bounds.Transformed(object.GetTransform().GetWorldMatrix());
+	}
+
 	SceneStructure::SceneStructure() :
 		ISpatialStructure(),
-		m_objects(std::vector<std::shared_ptr<GameObject>>())
+		m_objects(std::vector<std::shared_ptr<GameObject>>()),
+		m_entries(std::vector<Entry>()),
+		m_indices(std::unordered_map<GameObject *, uint32_t>()),
+		m_unbounded(std::unordered_map<GameObject *, std::shared_ptr<GameObject>>()),
+		m_tree(DynamicAabbTree()),
+		m_pools(std::vector<std::unique_ptr<IComponentPool>>()),
+		m_nextOrder(0)
 	{
 	}
 
 	SceneStructure::~SceneStructure()
 	{
+		// Objects may outlive the structure, they must not tell it about their components after.
+		for (auto &object : m_objects)
+		{
+			object->SetStructure(nullptr);
+		}
 	}
 
 	void SceneStructure::Add(const std::shared_ptr<GameObject> &object)
 	{
+		if (Contains(object))
+		{
+			return;
+		}
+
+		// Components are attached after the object is added, so bounds are found in the next update.
+		m_indices.emplace(object.get(), static_cast<uint32_t>(m_objects.size()));
 		m_objects.emplace_back(object);
+		m_entries.emplace_back(Entry{DynamicAabbTree::NULL_NODE, object->GetTransform().GetVersion(), m_nextOrder++});
+		m_unbounded.emplace(object.get(), object);
+		object->SetStructure(this);
+
+		for (auto &component : object->m_components)
+		{
+			OnComponentAdd(component.get());
+		}
 	}
 
 	bool SceneStructure::Remove(const std::shared_ptr<GameObject> &object)
 	{
-		auto it = std::find(m_objects.begin(), m_objects.end(), object);
+		auto it = m_indices.find(object.get());
 
-		if (it != m_objects.end())
+		if (it == m_indices.end())
 		{
-			m_objects.erase(it);
-			return true;
+			return false;
 		}
 
-		return false;
+		uint32_t index = it->second;
+
+		if (m_entries[index].m_leaf != DynamicAabbTree::NULL_NODE)
+		{
+			m_tree.Remove(m_entries[index].m_leaf);
+		}
+		else
+		{
+			m_unbounded.erase(object.get());
+		}
+
+		Detach(*object);
+
+		// The last object is moved into the freed slot, the order of objects is not kept.
+		m_indices.erase(it);
+
+		if (index != m_objects.size() - 1)
+		{
+			m_objects[index] = std::move(m_objects.back());
+			m_entries[index] = m_entries.back();
+			m_indices[m_objects[index].get()] = index;
+		}
+
+		m_objects.pop_back();
+		m_entries.pop_back();
+		return true;
 	}
 
 	void SceneStructure::Clear()
 	{
+		for (auto &object : m_objects)
+		{
+			object->SetStructure(nullptr);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+
+			for (auto &pool : m_pools)
+			{
+				if (pool != nullptr)
+				{
+					pool->Clear();
+				}
+			}
+		}
+
 		m_objects.clear();
+		m_entries.clear();
+		m_indices.clear();
+		m_unbounded.clear();
+		m_tree.Clear();
+	}
+
+	void SceneStructure::Update()
+	{
+		uint32_t count = 0;
+
+		for (uint32_t i = 0; i < m_objects.size(); i++)
+		{
+			auto object = m_objects[i].get();
+
+			if (object->IsRemoved())
+			{
+				if (m_entries[i].m_leaf != DynamicAabbTree::NULL_NODE)
+				{
+					m_tree.Remove(m_entries[i].m_leaf);
+				}
+				else
+				{
+					m_unbounded.erase(object);
+				}
+
+				Detach(*object);
+				m_indices.erase(object);
+				continue;
+			}
+
+			// Removed objects are compacted out in the same pass.
+			if (count != i)
+			{
+				m_objects[count] = std::move(m_objects[i]);
+				m_entries[count] = m_entries[i];
+				m_indices[object] = count;
+			}
+
+			// Objects without bounds are checked every update, they may have been given a collider or mesh since.
+			if (m_entries[count].m_leaf == DynamicAabbTree::NULL_NODE || m_entries[count].m_version != object->GetTransform().GetVersion())
+			{
+				Refit(count);
+			}
+
+			count++;
+		}
+
+		m_objects.resize(count);
+		m_entries.resize(count);
 	}
 
 	std::vector<std::shared_ptr<GameObject>> SceneStructure::QueryAll()
@@ -52,41 +203,145 @@ namespace acid
 	std::vector<std::shared_ptr<GameObject>> SceneStructure::QueryFrustum(const Frustum &range)
 	{
 		auto result = std::vector<std::shared_ptr<GameObject>>();
+		m_tree.QueryFrustum(range, result);
+		AddUnbounded(result);
+		return result;
+	}
 
-		for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+	std::vector<std::shared_ptr<GameObject>> SceneStructure::QuerySphere(const Vector3 &centre, const float &radius)
+	{
+		auto result = std::vector<std::shared_ptr<GameObject>>();
+		m_tree.QuerySphere(centre, radius, result);
+		AddUnbounded(result);
+		return result;
+	}
+
+	std::vector<std::shared_ptr<GameObject>> SceneStructure::QueryBounding(const Aabb &range)
+	{
+		auto result = std::vector<std::shared_ptr<GameObject>>();
+		m_tree.QueryBounding(range, result);
+		AddUnbounded(result);
+		return result;
+	}
+
+	std::vector<std::shared_ptr<GameObject>> SceneStructure::QueryRay(const Ray &ray, const float &maxDistance)
+	{
+		auto result = std::vector<std::shared_ptr<GameObject>>();
+		m_tree.QueryRay(ray.GetOrigin(), ray.GetCurrentRay(), maxDistance, result);
+		AddUnbounded(result);
+		return result;
+	}
+
+	bool SceneStructure::Contains(const std::shared_ptr<GameObject> &object)
+	{
+		return m_indices.find(object.get()) != m_indices.end();
+	}
+
+	void SceneStructure::OnComponentAdd(IComponent *component)
+	{
+		if (component->GetGameObject() == nullptr || component->GetGameObject()->IsRemoved())
 		{
-			auto gameObject = std::dynamic_pointer_cast<GameObject>(*it);
-			auto collider = gameObject->GetComponent<Collider>();
+			return;
+		}
 
-			if (collider == nullptr || collider->InFrustum(range))
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+
+		for (auto &pool : m_pools)
+		{
+			if (pool != nullptr)
 			{
-				result.emplace_back(*it);
+				pool->Add(component);
 			}
 		}
-
-		return result;
 	}
 
-	/*std::vector<std::shared_ptr<GameObject>> SceneStructure::QueryBounding(Collider *range)
+	void SceneStructure::OnComponentRemove(IComponent *component)
 	{
-		auto result = std::vector<std::shared_ptr<GameObject>>();
+		std::lock_guard<std::mutex> lock(m_poolMutex);
 
-		for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+		for (auto &pool : m_pools)
 		{
-			auto gameObject = std::dynamic_pointer_cast<GameObject>(*it);
-			auto collider = gameObject->GetComponent<Collider>();
+			if (pool != nullptr)
+			{
+				pool->Remove(component);
+			}
+		}
+	}
+
+	void SceneStructure::Refit(const uint32_t &index)
+	{
+		auto &object = m_objects[index];
+		auto &entry = m_entries[index];
+		auto bounds = GetObjectBounds(*object);
 
-			if (collider == nullptr || range->Intersects(*collider).IsIntersection() || range->Contains(*collider))
+		// The bounds were taken from the world matrix of this version.
+		entry.m_version = object->GetTransform().GetVersion();
+
+		if (!bounds)
+		{
+			if (entry.m_leaf != DynamicAabbTree::NULL_NODE)
 			{
-				result.emplace_back(*it);
+				m_tree.Remove(entry.m_leaf);
+				entry.m_leaf = DynamicAabbTree::NULL_NODE;
+				m_unbounded.emplace(object.get(), object);
 			}
+
+			return;
 		}
 
-		return result;
-	}*/
+		if (entry.m_leaf == DynamicAabbTree::NULL_NODE)
+		{
+			entry.m_leaf = m_tree.Insert(*bounds, object);
+			m_unbounded.erase(object.get());
+			return;
+		}
 
-	bool SceneStructure::Contains(const std::shared_ptr<GameObject> &object)
+		m_tree.Move(entry.m_leaf, *bounds);
+	}
+
+	void SceneStructure::AddUnbounded(std::vector<std::shared_ptr<GameObject>> &result) const
 	{
-		return std::find(m_objects.begin(), m_objects.end(), object) != m_objects.end();
+		for (auto &unbounded : m_unbounded)
+		{
+			result.emplace_back(unbounded.second);
+		}
+	}
+
+	void SceneStructure::Detach(GameObject &object)
+	{
+		for (auto &component : object.m_components)
+		{
+			OnComponentRemove(component.get());
+		}
+
+		object.SetStructure(nullptr);
+	}
+
+	std::vector<GameObject *> SceneStructure::GetObjectsInOrder() const
+	{
+		std::vector<uint32_t> indices = {};
+
+		for (uint32_t i = 0; i < m_objects.size(); i++)
+		{
+			if (!m_objects[i]->IsRemoved())
+			{
+				indices.emplace_back(i);
+			}
+		}
+
+		std::sort(indices.begin(), indices.end(), [this](const uint32_t &a, const uint32_t &b)
+		{
+			return m_entries[a].m_order < m_entries[b].m_order;
+		});
+
+		std::vector<GameObject *> result = {};
+		result.reserve(indices.size());
+
+		for (auto &index : indices)
+		{
+			result.emplace_back(m_objects[index].get());
+		}
+
+		return result;
 	}
 }
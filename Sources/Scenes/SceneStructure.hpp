@@ -1,22 +1,46 @@
 ﻿#pragma once
 
 #include <algorithm>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
+#include "Objects/ComponentPool.hpp"
 #include "Objects/GameObject.hpp"
 #include "Objects/IComponent.hpp"
 #include "Physics/Rigidbody.hpp"
+#include "DynamicAabbTree.hpp"
 #include "ISpatialStructure.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A structure of spatial objects for a 3D space.
+	/// A structure of spatial objects for a 3D space. Objects with bounds, from a collider or a mesh, are kept in a
+	/// <seealso cref="DynamicAabbTree"/> and are refit when their transform changes. Objects without bounds are returned by every query.
+	/// Components are also kept in a pool for each type that has been queried, so systems can walk one type without casts.
 	/// </summary>
 	class ACID_EXPORT SceneStructure :
 		public ISpatialStructure
 	{
 	private:
+		/// <summary>
+		/// Where an object is stored in the tree, the transform version its bounds were taken at, and when it was added.
+		/// </summary>
+		struct Entry
+		{
+			int32_t m_leaf;
+			uint32_t m_version;
+			uint64_t m_order;
+		};
+
 		std::vector<std::shared_ptr<GameObject>> m_objects;
+		std::vector<Entry> m_entries;
+		std::unordered_map<GameObject *, uint32_t> m_indices;
+		std::unordered_map<GameObject *, std::shared_ptr<GameObject>> m_unbounded;
+		DynamicAabbTree m_tree;
+		std::vector<std::unique_ptr<IComponentPool>> m_pools;
+		std::mutex m_poolMutex;
+		uint64_t m_nextOrder;
 	public:
 		/// <summary>
 		/// Creates a new basic structure.
@@ -31,6 +55,8 @@ namespace acid
 
 		void Clear() override;
 
+		void Update() override;
+
 		uint32_t GetSize() override { return static_cast<uint32_t>(m_objects.size()); }
 
 		std::vector<std::shared_ptr<GameObject>> &GetAll() override { return m_objects; }
@@ -39,62 +65,151 @@ namespace acid
 
 		std::vector<std::shared_ptr<GameObject>> QueryFrustum(const Frustum &range) override;
 
-	//	std::vector<std::shared_ptr<GameObject>> QueryBounding(Collider *range) override;
+		std::vector<std::shared_ptr<GameObject>> QuerySphere(const Vector3 &centre, const float &radius) override;
+
+		std::vector<std::shared_ptr<GameObject>> QueryBounding(const Aabb &range) override;
+
+		std::vector<std::shared_ptr<GameObject>> QueryRay(const Ray &ray, const float &maxDistance = std::numeric_limits<float>::infinity()) override;
 
 		/// <summary>
-		/// Returns a set of all components of a type in the spatial structure.
+		/// Returns all components of a type in the spatial structure, read from the types pool without copying. Components
+		/// of removed objects are left out, disabled components are not and are skipped by the caller. The list is in no
+		/// particular order, and is only valid until a component is next attached or detached.
+		/// </summary>
+		/// <param name="T"> The component type. </param>
+		/// <returns> The list of all components that match the type. </returns>
+		template<typename T>
+		const std::vector<T *> &QueryComponents()
+		{
+			return GetPool<T>().GetComponents();
+		}
+
+		/// <summary>
+		/// Returns the first component of a type found in the spatial structure, the earliest attached one that is still in it.
 		/// </summary>
 		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
-		/// <returns> The list specified by of all components that match the type. </returns>
+		/// <returns> The first component of the type found. </returns>
 		template<typename T>
-		std::vector<std::shared_ptr<T>> QueryComponents(const bool &allowDisabled = false)
+		std::shared_ptr<T> GetComponent(const bool &allowDisabled = false)
 		{
-			auto result = std::vector<std::shared_ptr<T>>();
+			auto component = GetPool<T>().GetFirst(allowDisabled);
 
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+			if (component == nullptr)
 			{
-				if ((*it)->IsRemoved())
+				return nullptr;
+			}
+
+			for (auto &attached : component->GetGameObject()->m_components)
+			{
+				if (attached.get() == component)
+				{
+					return std::static_pointer_cast<T>(attached);
+				}
+			}
+
+			return nullptr;
+		}
+
+		/// <summary>
+		/// Runs a function for each component of a type whose object also has the other types, like a system would. The
+		/// first type is read from its pool, the others are looked up on the object, a <seealso cref="Transform"/> can be
+		/// asked for as the objects transform. Components must not be attached or detached from inside the function.
+		/// </summary>
+		/// <param name="T"> The component type to iterate. </param>
+		/// <param name="Ts"> The other types the object must have. </param>
+		/// <param name="function"> The function, called with a reference to each type. </param>
+		/// <param name="allowDisabled"> If disabled components will be included. </param>
+		template<typename T, typename... Ts, typename F>
+		void ForEach(const F &function, const bool &allowDisabled = false)
+		{
+			for (auto &component : GetPool<T>().GetComponents())
+			{
+				if (!allowDisabled && !component->IsEnabled())
 				{
 					continue;
 				}
 
-				auto component = (*it)->GetComponent<T>();
+				auto others = std::make_tuple(Fetch<Ts>(*component->GetGameObject(), allowDisabled)...);
 
-				if (component != nullptr && (component->IsEnabled() || allowDisabled))
+				if (!std::apply([](auto... found) { return (... && (found != nullptr)); }, others))
 				{
-					result.emplace_back(component);
+					continue;
 				}
-			}
 
-			return result;
+				std::apply([&](auto... found) { function(*component, *found...); }, others);
+			}
 		}
 
 		/// <summary>
-		/// Returns the first component of a type found in the spatial structure.
+		/// Gets the pool of components of a type, it is filled from every object the first time it is asked for and then
+		/// kept as components are attached and detached. Renderers recording in parallel may ask for a new pool at the
+		/// same time, so the list of pools is only changed under a lock.
 		/// </summary>
-		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
-		/// <returns> The first component of the type found. </returns>
+		/// <param name="T"> The component type. </param>
+		/// <returns> The pool of components. </returns>
 		template<typename T>
-		std::shared_ptr<T> GetComponent(const bool &allowDisabled = false)
+		ComponentPool<T> &GetPool()
 		{
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+			uint32_t typeId = ComponentTypes::GetId<T>();
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+
+			if (typeId >= m_pools.size())
 			{
-				if ((*it)->IsRemoved())
-				{
-					continue;
-				}
+				m_pools.resize(typeId + 1);
+			}
 
-				auto component = (*it)->GetComponent<T>();
+			if (m_pools[typeId] == nullptr)
+			{
+				auto pool = std::make_unique<ComponentPool<T>>();
 
-				if (component != nullptr && (component->IsEnabled() || allowDisabled))
+				// Filled in the order objects were added, so the pool can tell which component came first.
+				for (auto &object : GetObjectsInOrder())
 				{
-					return component;
+					for (auto &component : object->m_components)
+					{
+						pool->Add(component.get());
+					}
 				}
+
+				m_pools[typeId] = std::move(pool);
 			}
 
-			return nullptr;
+			return *static_cast<ComponentPool<T> *>(m_pools[typeId].get());
 		}
 
 		bool Contains(const std::shared_ptr<GameObject> &object) override;
+
+		void OnComponentAdd(IComponent *component) override;
+
+		void OnComponentRemove(IComponent *component) override;
+
+		const DynamicAabbTree &GetTree() const { return m_tree; }
+	private:
+		void Refit(const uint32_t &index);
+
+		void AddUnbounded(std::vector<std::shared_ptr<GameObject>> &result) const;
+
+		void Detach(GameObject &object);
+
+		std::vector<GameObject *> GetObjectsInOrder() const;
+
+		template<typename T>
+		static T *Fetch(GameObject &object, const bool &allowDisabled)
+		{
+			auto component = object.GetComponentPointer<T>(allowDisabled);
+
+			if (component == nullptr || (!allowDisabled && !component->IsEnabled()))
+			{
+				return nullptr;
+			}
+
+			return component;
+		}
 	};
+
+	template<>
+	inline Transform *SceneStructure::Fetch<Transform>(GameObject &object, const bool &allowDisabled)
+	{
+		return &object.GetTransform();
+	}
 }
@@ -0,0 +1,216 @@
+#include "SceneTransforms.hpp"
+
+#include <unordered_map>
+#include "Engine/Engine.hpp"
+#include "Objects/GameObject.hpp"
+
+namespace acid
+{
+	const uint32_t SceneTransforms::PARALLEL_GRAIN_SIZE = 64;
+	const int32_t SceneTransforms::NO_PARENT = -1;
+	const int32_t SceneTransforms::EXTERNAL_PARENT = -2;
+
+	SceneTransforms::SceneTransforms() :
+		m_structure(std::vector<GameObject *>()),
+		m_structureParents(std::vector<const Transform *>()),
+		m_transforms(std::vector<Transform *>()),
+		m_parents(std::vector<int32_t>()),
+		m_positions(std::vector<Vector3>()),
+		m_rotations(std::vector<Vector3>()),
+		m_scalings(std::vector<Vector3>()),
+		m_dirty(std::vector<uint8_t>()),
+		m_worldMatrices(std::vector<Matrix4>()),
+		m_subtrees(std::vector<uint32_t>()),
+		m_externalRoots(std::vector<uint32_t>())
+	{
+	}
+
+	SceneTransforms::~SceneTransforms()
+	{
+	}
+
+	void SceneTransforms::Update(const std::vector<std::shared_ptr<GameObject>> &objects)
+	{
+		if (!IsOrderValid(objects))
+		{
+			BuildOrder(objects);
+		}
+
+		if (m_transforms.empty())
+		{
+			return;
+		}
+
+		// Parents outside of the structure are resolved serially, they may be shared between subtrees.
+		for (auto &root : m_externalRoots)
+		{
+			m_worldMatrices[root] = m_transforms[root]->GetParent()->GetWorldMatrix();
+		}
+
+		auto &threadPool = Engine::Get()->GetThreadPool();
+		auto subtreeCount = static_cast<uint32_t>(m_subtrees.size() - 1);
+		threadPool.Wait(threadPool.ParallelFor(0, subtreeCount, [this](uint32_t begin, uint32_t end)
+		{
+			UpdateRange(m_subtrees[begin], m_subtrees[end]);
+		}, PARALLEL_GRAIN_SIZE));
+	}
+
+	bool SceneTransforms::IsOrderValid(const std::vector<std::shared_ptr<GameObject>> &objects) const
+	{
+		if (objects.size() != m_structure.size())
+		{
+			return false;
+		}
+
+		for (std::size_t i = 0; i < objects.size(); i++)
+		{
+			if (objects[i].get() != m_structure[i] || objects[i]->GetTransform().GetParent() != m_structureParents[i])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void SceneTransforms::BuildOrder(const std::vector<std::shared_ptr<GameObject>> &objects)
+	{
+		auto count = static_cast<uint32_t>(objects.size());
+		std::unordered_map<const Transform *, uint32_t> indices = {};
+		m_structure.clear();
+		m_structureParents.clear();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			auto &transform = objects[i]->GetTransform();
+			m_structure.emplace_back(objects[i].get());
+			m_structureParents.emplace_back(transform.GetParent());
+			indices.emplace(&transform, i);
+		}
+
+		std::vector<std::vector<uint32_t>> children(count);
+		std::vector<uint32_t> roots = {};
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			auto parent = indices.find(m_structureParents[i]);
+
+			if (m_structureParents[i] != nullptr && parent != indices.end())
+			{
+				children[parent->second].emplace_back(i);
+			}
+			else
+			{
+				roots.emplace_back(i);
+			}
+		}
+
+		// Depth first, so every parent is updated before its children and each subtree is one contiguous range.
+		std::vector<uint32_t> order = {};
+		std::vector<int32_t> positions(count, NO_PARENT);
+		std::vector<uint32_t> stack = {};
+		order.reserve(count);
+		m_subtrees.clear();
+		m_externalRoots.clear();
+
+		for (auto &root : roots)
+		{
+			m_subtrees.emplace_back(static_cast<uint32_t>(order.size()));
+			stack.emplace_back(root);
+
+			while (!stack.empty())
+			{
+				auto index = stack.back();
+				stack.pop_back();
+				positions[index] = static_cast<int32_t>(order.size());
+				order.emplace_back(index);
+				stack.insert(stack.end(), children[index].rbegin(), children[index].rend());
+			}
+		}
+
+		m_subtrees.emplace_back(static_cast<uint32_t>(order.size()));
+
+		m_transforms.resize(order.size());
+		m_parents.resize(order.size());
+		m_positions.resize(order.size());
+		m_rotations.resize(order.size());
+		m_scalings.resize(order.size());
+		m_dirty.resize(order.size());
+		m_worldMatrices.resize(order.size());
+
+		for (uint32_t i = 0; i < order.size(); i++)
+		{
+			auto parent = m_structureParents[order[i]];
+			m_transforms[i] = &objects[order[i]]->GetTransform();
+
+			// Clean transforms keep their slot, dirty children of a clean parent are built from it.
+			m_worldMatrices[i] = m_transforms[i]->m_worldMatrix;
+
+			if (parent == nullptr)
+			{
+				m_parents[i] = NO_PARENT;
+			}
+			else if (indices.find(parent) != indices.end())
+			{
+				m_parents[i] = positions[indices[parent]];
+			}
+			else
+			{
+				m_parents[i] = EXTERNAL_PARENT;
+				m_externalRoots.emplace_back(i);
+			}
+		}
+	}
+
+	void SceneTransforms::UpdateRange(const uint32_t &begin, const uint32_t &end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			auto transform = m_transforms[i];
+			m_positions[i] = transform->m_position;
+			m_rotations[i] = transform->m_rotation;
+			m_scalings[i] = transform->m_scaling;
+			m_dirty[i] = transform->m_dirty || m_parents[i] == EXTERNAL_PARENT;
+		}
+
+		for (uint32_t i = begin; i < end; i++)
+		{
+			auto parent = m_parents[i];
+
+			if (parent >= 0 && m_dirty[parent])
+			{
+				m_dirty[i] = 1;
+			}
+
+			if (!m_dirty[i])
+			{
+				continue;
+			}
+
+			auto local = Matrix4::TransformationMatrix(m_positions[i], m_rotations[i], m_scalings[i]);
+
+			if (parent >= 0)
+			{
+				m_worldMatrices[i] = m_worldMatrices[parent] * local;
+			}
+			else if (parent == EXTERNAL_PARENT)
+			{
+				m_worldMatrices[i] = m_worldMatrices[i] * local;
+			}
+			else
+			{
+				m_worldMatrices[i] = local;
+			}
+		}
+
+		for (uint32_t i = begin; i < end; i++)
+		{
+			if (m_dirty[i])
+			{
+				m_transforms[i]->m_worldMatrix = m_worldMatrices[i];
+				m_transforms[i]->m_dirty = false;
+				m_transforms[i]->m_version++;
+			}
+		}
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Maths/Matrix4.hpp"
+#include "Maths/Transform.hpp"
+#include "Maths/Vector3.hpp"
+
+namespace acid
+{
+	class GameObject;
+
+	/// <summary>
+	/// Rebuilds the cached world matrix of every game object transform in a scene once per frame.
+	/// Transforms are stored depth first so parents always come before their children, each root and its children form a
+	/// contiguous range that is updated independently of the other roots.
+	/// </summary>
+	class ACID_EXPORT SceneTransforms
+	{
+	private:
+		static const uint32_t PARALLEL_GRAIN_SIZE;
+		static const int32_t NO_PARENT;
+		static const int32_t EXTERNAL_PARENT;
+
+		std::vector<GameObject *> m_structure;
+		std::vector<const Transform *> m_structureParents;
+
+		std::vector<Transform *> m_transforms;
+		std::vector<int32_t> m_parents;
+		std::vector<Vector3> m_positions;
+		std::vector<Vector3> m_rotations;
+		std::vector<Vector3> m_scalings;
+		std::vector<uint8_t> m_dirty;
+		std::vector<Matrix4> m_worldMatrices;
+		std::vector<uint32_t> m_subtrees;
+		std::vector<uint32_t> m_externalRoots;
+	public:
+		/// <summary>
+		/// Creates a new scene transforms pass.
+		/// </summary>
+		SceneTransforms();
+
+		~SceneTransforms();
+
+		/// <summary>
+		/// Rebuilds the world matrices of all dirty transforms and their children.
+		/// </summary>
+		/// <param name="objects"> The objects in the scene structure. </param>
+		void Update(const std::vector<std::shared_ptr<GameObject>> &objects);
+
+		/// <summary>
+		/// Gets the number of transforms tracked by the last update.
+		/// </summary>
+		/// <returns> The transform count. </returns>
+		uint32_t GetSize() const { return static_cast<uint32_t>(m_transforms.size()); }
+	private:
+		bool IsOrderValid(const std::vector<std::shared_ptr<GameObject>> &objects) const;
+
+		void BuildOrder(const std::vector<std::shared_ptr<GameObject>> &objects);
+
+		void UpdateRange(const uint32_t &begin, const uint32_t &end);
+	};
+}
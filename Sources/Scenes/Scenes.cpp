@@ -6,7 +6,8 @@ namespace acid
 {
 	Scenes::Scenes() :
 		m_scene(nullptr),
-		m_componentRegister(ComponentRegister())
+		m_componentRegister(ComponentRegister()),
+		m_transforms(SceneTransforms())
 	{
 	}
 
@@ -38,18 +39,17 @@ namespace acid
 
 		auto &gameObjects = m_scene->GetStructure()->GetAll();
 
-		for (auto it = gameObjects.begin(); it != gameObjects.end();)
+		// Objects may be added while updating, removed objects are dropped by the structure update.
+		for (std::size_t i = 0; i < gameObjects.size(); i++)
 		{
-			(*it)->Update();
+			gameObjects[i]->Update();
+		}
 
-			if ((*it)->IsRemoved())
-			{
-				it = gameObjects.erase(it);
-				continue;
-			}
+		// World matrices are rebuilt once here, after objects and physics have moved, instead of by every reader.
+		m_transforms.Update(gameObjects);
 
-			++it;
-		}
+		// Removes objects and refits the bounds of objects whose world matrix changed.
+		m_scene->GetStructure()->Update();
 
 		if (m_scene->GetCamera() == nullptr)
 		{
@@ -4,6 +4,7 @@
 #include "Objects/ComponentRegister.hpp"
 #include "IScene.hpp"
 #include "SceneStructure.hpp"
+#include "SceneTransforms.hpp"
 
 namespace acid
 {
@@ -17,6 +18,8 @@ namespace acid
 		IScene *m_scene;
 
 		ComponentRegister m_componentRegister;
+
+		SceneTransforms m_transforms;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -102,5 +105,11 @@ namespace acid
 		/// </summary>
 		/// <returns> If the scene is paused. </returns>
 		bool IsGamePaused() const { return m_scene->IsGamePaused(); }
+
+		/// <summary>
+		/// Gets the pass that rebuilds the world matrices of the scene objects.
+		/// </summary>
+		/// <returns> The scene transforms. </returns>
+		const SceneTransforms &GetTransforms() const { return m_transforms; }
 	};
 }
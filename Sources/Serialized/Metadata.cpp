@@ -9,7 +9,8 @@ namespace acid
 		m_name(String::Trim(String::RemoveAll(name, '\"'))),
 		m_value(String::Trim(value)),
 		m_children(std::vector<std::shared_ptr<Metadata>>()),
-		m_attributes(attributes)
+		m_attributes(attributes),
+		m_array(false)
 	{
 	}
 
@@ -17,7 +18,8 @@ namespace acid
 		m_name(source.m_name),
 		m_value(source.m_value),
 		m_children(source.m_children),
-		m_attributes(source.m_attributes)
+		m_attributes(source.m_attributes),
+		m_array(source.m_array)
 	{
 	}
 
@@ -19,6 +19,7 @@ namespace acid
 		std::string m_value;
 		std::vector<std::shared_ptr<Metadata>> m_children;
 		std::map<std::string, std::string> m_attributes;
+		bool m_array;
 	public:
 		Metadata(const std::string &name = "", const std::string &value = "", const std::map<std::string, std::string> &attributes = {});
 
@@ -44,6 +45,14 @@ namespace acid
 
 		void ClearChildren() { m_children.clear(); }
 
+		/// <summary>
+		/// Gets if this section was read from an array, so file formats that tell arrays from objects write it back as one.
+		/// </summary>
+		/// <returns> If this section is an array. </returns>
+		bool IsArray() const { return m_array; }
+
+		void SetArray(const bool &array) { m_array = array; }
+
 		std::shared_ptr<Metadata> AddChild(const std::shared_ptr<Metadata> &value);
 
 		bool RemoveChild(const std::shared_ptr<Metadata> &value);
@@ -1,6 +1,7 @@
 #include "RendererShadows.hpp"
 
 #include "Models/VertexModel.hpp"
+#include "Physics/FrustumCuller.hpp"
 #include "Scenes/Scenes.hpp"
 #include "ShadowRender.hpp"
 
@@ -20,12 +21,14 @@ namespace acid
 
 	void RendererShadows::Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera)
 	{
-		m_uniformScene.Push("projectionView", Shadows::Get()->GetShadowBox().GetProjectionViewMatrix());
+		auto &shadowBox = Shadows::Get()->GetShadowBox();
+		m_uniformScene.Push("projectionView", shadowBox.GetProjectionViewMatrix());
 		m_uniformScene.Push("cameraPosition", camera.GetPosition());
 
 		m_pipeline.BindPipeline(commandBuffer);
 
-		auto sceneShadowRenders = Scenes::Get()->GetStructure()->QueryComponents<ShadowRender>();
+		// Only casters inside the shadow box are drawn into the shadow map.
+		auto sceneShadowRenders = FrustumCuller(shadowBox.GetFrustum()).Cull(Scenes::Get()->GetStructure()->QueryComponents<ShadowRender>());
 
 		for (auto &shadowRender : sceneShadowRenders)
 		{
@@ -15,6 +15,7 @@ namespace acid
 		m_projectionViewMatrix(Matrix4()),
 		m_shadowMapSpaceMatrix(Matrix4()),
 		m_offset(CreateOffset()),
+		m_frustum(Frustum()),
 		m_centre(Vector3()),
 		m_farHeight(0.0f),
 		m_farWidth(0.0f),
@@ -203,6 +204,7 @@ namespace acid
 		m_shadowMapSpaceMatrix = Matrix4::IDENTITY;
 		m_projectionViewMatrix = m_projectionMatrix * m_lightViewMatrix;
 		m_shadowMapSpaceMatrix = m_offset * m_projectionViewMatrix;
+		m_frustum.Update(m_lightViewMatrix, m_projectionMatrix);
 	}
 
 	bool ShadowBox::IsInBox(const Vector3 &position, const float &radius) const
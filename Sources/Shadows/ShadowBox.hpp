@@ -2,6 +2,7 @@
 
 #include "Maths/Matrix4.hpp"
 #include "Maths/Vector4.hpp"
+#include "Physics/Frustum.hpp"
 #include "Scenes/ICamera.hpp"
 
 namespace acid
@@ -23,6 +24,7 @@ namespace acid
 		Matrix4 m_projectionViewMatrix;
 		Matrix4 m_shadowMapSpaceMatrix;
 		Matrix4 m_offset;
+		Frustum m_frustum;
 		Vector3 m_centre;
 
 		float m_farHeight, m_farWidth;
@@ -120,6 +122,12 @@ namespace acid
 		/// <returns> The light's "view" matrix. </returns>
 		Matrix4 GetLightSpaceTransform() const { return m_lightViewMatrix; }
 
+		/// <summary>
+		/// Gets the frustum of the shadow box, used to cull objects from the shadow render pass.
+		/// </summary>
+		/// <returns> The shadow box frustum. </returns>
+		const Frustum &GetFrustum() const { return m_frustum; }
+
 		Vector3 GetMinExtents() const { return m_minExtents; }
 
 		Vector3 GetMaxExtents() const { return m_maxExtents; }
@@ -28,4 +28,9 @@ namespace acid
 			m_shadowBox.Update(*Scenes::Get()->GetCamera(), m_lightDirection, m_shadowBoxOffset, m_shadowBoxDistance);
 		}
 	}
+
+	std::optional<ModuleAccess> Shadows::GetAccess() const
+	{
+		return ModuleAccess().Write<Shadows>().Read<Scenes>();
+	}
 }
@@ -38,6 +38,8 @@ namespace acid
 
 		void Update() override;
 
+		std::optional<ModuleAccess> GetAccess() const override;
+
 		Vector3 GetLightDirection() const { return m_lightDirection; }
 
 		void SetLightDirection(const Vector3 &lightDirection) { m_lightDirection = lightDirection; }
@@ -74,6 +76,6 @@ namespace acid
 		/// Get the shadow box, so that it can be used by other class to test if engine.entities are inside the box.
 		/// </summary>
 		/// <returns> The shadow box. </returns>
-		ShadowBox GetShadowBox() const { return m_shadowBox; }
+		const ShadowBox &GetShadowBox() const { return m_shadowBox; }
 	};
 }
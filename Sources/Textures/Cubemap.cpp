@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include "Display/Display.hpp"
+#include "Renderer/Renderer.hpp"
 #include "Resources/Resources.hpp"
 
 namespace acid
@@ -39,46 +40,32 @@ namespace acid
 		m_width(0),
 		m_height(0),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(false)
 	{
 #if ACID_VERBOSE
 		float debugStart = Engine::Get()->GetTimeMs();
 #endif
 
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		auto pixels = Texture::LoadPixels(filename, fileExt, SIDE_FILE_SUFFIXES, m_size, &m_width, &m_height, &m_components);
 
 		m_mipLevels = mipmap ? Texture::GetMipLevels(m_width, m_height) : 1;
 
-		Buffer bufferStaging = Buffer(m_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, m_size, 0, &data);
-		memcpy(data, pixels, m_size);
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-		Texture::CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, VK_SAMPLE_COUNT_1_BIT, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		Texture::CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, VK_SAMPLE_COUNT_1_BIT, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 6);
-		Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 6);
-		Texture::CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 6);
-
-		if (mipmap)
-		{
-			Texture::CreateMipmaps(m_image, m_width, m_height, m_mipLevels, 6);
-		}
-		else
-		{
-			Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels, 6);
-		}
-
 		Texture::CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
 		Texture::CreateImageView(m_image, m_imageView,VK_IMAGE_VIEW_TYPE_CUBE, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels,  6);
 
-		Buffer::CopyBuffer(bufferStaging.GetBuffer(), m_buffer, m_size);
+		// The faces are copied in the next upload batch, the cubemap is not bound to descriptors until it is ready.
+		auto &uploadManager = Renderer::Get()->GetUploadManager();
+		uploadManager.UploadBuffer(pixels, m_size, m_buffer);
+		uploadManager.UploadImage(pixels, m_size, m_image, m_width, m_height, m_mipLevels, 6, [this]()
+		{
+			m_ready = true;
+		});
 
 		m_imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		m_imageInfo.imageView = m_imageView;
@@ -106,11 +93,13 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(true)
 	{
-		Texture::CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		Texture::CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 6);
 		Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 6);
 		Texture::CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
@@ -135,30 +124,23 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(false)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Buffer bufferStaging = Buffer(m_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, m_size, 0, &data);
-		memcpy(data, pixels, m_size);
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-		Texture::CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		Texture::CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 6);
-		Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 6);
-		Texture::CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 6);
-	//	Texture::CreateMipmaps(m_image, m_width, m_height, m_mipLevels, 6);
-		Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels, 6);
 		Texture::CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
 		Texture::CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_CUBE, m_format, m_mipLevels, VK_IMAGE_ASPECT_COLOR_BIT, 6);
 
-		Buffer::CopyBuffer(bufferStaging.GetBuffer(), m_buffer, m_size);
+		auto &uploadManager = Renderer::Get()->GetUploadManager();
+		uploadManager.UploadBuffer(pixels, m_size, m_buffer);
+		uploadManager.UploadImage(pixels, m_size, m_image, m_width, m_height, m_mipLevels, 6, [this]()
+		{
+			m_ready = true;
+		});
 
 		m_imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		m_imageInfo.imageView = m_imageView;
@@ -169,11 +151,27 @@ namespace acid
 
 	Cubemap::~Cubemap()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		// The upload still references the image, and its callback this cubemap.
+		if (!m_ready)
+		{
+			Renderer::Get()->GetUploadManager().Wait();
+		}
+
+		// Frames still in flight may sample from the image.
+		auto sampler = m_sampler;
+		auto imageView = m_imageView;
+		auto image = m_image;
+		auto imageMemory = m_imageMemory;
+
+		Renderer::Retire([sampler, imageView, image, imageMemory]() mutable
+		{
+			auto logicalDevice = Display::Get()->GetLogicalDevice();
 
-		vkDestroySampler(logicalDevice, m_sampler, nullptr);
-		vkDestroyImageView(logicalDevice, m_imageView, nullptr);
-		vkDestroyImage(logicalDevice, m_image, nullptr);
+			vkDestroySampler(logicalDevice, sampler, nullptr);
+			vkDestroyImageView(logicalDevice, imageView, nullptr);
+			vkDestroyImage(logicalDevice, image, nullptr);
+			Display::Get()->GetMemoryAllocator().Free(imageMemory);
+		});
 	}
 
 	DescriptorType Cubemap::CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage)
@@ -29,11 +29,13 @@ namespace acid
 		uint32_t m_width, m_height;
 
 		VkImage m_image;
+		MemoryAllocation m_imageMemory;
 		VkImageView m_imageView;
 		VkSampler m_sampler;
 		VkFormat m_format;
 
 		VkDescriptorImageInfo m_imageInfo;
+		std::atomic<bool> m_ready;
 	public:
 		/// <summary>
 		/// Will find an existing cubemap with the same filename, or create a new cubemap.
@@ -84,8 +86,12 @@ namespace acid
 
 		VkWriteDescriptorSet GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const override;
 
+		bool IsReady() const override { return m_ready; }
+
 		std::string GetFilename() override { return m_filename; };
 
+		std::size_t GetMemorySize() const override { return static_cast<std::size_t>(m_size); }
+
 		std::string GetExtension() { return m_fileExt; };
 
 		uint32_t GetComponents() const { return m_components; }
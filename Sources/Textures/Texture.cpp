@@ -1,8 +1,10 @@
 #include "Texture.hpp"
 
+#include <array>
 #include <cmath>
 #include "Display/Display.hpp"
 #include "Helpers/FileSystem.hpp"
+#include "Renderer/Renderer.hpp"
 #include "Resources/Resources.hpp"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -43,9 +45,11 @@ namespace acid
 		m_width(0),
 		m_height(0),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(false)
 	{
 #if ACID_VERBOSE
 		float debugStart = Engine::Get()->GetTimeMs();
@@ -57,38 +61,22 @@ namespace acid
 			m_filename = Files::SearchFile(FALLBACK_PATH);
 		}
 
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		auto pixels = LoadPixels(m_filename, &m_width, &m_height, &m_components);
 
 		m_mipLevels = mipmap ? GetMipLevels(m_width, m_height) : 1;
 
-		Buffer bufferStaging = Buffer(m_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, m_size, 0, &data);
-		memcpy(data, pixels, m_size);
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-		CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
-		TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 1);
-		CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 1);
-
-		if (mipmap)
-		{
-			CreateMipmaps(m_image, m_width, m_height, m_mipLevels, 1);
-		}
-		else
-		{
-			TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels, 1);
-		}
-
 		CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
 		CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_2D, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 1);
 
-		Buffer::CopyBuffer(bufferStaging.GetBuffer(), m_buffer, m_size);
+		// The pixels are copied in the next upload batch, the texture is not bound to descriptors until it is ready.
+		auto &uploadManager = Renderer::Get()->GetUploadManager();
+		uploadManager.UploadBuffer(pixels, m_size, m_buffer);
+		uploadManager.UploadImage(pixels, m_size, m_image, m_width, m_height, m_mipLevels, 1, [this]()
+		{
+			m_ready = true;
+		});
 
 		m_imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		m_imageInfo.imageView = m_imageView;
@@ -116,12 +104,14 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_sampler(VK_NULL_HANDLE),
 		m_format(format),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(true)
 	{
-		CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
 		TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 1);
 		CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
@@ -145,31 +135,24 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
+		m_imageMemory({}),
 		m_imageView(VK_NULL_HANDLE),
 		m_sampler(VK_NULL_HANDLE),
 		m_format(format),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_ready(false)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Buffer bufferStaging = Buffer(m_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, m_size, 0, &data);
-		memcpy(data, pixels, m_size);
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-		CreateImage(m_image, m_bufferMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
+		CreateImage(m_image, m_imageMemory, m_width, m_height, VK_IMAGE_TYPE_2D, samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
-		TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 1);
-		CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 1);
-	//	Texture::CreateMipmaps(m_image, m_width, m_height, m_mipLevels, 1);
-		TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels, 1);
 		CreateImageSampler(m_sampler, m_repeatEdges, m_anisotropic, m_nearest, m_mipLevels);
 		CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_2D, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 1);
 
-		Buffer::CopyBuffer(bufferStaging.GetBuffer(), GetBuffer(), m_size);
+		auto &uploadManager = Renderer::Get()->GetUploadManager();
+		uploadManager.UploadBuffer(pixels, m_size, GetBuffer());
+		uploadManager.UploadImage(pixels, m_size, m_image, m_width, m_height, m_mipLevels, 1, [this]()
+		{
+			m_ready = true;
+		});
 
 		m_imageInfo.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 		m_imageInfo.imageView = m_imageView;
@@ -180,11 +163,27 @@ namespace acid
 
 	Texture::~Texture()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		// The upload still references the image, and its callback this texture.
+		if (!m_ready)
+		{
+			Renderer::Get()->GetUploadManager().Wait();
+		}
+
+		// Frames still in flight may sample from the image.
+		auto sampler = m_sampler;
+		auto imageView = m_imageView;
+		auto image = m_image;
+		auto imageMemory = m_imageMemory;
+
+		Renderer::Retire([sampler, imageView, image, imageMemory]() mutable
+		{
+			auto logicalDevice = Display::Get()->GetLogicalDevice();
 
-		vkDestroySampler(logicalDevice, m_sampler, nullptr);
-		vkDestroyImageView(logicalDevice, m_imageView, nullptr);
-		vkDestroyImage(logicalDevice, m_image, nullptr);
+			vkDestroySampler(logicalDevice, sampler, nullptr);
+			vkDestroyImageView(logicalDevice, imageView, nullptr);
+			vkDestroyImage(logicalDevice, image, nullptr);
+			Display::Get()->GetMemoryAllocator().Free(imageMemory);
+		});
 	}
 
 	DescriptorType Texture::CreateDescriptor(const uint32_t &binding, const VkShaderStageFlags &stage)
@@ -221,8 +220,13 @@ namespace acid
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
+		if (!m_ready)
+		{
+			Renderer::Get()->GetUploadManager().Wait();
+		}
+
 		VkImage dstImage;
-		VkDeviceMemory dstImageMemory;
+		MemoryAllocation dstImageMemory;
 		CopyImage(m_image, dstImage, dstImageMemory, m_width, m_height, false);
 
 		VkImageSubresource imageSubresource = {};
@@ -235,30 +239,17 @@ namespace acid
 
 		uint8_t *result = new uint8_t[subresourceLayout.size];
 
-		void *data;
-		vkMapMemory(logicalDevice, dstImageMemory, subresourceLayout.offset, subresourceLayout.size, 0, &data);
-		memcpy(result, data, static_cast<size_t>(subresourceLayout.size));
-		vkUnmapMemory(logicalDevice, dstImageMemory);
+		memcpy(result, static_cast<char *>(dstImageMemory.m_mapped) + subresourceLayout.offset, static_cast<size_t>(subresourceLayout.size));
 
-		vkFreeMemory(logicalDevice, dstImageMemory, nullptr);
 		vkDestroyImage(logicalDevice, dstImage, nullptr);
+		Display::Get()->GetMemoryAllocator().Free(dstImageMemory);
 
 		return result;
 	}
 
 	void Texture::SetPixels(uint8_t *pixels)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Buffer bufferStaging = Buffer(m_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, m_size, 0, &data);
-		memcpy(data, pixels, m_size);
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-		Buffer::CopyBuffer(bufferStaging.GetBuffer(), GetBuffer(), m_size);
+		Renderer::Get()->GetUploadManager().UploadBuffer(pixels, m_size, GetBuffer());
 	}
 
 	int32_t Texture::LoadSize(const std::string &filepath)
@@ -361,9 +352,13 @@ namespace acid
 		return static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
 	}
 
-	void Texture::CreateImage(VkImage &image, VkDeviceMemory &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers)
+	void Texture::CreateImage(VkImage &image, MemoryAllocation &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		auto graphicsFamily = Display::Get()->GetGraphicsFamily();
+		auto transferFamily = Display::Get()->GetTransferFamily();
+
+		std::array<uint32_t, 2> queueFamily = {graphicsFamily, transferFamily};
 
 		VkImageCreateInfo imageCreateInfo = {};
 		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -379,21 +374,26 @@ namespace acid
 		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 		imageCreateInfo.usage = usage;
 		imageCreateInfo.samples = samples;
-		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+		if (graphicsFamily != transferFamily)
+		{
+			imageCreateInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			imageCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamily.size());
+			imageCreateInfo.pQueueFamilyIndices = queueFamily.data();
+		}
+		else
+		{
+			imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
 
 		Display::CheckVk(vkCreateImage(logicalDevice, &imageCreateInfo, nullptr, &image));
 
 		VkMemoryRequirements memoryRequirements;
 		vkGetImageMemoryRequirements(logicalDevice, image, &memoryRequirements);
 
-		VkMemoryAllocateInfo memoryAllocateInfo = {};
-		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		memoryAllocateInfo.allocationSize = memoryRequirements.size;
-		memoryAllocateInfo.memoryTypeIndex = Buffer::FindMemoryType(memoryRequirements.memoryTypeBits, properties);
-
-		Display::CheckVk(vkAllocateMemory(logicalDevice, &memoryAllocateInfo, nullptr, &imageMemory));
+		imageMemory = Display::Get()->GetMemoryAllocator().Allocate(memoryRequirements, properties, tiling == VK_IMAGE_TILING_LINEAR);
 
-		Display::CheckVk(vkBindImageMemory(logicalDevice, image, imageMemory, 0));
+		Display::CheckVk(vkBindImageMemory(logicalDevice, image, imageMemory.m_memory, imageMemory.m_offset));
 	}
 
 	bool Texture::HasStencilComponent(const VkFormat &format)
@@ -503,6 +503,14 @@ namespace acid
 	{
 		CommandBuffer commandBuffer = CommandBuffer();
 
+		CreateMipmaps(commandBuffer.GetCommandBuffer(), image, width, height, mipLevels, layerCount);
+
+		commandBuffer.End();
+		commandBuffer.Submit();
+	}
+
+	void Texture::CreateMipmaps(const VkCommandBuffer &commandBuffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &mipLevels, const uint32_t &layerCount)
+	{
 		VkImageMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		barrier.image = image;
@@ -524,7 +532,7 @@ namespace acid
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
-			vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+			vkCmdPipelineBarrier(commandBuffer,
 				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
 				0, nullptr,
 				0, nullptr,
@@ -544,7 +552,7 @@ namespace acid
 			imageBlit.dstSubresource.baseArrayLayer = 0;
 			imageBlit.dstSubresource.layerCount = layerCount;
 
-			vkCmdBlitImage(commandBuffer.GetCommandBuffer(),
+			vkCmdBlitImage(commandBuffer,
 				image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 				image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 				1, &imageBlit,
@@ -555,7 +563,7 @@ namespace acid
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-			vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+			vkCmdPipelineBarrier(commandBuffer,
 				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
 				0, nullptr,
 				0, nullptr,
@@ -578,14 +586,11 @@ namespace acid
 		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-		vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+		vkCmdPipelineBarrier(commandBuffer,
 			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
 			0, nullptr,
 			0, nullptr,
 			1, &barrier);
-
-		commandBuffer.End();
-		commandBuffer.Submit();
 	}
 
 	void Texture::CreateImageSampler(VkSampler &sampler, const bool &repeatEdges, const bool &anisotropic, const bool &nearest, const uint32_t &mipLevels)
@@ -636,7 +641,7 @@ namespace acid
 		Display::CheckVk(vkCreateImageView(logicalDevice, &imageViewCreateInfo, nullptr, &imageView));
 	}
 
-	bool Texture::CopyImage(const VkImage &srcImage, VkImage &dstImage, VkDeviceMemory &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain)
+	bool Texture::CopyImage(const VkImage &srcImage, VkImage &dstImage, MemoryAllocation &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain)
 	{
 		// TODO: Reduce amount of Vulkan warnings.
 		auto physicalDevice = Display::Get()->GetPhysicalDevice();
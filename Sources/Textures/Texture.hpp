@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
@@ -31,11 +32,13 @@ namespace acid
 		uint32_t m_width, m_height;
 
 		VkImage m_image;
+		MemoryAllocation m_imageMemory;
 		VkImageView m_imageView;
 		VkSampler m_sampler;
 		VkFormat m_format;
 
 		VkDescriptorImageInfo m_imageInfo;
+		std::atomic<bool> m_ready;
 	public:
 		/// <summary>
 		/// Will find an existing texture with the same filename, or create a new texture.
@@ -84,6 +87,8 @@ namespace acid
 
 		VkWriteDescriptorSet GetWriteDescriptor(const uint32_t &binding, const DescriptorSet &descriptorSet) const override;
 
+		bool IsReady() const override { return m_ready; }
+
 		/// <summary>
 		/// Gets a copy of the textures pixels from memory, after usage is finished remember to delete the result.
 		/// </summary>
@@ -98,6 +103,8 @@ namespace acid
 
 		std::string GetFilename() override { return m_filename; };
 
+		std::size_t GetMemorySize() const override { return static_cast<std::size_t>(m_size); }
+
 		uint32_t GetComponents() const { return m_components; }
 
 		uint32_t GetWidth() const { return m_width; }
@@ -124,7 +131,7 @@ namespace acid
 
 		static uint32_t GetMipLevels(const uint32_t &width, const uint32_t &height);
 
-		static void CreateImage(VkImage &image, VkDeviceMemory &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers);
+		static void CreateImage(VkImage &image, MemoryAllocation &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers);
 
 		static bool HasStencilComponent(const VkFormat &format);
 
@@ -134,11 +141,22 @@ namespace acid
 
 		static void CreateMipmaps(const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &mipLevels, const uint32_t &layerCount);
 
+		/// <summary>
+		/// Records blits that fill every mip level from the first, each level is left in the shader read only layout.
+		/// </summary>
+		/// <param name="commandBuffer"> The graphics command buffer to record into. </param>
+		/// <param name="image"> The image, with all levels in the transfer destination layout. </param>
+		/// <param name="width"> The width of the first level. </param>
+		/// <param name="height"> The height of the first level. </param>
+		/// <param name="mipLevels"> The number of mip levels. </param>
+		/// <param name="layerCount"> The number of layers. </param>
+		static void CreateMipmaps(const VkCommandBuffer &commandBuffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &mipLevels, const uint32_t &layerCount);
+
 		static void CreateImageSampler(VkSampler &sampler, const bool &repeatEdges, const bool &anisotropic, const bool &nearest, const uint32_t &mipLevels);
 
 		static void CreateImageView(const VkImage &image, VkImageView &imageView, const VkImageViewType &type, const VkFormat &format, const VkImageAspectFlags &imageAspect, const uint32_t &mipLevels, const uint32_t &layerCount);
 
-		static bool CopyImage(const VkImage &srcImage, VkImage &dstImage, VkDeviceMemory &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain);
+		static bool CopyImage(const VkImage &srcImage, VkImage &dstImage, MemoryAllocation &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain);
 
 		static void InsertImageMemoryBarrier(const VkCommandBuffer &cmdbuffer, const VkImage &image, const VkAccessFlags &srcAccessMask,
 											 const VkAccessFlags &dstAccessMask, const VkImageLayout &oldImageLayout, const VkImageLayout &newImageLayout,
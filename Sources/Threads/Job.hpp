@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	class JobCounter;
+
+	/// <summary>
+	/// A single unit of work scheduled on a <seealso cref="ThreadPool"/>.
+	/// </summary>
+	struct ACID_HIDDEN Job
+	{
+		std::function<void()> m_function;
+		std::shared_ptr<JobCounter> m_counter;
+		std::atomic<uint32_t> m_dependencies;
+
+		Job(const std::function<void()> &function, const std::shared_ptr<JobCounter> &counter) :
+			m_function(function),
+			m_counter(counter),
+			m_dependencies(1)
+		{
+		}
+	};
+
+	/// <summary>
+	/// A counter shared by a group of jobs, it reaches zero once every job in the group has finished.
+	/// Jobs that depend on the group are held as continuations and scheduled when the counter reaches zero.
+	/// </summary>
+	class ACID_EXPORT JobCounter
+	{
+	private:
+		friend class ThreadPool;
+
+		std::atomic<uint32_t> m_pending;
+		std::mutex m_mutex;
+		std::vector<Job *> m_continuations;
+	public:
+		explicit JobCounter(const uint32_t &pending) :
+			m_pending(pending),
+			m_continuations(std::vector<Job *>())
+		{
+		}
+
+		bool IsComplete() const { return m_pending.load(std::memory_order_acquire) == 0; }
+	};
+
+	/// <summary>
+	/// A handle to a group of jobs, used to wait on or depend on the group.
+	/// </summary>
+	class ACID_EXPORT JobHandle
+	{
+	private:
+		friend class ThreadPool;
+
+		std::shared_ptr<JobCounter> m_counter;
+	public:
+		JobHandle(const std::shared_ptr<JobCounter> &counter = nullptr) :
+			m_counter(counter)
+		{
+		}
+
+		/// <summary>
+		/// Gets if every job referenced by this handle has finished, a empty handle is always complete.
+		/// </summary>
+		/// <returns> If the jobs are complete. </returns>
+		bool IsComplete() const { return m_counter == nullptr || m_counter->IsComplete(); }
+	};
+}
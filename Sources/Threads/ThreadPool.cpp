@@ -1,26 +1,295 @@
 #include "ThreadPool.hpp"
 
+#include <algorithm>
+
 namespace acid
 {
-	const uint32_t ThreadPool::HARDWARE_CONCURRENCY = std::thread::hardware_concurrency();
+	const uint32_t ThreadPool::HARDWARE_CONCURRENCY = std::max(std::thread::hardware_concurrency(), 1u);
+
+	static thread_local ThreadPool *CURRENT_POOL = nullptr;
+	static thread_local uint32_t CURRENT_INDEX = 0;
 
-	ThreadPool::ThreadPool(const uint32_t &threadCount)
+	ThreadPool::ThreadPool(const uint32_t &threadCount) :
+		m_workers(std::vector<std::thread>()),
+		m_queues(std::vector<std::unique_ptr<WorkStealingQueue<Job>>>()),
+		m_globalQueue(std::deque<Job *>()),
+		m_queued(0),
+		m_outstanding(0),
+		m_destroying(false)
 	{
-		for (uint32_t i = 0; i < threadCount; i++)
+		uint32_t count = std::max(threadCount, 1u);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_queues.emplace_back(std::make_unique<WorkStealingQueue<Job>>());
+		}
+
+		// The creating thread owns the first queue.
+		CURRENT_POOL = this;
+		CURRENT_INDEX = 0;
+
+		for (uint32_t i = 1; i < count; i++)
 		{
-			m_threads.emplace_back(std::make_unique<Thread>());
+			m_workers.emplace_back(std::thread(&ThreadPool::WorkerLoop, this, i));
 		}
 	}
 
 	ThreadPool::~ThreadPool()
 	{
+		Wait();
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_destroying = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto &worker : m_workers)
+		{
+			worker.join();
+		}
+
+		if (CURRENT_POOL == this)
+		{
+			CURRENT_POOL = nullptr;
+		}
+	}
+
+	JobHandle ThreadPool::Enqueue(const std::function<void()> &function, const std::vector<JobHandle> &dependencies)
+	{
+		auto counter = std::make_shared<JobCounter>(1);
+		auto job = new Job(function, counter);
+		m_outstanding.fetch_add(1, std::memory_order_relaxed);
+
+		for (auto &dependency : dependencies)
+		{
+			if (dependency.m_counter == nullptr)
+			{
+				continue;
+			}
+
+			std::lock_guard<std::mutex> lock(dependency.m_counter->m_mutex);
+
+			if (!dependency.m_counter->IsComplete())
+			{
+				job->m_dependencies.fetch_add(1, std::memory_order_relaxed);
+				dependency.m_counter->m_continuations.emplace_back(job);
+			}
+		}
+
+		// Releases the guard reference, the last finished dependency schedules the job otherwise.
+		if (job->m_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Schedule(job);
+		}
+
+		return JobHandle(counter);
+	}
+
+	JobHandle ThreadPool::ParallelFor(const uint32_t &begin, const uint32_t &end, const std::function<void(uint32_t, uint32_t)> &function,
+		const uint32_t &grainSize, const std::vector<JobHandle> &dependencies)
+	{
+		if (end <= begin)
+		{
+			return JobHandle();
+		}
+
+		uint32_t count = end - begin;
+		uint32_t grain = grainSize != 0 ? grainSize : std::max(count / (GetThreadCount() * 4), 1u);
+
+		// Small ranges are not worth the scheduling overhead.
+		if (count <= grain && dependencies.empty())
+		{
+			function(begin, end);
+			return JobHandle();
+		}
+
+		uint32_t chunks = (count + grain - 1) / grain;
+		auto counter = std::make_shared<JobCounter>(chunks);
+		auto shared = std::make_shared<std::function<void(uint32_t, uint32_t)>>(function);
+		std::vector<Job *> jobs = {};
+		jobs.reserve(chunks);
+
+		for (uint32_t i = 0; i < chunks; i++)
+		{
+			uint32_t chunkBegin = begin + (i * grain);
+			uint32_t chunkEnd = std::min(chunkBegin + grain, end);
+			jobs.emplace_back(new Job([shared, chunkBegin, chunkEnd]()
+			{
+				(*shared)(chunkBegin, chunkEnd);
+			}, counter));
+		}
+
+		m_outstanding.fetch_add(chunks, std::memory_order_relaxed);
+
+		for (auto &dependency : dependencies)
+		{
+			if (dependency.m_counter == nullptr)
+			{
+				continue;
+			}
+
+			std::lock_guard<std::mutex> lock(dependency.m_counter->m_mutex);
+
+			if (!dependency.m_counter->IsComplete())
+			{
+				for (auto &job : jobs)
+				{
+					job->m_dependencies.fetch_add(1, std::memory_order_relaxed);
+					dependency.m_counter->m_continuations.emplace_back(job);
+				}
+			}
+		}
+
+		for (auto &job : jobs)
+		{
+			if (job->m_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Schedule(job);
+			}
+		}
+
+		return JobHandle(counter);
+	}
+
+	void ThreadPool::Wait(const JobHandle &handle)
+	{
+		while (!handle.IsComplete())
+		{
+			if (!RunPending())
+			{
+				std::this_thread::yield();
+			}
+		}
 	}
 
 	void ThreadPool::Wait()
 	{
-		for (auto &thread : m_threads)
+		while (m_outstanding.load(std::memory_order_acquire) != 0)
+		{
+			if (!RunPending())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void ThreadPool::Schedule(Job *job)
+	{
+		m_queued.fetch_add(1, std::memory_order_release);
+
+		if (CURRENT_POOL != this || !m_queues[CURRENT_INDEX]->Push(job))
+		{
+			std::lock_guard<std::mutex> lock(m_globalMutex);
+			m_globalQueue.emplace_back(job);
+		}
+
+		// Takes the sleep lock so a worker can not miss the wake up between checking and waiting.
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+		}
+
+		m_condition.notify_one();
+	}
+
+	Job *ThreadPool::FindJob()
+	{
+		Job *job = nullptr;
+		uint32_t index = CURRENT_POOL == this ? CURRENT_INDEX : 0;
+
+		if (CURRENT_POOL == this)
+		{
+			job = m_queues[index]->Pop();
+		}
+
+		if (job == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(m_globalMutex);
+
+			if (!m_globalQueue.empty())
+			{
+				job = m_globalQueue.front();
+				m_globalQueue.pop_front();
+			}
+		}
+
+		for (uint32_t i = 1; job == nullptr && i <= m_queues.size(); i++)
+		{
+			job = m_queues[(index + i) % m_queues.size()]->Steal();
+		}
+
+		if (job != nullptr)
+		{
+			m_queued.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		return job;
+	}
+
+	bool ThreadPool::RunPending()
+	{
+		auto job = FindJob();
+
+		if (job == nullptr)
 		{
-			thread->Wait();
+			return false;
+		}
+
+		Execute(job);
+		return true;
+	}
+
+	void ThreadPool::Execute(Job *job)
+	{
+		job->m_function();
+
+		auto counter = job->m_counter;
+		delete job;
+
+		if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::vector<Job *> continuations = {};
+
+			{
+				std::lock_guard<std::mutex> lock(counter->m_mutex);
+				continuations.swap(counter->m_continuations);
+			}
+
+			for (auto &continuation : continuations)
+			{
+				if (continuation->m_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					Schedule(continuation);
+				}
+			}
+		}
+
+		m_outstanding.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void ThreadPool::WorkerLoop(const uint32_t &index)
+	{
+		CURRENT_POOL = this;
+		CURRENT_INDEX = index;
+
+		while (true)
+		{
+			if (RunPending())
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_condition.wait(lock, [this]()
+			{
+				return m_queued.load(std::memory_order_acquire) != 0 || m_destroying;
+			});
+
+			if (m_destroying && m_queued.load(std::memory_order_acquire) == 0)
+			{
+				break;
+			}
 		}
 	}
 }
@@ -1,31 +1,94 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "Engine/Exports.hpp"
-#include "Thread.hpp"
+#include "Job.hpp"
+#include "WorkStealingQueue.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A pool of threads.
+	/// A work stealing job system. Every worker owns a lock-free deque, idle workers steal from the others.
+	/// The thread that creates the pool owns a deque too, and runs jobs while it waits on them.
 	/// </summary>
 	class ACID_EXPORT ThreadPool
 	{
 	private:
-		std::vector<std::unique_ptr<Thread>> m_threads;
+		std::vector<std::thread> m_workers;
+		std::vector<std::unique_ptr<WorkStealingQueue<Job>>> m_queues;
+
+		std::deque<Job *> m_globalQueue;
+		std::mutex m_globalMutex;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_condition;
+
+		std::atomic<uint32_t> m_queued;
+		std::atomic<uint32_t> m_outstanding;
+		std::atomic<bool> m_destroying;
 	public:
 		static const uint32_t HARDWARE_CONCURRENCY;
 
-		ThreadPool(const uint32_t &threadCount = HARDWARE_CONCURRENCY);
+		/// <summary>
+		/// Creates a new thread pool.
+		/// </summary>
+		/// <param name="threadCount"> The number of threads that run jobs, including the creating thread. </param>
+		explicit ThreadPool(const uint32_t &threadCount = HARDWARE_CONCURRENCY);
 
 		~ThreadPool();
 
 		/// <summary>
-		/// Waits until all threads are finished.
+		/// Adds a job to the pool.
+		/// </summary>
+		/// <param name="function"> The job to run. </param>
+		/// <param name="dependencies"> Jobs that must finish before this job is started. </param>
+		/// <returns> A handle to the job. </returns>
+		JobHandle Enqueue(const std::function<void()> &function, const std::vector<JobHandle> &dependencies = {});
+
+		/// <summary>
+		/// Splits a range into chunks and runs each chunk as a job.
+		/// </summary>
+		/// <param name="begin"> The first index in the range. </param>
+		/// <param name="end"> One past the last index in the range. </param>
+		/// <param name="function"> The function called with each chunks [begin, end) range. </param>
+		/// <param name="grainSize"> The smallest number of indices in a chunk, 0 will pick a size from the thread count. </param>
+		/// <param name="dependencies"> Jobs that must finish before any chunk is started. </param>
+		/// <returns> A handle to every chunk. </returns>
+		JobHandle ParallelFor(const uint32_t &begin, const uint32_t &end, const std::function<void(uint32_t, uint32_t)> &function,
+			const uint32_t &grainSize = 0, const std::vector<JobHandle> &dependencies = {});
+
+		/// <summary>
+		/// Runs pending jobs on the calling thread until the jobs referenced by the handle have finished.
+		/// </summary>
+		/// <param name="handle"> The jobs to wait on. </param>
+		void Wait(const JobHandle &handle);
+
+		/// <summary>
+		/// Runs pending jobs on the calling thread until every job in the pool has finished.
 		/// </summary>
 		void Wait();
 
-		std::vector<std::unique_ptr<Thread>> &GetThreads() { return m_threads; }
+		/// <summary>
+		/// Gets the number of threads running jobs, including the thread that created the pool.
+		/// </summary>
+		/// <returns> The thread count. </returns>
+		uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_queues.size()); }
+	private:
+		void Schedule(Job *job);
+
+		Job *FindJob();
+
+		bool RunPending();
+
+		void Execute(Job *job);
+
+		void WorkerLoop(const uint32_t &index);
 	};
 }
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace acid
+{
+	/// <summary>
+	/// A fixed size lock-free Chase-Lev deque. The owning thread pushes and pops from the bottom, any other thread may steal from the top.
+	/// </summary>
+	/// <param name="T"> The type of item pointed to by the queue. </param>
+	template<typename T>
+	class WorkStealingQueue
+	{
+	private:
+		static const int64_t CAPACITY = 4096;
+		static const int64_t MASK = CAPACITY - 1;
+
+		std::atomic<int64_t> m_top;
+		std::atomic<int64_t> m_bottom;
+		std::array<std::atomic<T *>, CAPACITY> m_items;
+	public:
+		WorkStealingQueue() :
+			m_top(0),
+			m_bottom(0)
+		{
+			for (auto &item : m_items)
+			{
+				item.store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		/// <summary>
+		/// Pushes an item onto the bottom of the queue, must only be called by the owning thread.
+		/// </summary>
+		/// <param name="item"> The item to push. </param>
+		/// <returns> If the item was pushed, false if the queue is full. </returns>
+		bool Push(T *item)
+		{
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			int64_t top = m_top.load(std::memory_order_acquire);
+
+			if (bottom - top >= CAPACITY)
+			{
+				return false;
+			}
+
+			m_items[bottom & MASK].store(item, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// <summary>
+		/// Pops the newest item off the bottom of the queue, must only be called by the owning thread.
+		/// </summary>
+		/// <returns> The popped item, or nullptr if the queue is empty. </returns>
+		T *Pop()
+		{
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_seq_cst);
+			int64_t top = m_top.load(std::memory_order_seq_cst);
+
+			if (top > bottom)
+			{
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T *item = m_items[bottom & MASK].load(std::memory_order_relaxed);
+
+			if (top == bottom)
+			{
+				// The last item, race against thieves for it.
+				if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					item = nullptr;
+				}
+
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return item;
+		}
+
+		/// <summary>
+		/// Steals the oldest item from the top of the queue, may be called by any thread.
+		/// </summary>
+		/// <returns> The stolen item, or nullptr if the queue is empty or the steal lost a race. </returns>
+		T *Steal()
+		{
+			int64_t top = m_top.load(std::memory_order_seq_cst);
+			int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+
+			if (top >= bottom)
+			{
+				return nullptr;
+			}
+
+			T *item = m_items[top & MASK].load(std::memory_order_relaxed);
+
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr;
+			}
+
+			return item;
+		}
+
+		/// <summary>
+		/// Gets if the queue looks empty, the result may be stale as soon as it is returned.
+		/// </summary>
+		/// <returns> If the queue is empty. </returns>
+		bool IsEmpty() const { return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed); }
+	};
+}
@@ -17,7 +17,7 @@ namespace test
 
 		~MeshTerrain();
 
-		VertexModel *GetVertex(const uint32_t &col, const uint32_t &row) override;
+		VertexModel GetVertex(const uint32_t &col, const uint32_t &row) override;
 	private:
 		Vector3 GetPosition(const float &x, const float &z);
 
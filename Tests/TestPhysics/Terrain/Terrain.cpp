@@ -13,7 +13,7 @@ namespace test
 		m_minHeight(+std::numeric_limits<float>::infinity()),
 		m_maxHeight(-std::numeric_limits<float>::infinity())
 	{
-		m_noise.SetNoiseType(NoiseType::TYPE_PERLINFRACTAL);
+		m_noise.SetNoiseType(NoiseType::TYPE_VALUEFRACTAL);
 		m_noise.SetFrequency(0.01f);
 		m_noise.SetInterp(NoiseInterp::INTERP_QUINTIC);
 		m_noise.SetFractalType(NoiseFractal::FRACTAL_FBM);
@@ -77,24 +77,23 @@ namespace test
 		auto transform = GetGameObject()->GetTransform();
 		auto heightmap = std::vector<float>(vertexCount * vertexCount);
 
-		for (uint32_t row = 0; row < vertexCount; row++)
+		// Rows run along z and columns along x, matching how MeshTerrain reads the heightmap.
+		Vector2 origin = Vector2(transform.GetPosition().m_x - (m_sideLength / 2.0f), transform.GetPosition().m_z - (m_sideLength / 2.0f));
+		Vector2 step = Vector2(m_squareSize / 2.0f, m_squareSize / 2.0f);
+		m_noise.FillGrid2D(heightmap.data(), origin, step, vertexCount, vertexCount);
+
+		for (auto &height : heightmap)
 		{
-			for (uint32_t col = 0; col < vertexCount; col++)
+			height *= 30.0f;
+
+			if (height < m_minHeight)
+			{
+				m_minHeight = height;
+			}
+
+			if (height > m_maxHeight)
 			{
-				float x = ((row * m_squareSize) - m_sideLength) / 2.0f;
-				float z = ((col * m_squareSize) - m_sideLength) / 2.0f;
-				float height = 30.0f * m_noise.GetValueFractal(transform.GetPosition().m_x + x, transform.GetPosition().m_z + z);
-				heightmap[row * vertexCount + col] = height;
-
-				if (height < m_minHeight)
-				{
-					m_minHeight = height;
-				}
-
-				if (height > m_maxHeight)
-				{
-					m_maxHeight = height;
-				}
+				m_maxHeight = height;
 			}
 		}
 